@@ -15,6 +15,8 @@ using HomogeneousPoint = Eigen::Matrix<double, 3, 1>;
 using HomogeneousPoints = Eigen::Matrix<double, Eigen::Dynamic, 3>;
 using MapData =
     Eigen::Matrix<int, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+using DistanceFieldData =
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
 
 }  // namespace aliases
 }  // namespace common
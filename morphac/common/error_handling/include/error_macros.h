@@ -16,7 +16,29 @@
   }
 #endif
 
-#define MORPH_REQUIRE(condition, exception, error_message)                  \
+// Validation levels, set through the MORPHAC_CHECK_LEVEL CMake option.
+//
+// MORPH_REQUIRE validates the API boundaries (Constructors, setters, adding
+// robots to the playground, etc.) while MORPH_HOT_REQUIRE validates the hot
+// paths that run many times per simulation step (Construct arithmetic and
+// indexing, kinematic model derivatives, integrator stages, etc.).
+//
+// FULL: Both MORPH_REQUIRE and MORPH_HOT_REQUIRE are checked (Default).
+// BOUNDARY: Only MORPH_REQUIRE is checked.
+// NONE: Nothing is checked.
+//
+// The python bindings are built with the same level. As everything coming in
+// from python is an API boundary, they validate the arguments of the hot paths
+// they expose with MORPH_REQUIRE before calling into them.
+#define MORPHAC_CHECK_LEVEL_NONE 0
+#define MORPHAC_CHECK_LEVEL_BOUNDARY 1
+#define MORPHAC_CHECK_LEVEL_FULL 2
+
+#ifndef MORPHAC_CHECK_LEVEL
+#define MORPHAC_CHECK_LEVEL MORPHAC_CHECK_LEVEL_FULL
+#endif
+
+#define MORPH_CHECK_(condition, exception, error_message)                   \
   {                                                                         \
     if (!(condition)) {                                                     \
       std::cerr << "------- Requirement failed -------" << std::endl;       \
@@ -27,6 +49,32 @@
     }                                                                       \
   }
 
+// Disabled checks are still compiled (So that they don't go stale and the
+// variables that are only used in them aren't reported as unused), but are
+// never evaluated.
+#define MORPH_SKIP_CHECK_(condition, exception, error_message) \
+  {                                                            \
+    if (false) {                                               \
+      MORPH_CHECK_(condition, exception, error_message);       \
+    }                                                          \
+  }
+
+#if MORPHAC_CHECK_LEVEL >= MORPHAC_CHECK_LEVEL_BOUNDARY
+#define MORPH_REQUIRE(condition, exception, error_message) \
+  MORPH_CHECK_(condition, exception, error_message)
+#else
+#define MORPH_REQUIRE(condition, exception, error_message) \
+  MORPH_SKIP_CHECK_(condition, exception, error_message)
+#endif
+
+#if MORPHAC_CHECK_LEVEL >= MORPHAC_CHECK_LEVEL_FULL
+#define MORPH_HOT_REQUIRE(condition, exception, error_message) \
+  MORPH_CHECK_(condition, exception, error_message)
+#else
+#define MORPH_HOT_REQUIRE(condition, exception, error_message) \
+  MORPH_SKIP_CHECK_(condition, exception, error_message)
+#endif
+
 #define MORPH_WARNING(condition, warning_message)                            \
   {                                                                          \
     if (condition) {                                                         \
@@ -0,0 +1,89 @@
+#include "Eigen/Dense"
+#include "benchmark/benchmark.h"
+
+#include "constructs/include/state.h"
+
+namespace {
+
+using Eigen::VectorXd;
+
+using morphac::constructs::State;
+
+// State of the pose and velocity sizes given by the benchmark arguments.
+State CreateState(const benchmark::State& benchmark_state) {
+  return State(VectorXd::Random(benchmark_state.range(0)),
+               VectorXd::Random(benchmark_state.range(1)));
+}
+
+void BM_StateAddition(benchmark::State& benchmark_state) {
+  const State state1 = CreateState(benchmark_state);
+  const State state2 = CreateState(benchmark_state);
+  State result = State::CreateLike(state1);
+
+  for (auto _ : benchmark_state) {
+    result = state1 + state2;
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+// Constructing the result allocates, unlike assigning to an existing state.
+void BM_StateAdditionConstruction(benchmark::State& benchmark_state) {
+  const State state1 = CreateState(benchmark_state);
+  const State state2 = CreateState(benchmark_state);
+
+  for (auto _ : benchmark_state) {
+    State result = state1 + state2;
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+void BM_StateCompoundAddition(benchmark::State& benchmark_state) {
+  State state1 = CreateState(benchmark_state);
+  const State state2 = CreateState(benchmark_state);
+
+  for (auto _ : benchmark_state) {
+    state1 += state2;
+    benchmark::DoNotOptimize(state1);
+  }
+}
+
+void BM_StateScalarMultiplication(benchmark::State& benchmark_state) {
+  const State state = CreateState(benchmark_state);
+  State result = State::CreateLike(state);
+
+  for (auto _ : benchmark_state) {
+    result = 0.5 * state;
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+// The combination of the stages in an RK4 step.
+void BM_StateRK4Combination(benchmark::State& benchmark_state) {
+  const State state = CreateState(benchmark_state);
+  const State k1 = CreateState(benchmark_state);
+  const State k2 = CreateState(benchmark_state);
+  const State k3 = CreateState(benchmark_state);
+  const State k4 = CreateState(benchmark_state);
+  State result = State::CreateLike(state);
+
+  for (auto _ : benchmark_state) {
+    result = state + (0.1 / 6.) * (k1 + 2. * k2 + 2. * k3 + k4);
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+// Pose and velocity sizes of the states. The first two are the sizes of the
+// kinematic models.
+void StateSizes(benchmark::internal::Benchmark* benchmark) {
+  benchmark->Args({3, 0})->Args({4, 0})->Args({3, 3})->Args({100, 100});
+}
+
+BENCHMARK(BM_StateAddition)->Apply(StateSizes);
+BENCHMARK(BM_StateAdditionConstruction)->Apply(StateSizes);
+BENCHMARK(BM_StateCompoundAddition)->Apply(StateSizes);
+BENCHMARK(BM_StateScalarMultiplication)->Apply(StateSizes);
+BENCHMARK(BM_StateRK4Combination)->Apply(StateSizes);
+
+}  // namespace
+
+BENCHMARK_MAIN();
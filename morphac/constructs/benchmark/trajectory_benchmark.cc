@@ -0,0 +1,185 @@
+#include <vector>
+
+#include "Eigen/Dense"
+#include "benchmark/benchmark.h"
+
+#include "constructs/include/state.h"
+#include "constructs/include/trajectory.h"
+
+namespace {
+
+using std::vector;
+
+using Eigen::MatrixXd;
+
+using morphac::constructs::State;
+using morphac::constructs::Trajectory;
+
+// Sequential (one knot point at a time) insertion and removal is quadratic,
+// so it is only benchmarked up to this many knot points.
+constexpr int kMaximumSequentialSize = 100000;
+
+// Trajectory of the given size, with the knot point data equal to the index.
+Trajectory CreateTrajectory(const int size) {
+  MatrixXd data(size, 4);
+  for (int i = 0; i < size; ++i) {
+    data.row(i).setConstant(i);
+  }
+  return Trajectory(data, 2, 2);
+}
+
+// Every other index of a trajectory of the given size.
+vector<int> CreateIndices(const int size) {
+  vector<int> indices;
+  for (int i = 0; i < size; i += 2) {
+    indices.push_back(i);
+  }
+  return indices;
+}
+
+// Appending one knot point at a time. Amortized O(1) as the capacity grows
+// geometrically.
+void BM_TrajectoryAddKnotPoint(benchmark::State& benchmark_state) {
+  const int size = benchmark_state.range(0);
+  const State knot_point({1., 2.}, {3., 4.});
+
+  for (auto _ : benchmark_state) {
+    Trajectory trajectory(knot_point);
+    for (int i = 1; i < size; ++i) {
+      trajectory.AddKnotPoint(knot_point);
+    }
+    benchmark::DoNotOptimize(trajectory);
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() * size);
+}
+
+void BM_TrajectoryAppendKnotPoints(benchmark::State& benchmark_state) {
+  const int size = benchmark_state.range(0);
+  const State knot_point({1., 2.}, {3., 4.});
+  const vector<State> knot_points(size - 1, knot_point);
+
+  for (auto _ : benchmark_state) {
+    Trajectory trajectory(knot_point);
+    trajectory.AppendKnotPoints(knot_points);
+    benchmark::DoNotOptimize(trajectory);
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() * size);
+}
+
+void BM_TrajectoryAppendKnotPointsData(benchmark::State& benchmark_state) {
+  const int size = benchmark_state.range(0);
+  const State knot_point({1., 2.}, {3., 4.});
+  const MatrixXd data = MatrixXd::Ones(size - 1, 4);
+
+  for (auto _ : benchmark_state) {
+    Trajectory trajectory(knot_point);
+    trajectory.AppendKnotPoints(data);
+    benchmark::DoNotOptimize(trajectory);
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() * size);
+}
+
+// Doubling the size by inserting a knot point before every existing one.
+void BM_TrajectoryAddKnotPoints(benchmark::State& benchmark_state) {
+  const int size = benchmark_state.range(0);
+  const vector<int> indices = CreateIndices(2 * size);
+  const vector<State> knot_points(size, State({1., 2.}, {3., 4.}));
+
+  for (auto _ : benchmark_state) {
+    benchmark_state.PauseTiming();
+    Trajectory trajectory = CreateTrajectory(size);
+    benchmark_state.ResumeTiming();
+
+    trajectory.AddKnotPoints(knot_points, indices);
+    benchmark::DoNotOptimize(trajectory);
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() * size);
+}
+
+void BM_TrajectoryAddKnotPointSequential(benchmark::State& benchmark_state) {
+  const int size = benchmark_state.range(0);
+  const vector<int> indices = CreateIndices(2 * size);
+  const State knot_point({1., 2.}, {3., 4.});
+
+  for (auto _ : benchmark_state) {
+    benchmark_state.PauseTiming();
+    Trajectory trajectory = CreateTrajectory(size);
+    benchmark_state.ResumeTiming();
+
+    for (int i = 0; i < size; ++i) {
+      trajectory.AddKnotPoint(knot_point, indices[i]);
+    }
+    benchmark::DoNotOptimize(trajectory);
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() * size);
+}
+
+// Halving the size by removing every other knot point.
+void BM_TrajectoryRemoveKnotPoints(benchmark::State& benchmark_state) {
+  const int size = benchmark_state.range(0);
+  const vector<int> indices = CreateIndices(size);
+
+  for (auto _ : benchmark_state) {
+    benchmark_state.PauseTiming();
+    Trajectory trajectory = CreateTrajectory(size);
+    benchmark_state.ResumeTiming();
+
+    trajectory.RemoveKnotPoints(indices);
+    benchmark::DoNotOptimize(trajectory);
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() *
+                                    indices.size());
+}
+
+void BM_TrajectoryRemoveKnotPointSequential(
+    benchmark::State& benchmark_state) {
+  const int size = benchmark_state.range(0);
+  const vector<int> indices = CreateIndices(size);
+
+  for (auto _ : benchmark_state) {
+    benchmark_state.PauseTiming();
+    Trajectory trajectory = CreateTrajectory(size);
+    benchmark_state.ResumeTiming();
+
+    // Removing from the back so that the indices stay valid.
+    for (auto it = indices.rbegin(); it != indices.rend(); ++it) {
+      trajectory.RemoveKnotPoint(*it);
+    }
+    benchmark::DoNotOptimize(trajectory);
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() *
+                                    indices.size());
+}
+
+BENCHMARK(BM_TrajectoryAddKnotPoint)
+    ->RangeMultiplier(10)
+    ->Range(10000, 1000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TrajectoryAppendKnotPoints)
+    ->RangeMultiplier(10)
+    ->Range(10000, 1000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TrajectoryAppendKnotPointsData)
+    ->RangeMultiplier(10)
+    ->Range(10000, 1000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TrajectoryAddKnotPoints)
+    ->RangeMultiplier(10)
+    ->Range(10000, 1000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TrajectoryAddKnotPointSequential)
+    ->RangeMultiplier(10)
+    ->Range(1000, kMaximumSequentialSize)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TrajectoryRemoveKnotPoints)
+    ->RangeMultiplier(10)
+    ->Range(10000, 1000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TrajectoryRemoveKnotPointSequential)
+    ->RangeMultiplier(10)
+    ->Range(1000, kMaximumSequentialSize)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -1,6 +1,8 @@
 from ._binding_constructs_python import (
     ControlInput,
     Coordinate,
+    InterpolationType,
+    PathPoint,
     Pose,
     State,
     Trajectory,
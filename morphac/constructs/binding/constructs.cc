@@ -20,6 +20,8 @@ PYBIND11_MODULE(_binding_constructs_python, m) {
   define_pose_binding(m);
   define_velocity_binding(m);
   define_state_binding(m);
+  define_interpolation_type_binding(m);
+  define_path_point_binding(m);
   define_trajectory_binding(m);
 }
 
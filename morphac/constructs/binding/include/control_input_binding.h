@@ -1,6 +1,7 @@
 #ifndef INPUT_BINDING_H
 #define INPUT_BINDING_H
 
+#include "common/error_handling/include/error_macros.h"
 #include "constructs/include/control_input.h"
 #include "pybind11/eigen.h"
 #include "pybind11/operators.h"
@@ -1,6 +1,7 @@
 #ifndef COORDINATE_BINDING_H
 #define COORDINATE_BINDING_H
 
+#include "common/error_handling/include/error_macros.h"
 #include "constructs/include/coordinate.h"
 #include "pybind11/eigen.h"
 #include "pybind11/operators.h"
@@ -1,6 +1,7 @@
 #ifndef POSE_BINDING_H
 #define POSE_BINDING_H
 
+#include "common/error_handling/include/error_macros.h"
 #include "constructs/include/pose.h"
 #include "pybind11/eigen.h"
 #include "pybind11/operators.h"
@@ -1,6 +1,7 @@
 #ifndef STATE_BINDING_H
 #define STATE_BINDING_H
 
+#include "common/error_handling/include/error_macros.h"
 #include "constructs/include/state.h"
 #include "pybind11/eigen.h"
 #include "pybind11/operators.h"
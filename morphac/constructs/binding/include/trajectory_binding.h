@@ -12,6 +12,8 @@ namespace constructs {
 namespace binding {
 
 void define_trajectory_binding(pybind11::module& m);
+void define_interpolation_type_binding(pybind11::module& m);
+void define_path_point_binding(pybind11::module& m);
 
 }  // namespace binding
 }  // namespace constructs
@@ -1,6 +1,7 @@
 #ifndef VELOCITY_BINDING_H
 #define VELOCITY_BINDING_H
 
+#include "common/error_handling/include/error_macros.h"
 #include "constructs/include/velocity.h"
 #include "pybind11/eigen.h"
 #include "pybind11/operators.h"
@@ -10,6 +10,33 @@ using Eigen::VectorXd;
 
 using morphac::constructs::ControlInput;
 
+namespace {
+
+// The control input only validates its indices, sizes and emptiness on its hot
+// paths, so they are validated here for everything coming in from python.
+int WrapIndex(const ControlInput& control_input, const int index) {
+  // Implementing python's negative indexing.
+  const int wrapped_index =
+      index >= 0 ? index : index + control_input.get_size();
+  MORPH_REQUIRE(wrapped_index >= 0 && wrapped_index < control_input.get_size(),
+                std::out_of_range, "ControlInput index out of bounds.");
+  return wrapped_index;
+}
+
+void RequireSameSize(const ControlInput& control_input1,
+                     const ControlInput& control_input2) {
+  MORPH_REQUIRE(control_input1.get_size() == control_input2.get_size(),
+                std::invalid_argument,
+                "Control inputs are not of the same size.");
+}
+
+void RequireNonEmpty(const ControlInput& control_input) {
+  MORPH_REQUIRE(!control_input.IsEmpty(), std::logic_error,
+                "ControlInput object is empty");
+}
+
+}  // namespace
+
 void define_control_input_binding(py::module& m) {
   py::class_<ControlInput> control_input(m, "ControlInput");
 
@@ -20,29 +47,47 @@ void define_control_input_binding(py::module& m) {
   control_input.def(
       "__getitem__",
       [](const ControlInput& control_input, const int index) {
-        // Implementing python's negative indexing.
-        if (index >= 0) {
-          return control_input[index];
-        } else {
-          return control_input[index + control_input.get_size()];
-        }
+        return control_input[WrapIndex(control_input, index)];
       },
       py::is_operator());
   control_input.def(
       "__setitem__",
       [](ControlInput& control_input, const int index, const double scalar) {
-        // Implementing python's negative indexing.
-        if (index >= 0) {
-          control_input[index] = scalar;
-        } else {
-          control_input[index + control_input.get_size()] = scalar;
-        }
+        control_input[WrapIndex(control_input, index)] = scalar;
+      },
+      py::is_operator());
+  control_input.def(
+      "__iadd__",
+      [](ControlInput& control_input1,
+         const ControlInput& control_input2) -> ControlInput& {
+        RequireSameSize(control_input1, control_input2);
+        return control_input1 += control_input2;
+      },
+      py::is_operator());
+  control_input.def(
+      "__add__",
+      [](const ControlInput& control_input1,
+         const ControlInput& control_input2) {
+        RequireSameSize(control_input1, control_input2);
+        return control_input1 + control_input2;
+      },
+      py::is_operator());
+  control_input.def(
+      "__isub__",
+      [](ControlInput& control_input1,
+         const ControlInput& control_input2) -> ControlInput& {
+        RequireSameSize(control_input1, control_input2);
+        return control_input1 -= control_input2;
+      },
+      py::is_operator());
+  control_input.def(
+      "__sub__",
+      [](const ControlInput& control_input1,
+         const ControlInput& control_input2) {
+        RequireSameSize(control_input1, control_input2);
+        return control_input1 - control_input2;
       },
       py::is_operator());
-  control_input.def(py::self += py::self);
-  control_input.def(py::self + py::self);
-  control_input.def(py::self -= py::self);
-  control_input.def(py::self - py::self);
   control_input.def(py::self *= double());
   control_input.def(py::self * double());
   control_input.def(double() * py::self);
@@ -50,9 +95,24 @@ void define_control_input_binding(py::module& m) {
   control_input.def(py::self != py::self);
   control_input.def("__repr__", &ControlInput::ToString);
   control_input.def_property_readonly("size", &ControlInput::get_size);
+  // Read only numpy view of the control input storage, with get_data_ref
+  // being the writable view (See the Pose binding).
   control_input.def_property(
-      "data", &ControlInput::get_data,
+      "data",
+      py::cpp_function(
+          [](const ControlInput& control_input) -> const VectorXd& {
+            RequireNonEmpty(control_input);
+            return control_input.get_data();
+          },
+          py::return_value_policy::reference_internal),
       py::overload_cast<const VectorXd&>(&ControlInput::set_data));
+  control_input.def(
+      "get_data_ref",
+      [](ControlInput& control_input) -> VectorXd& {
+        RequireNonEmpty(control_input);
+        return control_input.get_data_ref();
+      },
+      py::return_value_policy::reference_internal);
   control_input.def("is_empty", &ControlInput::IsEmpty);
   control_input.def_static("create_like", &ControlInput::CreateLike,
                            py::arg("control_input"));
@@ -9,6 +9,20 @@ namespace py = pybind11;
 using morphac::common::aliases::Point;
 using morphac::constructs::Coordinate;
 
+namespace {
+
+// The coordinate only validates its indices on its hot path, so they are
+// validated here for everything coming in from python.
+int WrapIndex(const int index) {
+  // Implementing python's negative indexing.
+  const int wrapped_index = index >= 0 ? index : index + 2;
+  MORPH_REQUIRE(wrapped_index >= 0 && wrapped_index < 2, std::out_of_range,
+                "Coordinate index out of bounds.");
+  return wrapped_index;
+}
+
+}  // namespace
+
 void define_coordinate_binding(py::module& m) {
   py::class_<Coordinate> coordinate(m, "Coordinate");
 
@@ -18,23 +32,13 @@ void define_coordinate_binding(py::module& m) {
   coordinate.def(
       "__getitem__",
       [](const Coordinate& coord, const int index) {
-        // Implementing python's negative indexing.
-        if (index >= 0) {
-          return coord[index];
-        } else {
-          return coord[index + 2];
-        }
+        return coord[WrapIndex(index)];
       },
       py::is_operator());
   coordinate.def(
       "__setitem__",
       [](Coordinate& coord, const int index, const double scalar) {
-        // Implementing python's negative indexing.
-        if (index >= 0) {
-          coord[index] = scalar;
-        } else {
-          coord[index + 2] = scalar;
-        }
+        coord[WrapIndex(index)] = scalar;
       },
       py::is_operator());
   coordinate.def(py::self += py::self);
@@ -10,6 +10,29 @@ using Eigen::VectorXd;
 
 using morphac::constructs::Pose;
 
+namespace {
+
+// The pose only validates its indices, sizes and emptiness on its hot paths,
+// so they are validated here for everything coming in from python.
+int WrapIndex(const Pose& pose, const int index) {
+  // Implementing python's negative indexing.
+  const int wrapped_index = index >= 0 ? index : index + pose.get_size();
+  MORPH_REQUIRE(wrapped_index >= 0 && wrapped_index < pose.get_size(),
+                std::out_of_range, "Pose index out of bounds.");
+  return wrapped_index;
+}
+
+void RequireSameSize(const Pose& pose1, const Pose& pose2) {
+  MORPH_REQUIRE(pose1.get_size() == pose2.get_size(), std::invalid_argument,
+                "Poses are not of the same size.");
+}
+
+void RequireNonEmpty(const Pose& pose) {
+  MORPH_REQUIRE(!pose.IsEmpty(), std::logic_error, "Pose object is empty");
+}
+
+}  // namespace
+
 void define_pose_binding(py::module& m) {
   py::class_<Pose> pose(m, "Pose");
 
@@ -20,29 +43,43 @@ void define_pose_binding(py::module& m) {
   pose.def(
       "__getitem__",
       [](const Pose& pose, const int index) {
-        // Implementing python's negative indexing.
-        if (index >= 0) {
-          return pose[index];
-        } else {
-          return pose[index + pose.get_size()];
-        }
+        return pose[WrapIndex(pose, index)];
       },
       py::is_operator());
   pose.def(
       "__setitem__",
       [](Pose& pose, const int index, const double scalar) {
-        // Implementing python's negative indexing.
-        if (index >= 0) {
-          pose[index] = scalar;
-        } else {
-          pose[index + pose.get_size()] = scalar;
-        }
+        pose[WrapIndex(pose, index)] = scalar;
+      },
+      py::is_operator());
+  pose.def(
+      "__iadd__",
+      [](Pose& pose1, const Pose& pose2) -> Pose& {
+        RequireSameSize(pose1, pose2);
+        return pose1 += pose2;
+      },
+      py::is_operator());
+  pose.def(
+      "__add__",
+      [](const Pose& pose1, const Pose& pose2) {
+        RequireSameSize(pose1, pose2);
+        return pose1 + pose2;
+      },
+      py::is_operator());
+  pose.def(
+      "__isub__",
+      [](Pose& pose1, const Pose& pose2) -> Pose& {
+        RequireSameSize(pose1, pose2);
+        return pose1 -= pose2;
+      },
+      py::is_operator());
+  pose.def(
+      "__sub__",
+      [](const Pose& pose1, const Pose& pose2) {
+        RequireSameSize(pose1, pose2);
+        return pose1 - pose2;
       },
       py::is_operator());
-  pose.def(py::self += py::self);
-  pose.def(py::self + py::self);
-  pose.def(py::self -= py::self);
-  pose.def(py::self - py::self);
   pose.def(py::self *= double());
   pose.def(py::self * double());
   pose.def(double() * py::self);
@@ -50,8 +87,26 @@ void define_pose_binding(py::module& m) {
   pose.def(py::self != py::self);
   pose.def("__repr__", &Pose::ToString);
   pose.def_property_readonly("size", &Pose::get_size);
-  pose.def_property("data", &Pose::get_data,
-                    py::overload_cast<const VectorXd&>(&Pose::set_data));
+  // The data is returned as a read only numpy view of the pose storage, so
+  // reading it doesn't copy. Writing to its elements raises an error, so that
+  // the pose isn't modified by accident through a view that was only meant to
+  // be read. get_data_ref returns a writable view for modifying the pose.
+  pose.def_property(
+      "data",
+      py::cpp_function(
+          [](const Pose& pose) -> const VectorXd& {
+            RequireNonEmpty(pose);
+            return pose.get_data();
+          },
+          py::return_value_policy::reference_internal),
+      py::overload_cast<const VectorXd&>(&Pose::set_data));
+  pose.def(
+      "get_data_ref",
+      [](Pose& pose) -> VectorXd& {
+        RequireNonEmpty(pose);
+        return pose.get_data_ref();
+      },
+      py::return_value_policy::reference_internal);
   pose.def("is_empty", &Pose::IsEmpty);
   pose.def_static("create_like", &Pose::CreateLike, py::arg("pose"));
 }
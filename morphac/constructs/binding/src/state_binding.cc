@@ -12,6 +12,27 @@ using morphac::constructs::Pose;
 using morphac::constructs::State;
 using morphac::constructs::Velocity;
 
+namespace {
+
+// The state only validates its indices, dimensions and emptiness on its hot
+// paths, so they are validated here for everything coming in from python.
+int WrapIndex(const State& state, const int index) {
+  // Implementing python's negative indexing.
+  const int wrapped_index = index >= 0 ? index : index + state.get_size();
+  MORPH_REQUIRE(wrapped_index >= 0 && wrapped_index < state.get_size(),
+                std::out_of_range, "State index out of bounds.");
+  return wrapped_index;
+}
+
+void RequireSameDimensions(const State& state1, const State& state2) {
+  MORPH_REQUIRE(state1.get_pose_size() == state2.get_pose_size() &&
+                    state1.get_velocity_size() == state2.get_velocity_size(),
+                std::invalid_argument,
+                "States are not of the same dimensions.");
+}
+
+}  // namespace
+
 void define_state_binding(py::module& m) {
   py::class_<State> state(m, "State");
 
@@ -26,29 +47,43 @@ void define_state_binding(py::module& m) {
   state.def(
       "__getitem__",
       [](const State& state, const int index) {
-        // Implementing python's negative indexing.
-        if (index >= 0) {
-          return state[index];
-        } else {
-          return state[index + state.get_size()];
-        }
+        return state[WrapIndex(state, index)];
       },
       py::is_operator());
   state.def(
       "__setitem__",
       [](State& state, const int index, const double scalar) {
-        // Implementing python's negative indexing.
-        if (index >= 0) {
-          state[index] = scalar;
-        } else {
-          state[index + state.get_size()] = scalar;
-        }
+        state[WrapIndex(state, index)] = scalar;
+      },
+      py::is_operator());
+  state.def(
+      "__iadd__",
+      [](State& state1, const State& state2) -> State& {
+        RequireSameDimensions(state1, state2);
+        return state1 += state2;
+      },
+      py::is_operator());
+  state.def(
+      "__add__",
+      [](const State& state1, const State& state2) {
+        RequireSameDimensions(state1, state2);
+        return state1 + state2;
+      },
+      py::is_operator());
+  state.def(
+      "__isub__",
+      [](State& state1, const State& state2) -> State& {
+        RequireSameDimensions(state1, state2);
+        return state1 -= state2;
+      },
+      py::is_operator());
+  state.def(
+      "__sub__",
+      [](const State& state1, const State& state2) {
+        RequireSameDimensions(state1, state2);
+        return state1 - state2;
       },
       py::is_operator());
-  state.def(py::self += py::self);
-  state.def(py::self + py::self);
-  state.def(py::self -= py::self);
-  state.def(py::self - py::self);
   state.def(py::self *= double());
   state.def(py::self * double());
   state.def(double() * py::self);
@@ -58,14 +93,35 @@ void define_state_binding(py::module& m) {
   state.def_property_readonly("size", &State::get_size);
   state.def_property_readonly("pose_size", &State::get_pose_size);
   state.def_property_readonly("velocity_size", &State::get_velocity_size);
-  state.def_property("pose", py::overload_cast<>(&State::get_pose),
-                     &State::set_pose);
-  state.def_property("velocity", py::overload_cast<>(&State::get_velocity),
-                     &State::set_velocity);
+  state.def_property(
+      "pose",
+      [](State& state) -> Pose& {
+        MORPH_REQUIRE(!state.IsPoseEmpty(), std::logic_error,
+                      "Pose component is empty.");
+        return state.get_pose();
+      },
+      &State::set_pose);
+  state.def_property(
+      "velocity",
+      [](State& state) -> Velocity& {
+        MORPH_REQUIRE(!state.IsVelocityEmpty(), std::logic_error,
+                      "Velocity component is empty.");
+        return state.get_velocity();
+      },
+      &State::set_velocity);
   // Pose and Velocity data are not exposed as we can always call it using
   // state.pose.data and state.velocity.data
-  state.def_property("data", &State::get_data,
-                     py::overload_cast<const VectorXd&>(&State::set_data));
+  // As the pose and velocity are stored separately, the state data is a copy
+  // of both (Unlike their data, which are numpy views). state.pose.data and
+  // state.velocity.data read the state without copying, while
+  // state.pose.get_data_ref() and state.velocity.get_data_ref() also write it.
+  state.def_property(
+      "data",
+      [](const State& state) {
+        MORPH_REQUIRE(!state.IsEmpty(), std::logic_error, "State is empty.");
+        return state.get_data();
+      },
+      py::overload_cast<const VectorXd&>(&State::set_data));
   // Pose and Velocity IsEmpty is not exposed as we can call it using
   // state.pose.is_empty and state.velocity.is_empty
   state.def("is_empty", &State::IsEmpty);
@@ -10,6 +10,10 @@ using std::vector;
 
 using Eigen::MatrixXd;
 
+using morphac::common::aliases::Point;
+
+using morphac::constructs::InterpolationType;
+using morphac::constructs::PathPoint;
 using morphac::constructs::State;
 using morphac::constructs::Trajectory;
 
@@ -26,27 +30,20 @@ void define_trajectory_binding(py::module& m) {
       [](const Trajectory& trajectory, const int index) {
         // Implementing python's negative indexing.
         if (index >= 0) {
-          return trajectory[index];
+          return trajectory.get_knot_point(index);
         } else {
-          return trajectory[index + trajectory.get_size()];
+          return trajectory.get_knot_point(index + trajectory.get_size());
         }
       },
       py::is_operator());
   trajectory.def(
       "__setitem__",
       [](Trajectory& trajectory, const int index, const State& knot_point) {
-        MORPH_REQUIRE(
-            knot_point.get_pose_size() == trajectory.get_pose_size() &&
-                knot_point.get_velocity_size() ==
-                    trajectory.get_velocity_size(),
-            std::invalid_argument,
-            "State pose/velocity dimensions do not match that of the "
-            "trajectory.");
         // Implementing python's negative indexing.
         if (index >= 0) {
-          trajectory[index] = knot_point;
+          trajectory.set_knot_point(index, knot_point);
         } else {
-          trajectory[index + trajectory.get_size()] = knot_point;
+          trajectory.set_knot_point(index + trajectory.get_size(), knot_point);
         }
       },
       py::is_operator());
@@ -60,7 +57,24 @@ void define_trajectory_binding(py::module& m) {
   trajectory.def_property_readonly("pose_size", &Trajectory::get_pose_size);
   trajectory.def_property_readonly("velocity_size",
                                    &Trajectory::get_velocity_size);
-  trajectory.def_property("data", &Trajectory::get_data, &Trajectory::set_data);
+  trajectory.def_property_readonly("capacity", &Trajectory::get_capacity);
+  // The data is returned as a copy. A numpy view of the trajectory storage
+  // wouldn't be safe to keep around, as the storage is reallocated when the
+  // trajectory grows beyond its capacity.
+  trajectory.def_property(
+      "data",
+      [](const Trajectory& trajectory) {
+        return MatrixXd(trajectory.get_data());
+      },
+      &Trajectory::set_data);
+  trajectory.def_property("timestamps", &Trajectory::get_timestamps,
+                          &Trajectory::set_timestamps);
+  trajectory.def_property("angle_indices", &Trajectory::get_angle_indices,
+                          &Trajectory::set_angle_indices);
+  trajectory.def("has_timestamps", &Trajectory::HasTimestamps);
+  trajectory.def("clear_timestamps", &Trajectory::ClearTimestamps);
+  trajectory.def("reserve", &Trajectory::Reserve, py::arg("capacity"));
+  trajectory.def("shrink_to_fit", &Trajectory::ShrinkToFit);
   trajectory.def(
       "add_knot_point",
       py::overload_cast<const State&, const int>(&Trajectory::AddKnotPoint),
@@ -72,6 +86,23 @@ void define_trajectory_binding(py::module& m) {
                  py::overload_cast<const vector<State>&, vector<int>>(
                      &Trajectory::AddKnotPoints),
                  py::arg("knot_points"), py::arg("indices"));
+  trajectory.def("append_knot_points",
+                 py::overload_cast<const vector<State>&>(
+                     &Trajectory::AppendKnotPoints),
+                 py::arg("knot_points"));
+  trajectory.def("append_knot_points",
+                 py::overload_cast<const MatrixXd&>(
+                     &Trajectory::AppendKnotPoints),
+                 py::arg("data"));
+  trajectory.def(
+      "append_knot_points",
+      py::overload_cast<const vector<State>&, const vector<double>&>(
+          &Trajectory::AppendKnotPoints),
+      py::arg("knot_points"), py::arg("timestamps"));
+  trajectory.def("append_knot_points",
+                 py::overload_cast<const MatrixXd&, const vector<double>&>(
+                     &Trajectory::AppendKnotPoints),
+                 py::arg("data"), py::arg("timestamps"));
   trajectory.def("remove_knot_point",
                  py::overload_cast<const int>(&Trajectory::RemoveKnotPoint),
                  py::arg("index"));
@@ -80,6 +111,42 @@ void define_trajectory_binding(py::module& m) {
   trajectory.def("remove_knot_points",
                  py::overload_cast<vector<int>>(&Trajectory::RemoveKnotPoints),
                  py::arg("indices"));
+  trajectory.def("sample",
+                 py::overload_cast<const double, const InterpolationType>(
+                     &Trajectory::Sample, py::const_),
+                 py::arg("time"),
+                 py::arg("interpolation_type") = InterpolationType::kLinear);
+  trajectory.def("sample_batch", &Trajectory::SampleBatch, py::arg("times"),
+                 py::arg("interpolation_type") = InterpolationType::kLinear);
+  trajectory.def_property_readonly("arc_lengths",
+                                   &Trajectory::get_arc_lengths);
+  trajectory.def_property_readonly("path_length",
+                                   &Trajectory::get_path_length);
+  trajectory.def("sample_at_arc_length", &Trajectory::SampleAtArcLength,
+                 py::arg("arc_length"));
+  trajectory.def("find_nearest_path_point",
+                 py::overload_cast<const Point&>(
+                     &Trajectory::FindNearestPathPoint, py::const_),
+                 py::arg("point"));
+  trajectory.def("find_nearest_path_point",
+                 py::overload_cast<const Point&, const int, const int>(
+                     &Trajectory::FindNearestPathPoint, py::const_),
+                 py::arg("point"), py::arg("segment"), py::arg("window"));
+}
+
+void define_path_point_binding(py::module& m) {
+  py::class_<PathPoint> path_point(m, "PathPoint");
+  path_point.def_readonly("segment", &PathPoint::segment);
+  path_point.def_readonly("fraction", &PathPoint::fraction);
+  path_point.def_readonly("arc_length", &PathPoint::arc_length);
+  path_point.def_readonly("distance", &PathPoint::distance);
+  path_point.def_readonly("position", &PathPoint::position);
+}
+
+void define_interpolation_type_binding(py::module& m) {
+  py::enum_<InterpolationType> interpolation_type(m, "InterpolationType");
+  interpolation_type.value("LINEAR", InterpolationType::kLinear);
+  interpolation_type.value("HERMITE", InterpolationType::kHermite);
 }
 
 }  // namespace binding
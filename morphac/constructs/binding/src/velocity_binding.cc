@@ -10,6 +10,30 @@ using Eigen::VectorXd;
 
 using morphac::constructs::Velocity;
 
+namespace {
+
+// The velocity only validates its indices, sizes and emptiness on its hot
+// paths, so they are validated here for everything coming in from python.
+int WrapIndex(const Velocity& velocity, const int index) {
+  // Implementing python's negative indexing.
+  const int wrapped_index = index >= 0 ? index : index + velocity.get_size();
+  MORPH_REQUIRE(wrapped_index >= 0 && wrapped_index < velocity.get_size(),
+                std::out_of_range, "Velocity index out of bounds.");
+  return wrapped_index;
+}
+
+void RequireSameSize(const Velocity& velocity1, const Velocity& velocity2) {
+  MORPH_REQUIRE(velocity1.get_size() == velocity2.get_size(),
+                std::invalid_argument, "Velocities are not of the same size.");
+}
+
+void RequireNonEmpty(const Velocity& velocity) {
+  MORPH_REQUIRE(!velocity.IsEmpty(), std::logic_error,
+                "Velocity object is empty");
+}
+
+}  // namespace
+
 void define_velocity_binding(py::module& m) {
   py::class_<Velocity> velocity(m, "Velocity");
 
@@ -20,29 +44,43 @@ void define_velocity_binding(py::module& m) {
   velocity.def(
       "__getitem__",
       [](const Velocity& velocity, const int index) {
-        // Implementing python's negative indexing.
-        if (index >= 0) {
-          return velocity[index];
-        } else {
-          return velocity[index + velocity.get_size()];
-        }
+        return velocity[WrapIndex(velocity, index)];
       },
       py::is_operator());
   velocity.def(
       "__setitem__",
       [](Velocity& velocity, const int index, const double scalar) {
-        // Implementing python's negative indexing.
-        if (index >= 0) {
-          velocity[index] = scalar;
-        } else {
-          velocity[index + velocity.get_size()] = scalar;
-        }
+        velocity[WrapIndex(velocity, index)] = scalar;
+      },
+      py::is_operator());
+  velocity.def(
+      "__iadd__",
+      [](Velocity& velocity1, const Velocity& velocity2) -> Velocity& {
+        RequireSameSize(velocity1, velocity2);
+        return velocity1 += velocity2;
+      },
+      py::is_operator());
+  velocity.def(
+      "__add__",
+      [](const Velocity& velocity1, const Velocity& velocity2) {
+        RequireSameSize(velocity1, velocity2);
+        return velocity1 + velocity2;
+      },
+      py::is_operator());
+  velocity.def(
+      "__isub__",
+      [](Velocity& velocity1, const Velocity& velocity2) -> Velocity& {
+        RequireSameSize(velocity1, velocity2);
+        return velocity1 -= velocity2;
+      },
+      py::is_operator());
+  velocity.def(
+      "__sub__",
+      [](const Velocity& velocity1, const Velocity& velocity2) {
+        RequireSameSize(velocity1, velocity2);
+        return velocity1 - velocity2;
       },
       py::is_operator());
-  velocity.def(py::self += py::self);
-  velocity.def(py::self + py::self);
-  velocity.def(py::self -= py::self);
-  velocity.def(py::self - py::self);
   velocity.def(py::self *= double());
   velocity.def(py::self * double());
   velocity.def(double() * py::self);
@@ -50,9 +88,24 @@ void define_velocity_binding(py::module& m) {
   velocity.def(py::self != py::self);
   velocity.def("__repr__", &Velocity::ToString);
   velocity.def_property_readonly("size", &Velocity::get_size);
+  // Read only numpy view of the velocity storage, with get_data_ref
+  // being the writable view (See the Pose binding).
   velocity.def_property(
-      "data", &Velocity::get_data,
+      "data",
+      py::cpp_function(
+          [](const Velocity& velocity) -> const VectorXd& {
+            RequireNonEmpty(velocity);
+            return velocity.get_data();
+          },
+          py::return_value_policy::reference_internal),
       py::overload_cast<const VectorXd&>(&Velocity::set_data));
+  velocity.def(
+      "get_data_ref",
+      [](Velocity& velocity) -> VectorXd& {
+        RequireNonEmpty(velocity);
+        return velocity.get_data_ref();
+      },
+      py::return_value_policy::reference_internal);
   velocity.def("is_empty", &Velocity::IsEmpty);
   velocity.def_static("create_like", &Velocity::CreateLike,
                       py::arg("velocity"));
@@ -0,0 +1,217 @@
+#ifndef CONSTRUCT_EXPRESSION_H
+#define CONSTRUCT_EXPRESSION_H
+
+#include <type_traits>
+#include <utility>
+
+#include "Eigen/Dense"
+#include "common/error_handling/include/error_macros.h"
+
+namespace morphac {
+namespace constructs {
+
+class Pose;
+class Velocity;
+class ControlInput;
+
+// Lazily evaluated arithmetic on the constructs.
+//
+// The +, - and scalar * operators of Pose, Velocity, ControlInput and State
+// evaluate into new constructs. In the hot loops (Like the integrator stages)
+// the constructs can instead be wrapped with Lazy, which turns them into
+// light weight expressions that wrap the corresponding Eigen expression
+// templates. The arithmetic on the expressions doesn't compute anything, and
+// they are only evaluated when they are assigned to (or used to construct) a
+// construct. This way a combination like
+//
+//   updated_state = Lazy(state) + (dt / 6.) * (Lazy(k1) + 2. * Lazy(k2));
+//
+// is evaluated in a single coefficient wise loop, without any intermediate
+// constructs or allocations. As the evaluation is coefficient wise, the
+// assigned construct may also appear in the expression.
+//
+// The expressions only hold references to (the data of) the constructs that
+// they are made of, so they must not outlive them. They are not meant to be
+// stored (For example with auto), but to be evaluated right away.
+
+// Expression that evaluates to a construct of the given type. The Expression
+// is the underlying Eigen expression of the construct data.
+template <typename Construct, typename Expression>
+class VectorExpression {
+ public:
+  using ConstructType = Construct;
+  using ExpressionType = Expression;
+
+  explicit VectorExpression(const Expression& expression)
+      : expression_(expression) {}
+
+  int get_size() const { return expression_.size(); }
+  const Expression& get_expression() const { return expression_; }
+
+ private:
+  Expression expression_;
+};
+
+// Leaf expression, that refers to the data of a construct.
+template <typename Construct>
+using ConstructExpression =
+    VectorExpression<Construct, Eigen::Map<const Eigen::VectorXd>>;
+
+// Expression that evaluates to a State. The pose and velocity parts are
+// evaluated independently.
+template <typename PoseExpression, typename VelocityExpression>
+class StateExpression {
+ public:
+  StateExpression(
+      const VectorExpression<Pose, PoseExpression>& pose_expression,
+      const VectorExpression<Velocity, VelocityExpression>& velocity_expression)
+      : pose_expression_(pose_expression),
+        velocity_expression_(velocity_expression) {}
+
+  int get_pose_size() const { return pose_expression_.get_size(); }
+  int get_velocity_size() const { return velocity_expression_.get_size(); }
+  const VectorExpression<Pose, PoseExpression>& get_pose_expression() const {
+    return pose_expression_;
+  }
+  const VectorExpression<Velocity, VelocityExpression>&
+  get_velocity_expression() const {
+    return velocity_expression_;
+  }
+
+ private:
+  VectorExpression<Pose, PoseExpression> pose_expression_;
+  VectorExpression<Velocity, VelocityExpression> velocity_expression_;
+};
+
+namespace internal {
+
+// Types of the Eigen expressions that the construct expressions combine.
+template <typename Expression1, typename Expression2>
+using SumType = typename std::decay<decltype(
+    std::declval<const Expression1&>() +
+    std::declval<const Expression2&>())>::type;
+
+template <typename Expression1, typename Expression2>
+using DifferenceType = typename std::decay<decltype(
+    std::declval<const Expression1&>() -
+    std::declval<const Expression2&>())>::type;
+
+template <typename Expression>
+using ProductType = typename std::decay<decltype(
+    std::declval<double>() * std::declval<const Expression&>())>::type;
+
+}  // namespace internal
+
+// Expression that refers to the data of the construct.
+template <typename Construct>
+auto Lazy(const Construct& construct) -> decltype(construct.ToExpression()) {
+  return construct.ToExpression();
+}
+
+// The operators only combine expressions (Not the constructs themselves, whose
+// operators are evaluated right away). Combining expressions of different
+// constructs (Like a Pose and a Velocity) is a compile time error.
+template <typename Construct, typename Expression1, typename Expression2>
+VectorExpression<Construct, internal::SumType<Expression1, Expression2>>
+operator+(const VectorExpression<Construct, Expression1>& expression1,
+          const VectorExpression<Construct, Expression2>& expression2) {
+  MORPH_HOT_REQUIRE(expression1.get_size() == expression2.get_size(),
+                    std::invalid_argument,
+                    "Constructs are not of the same size. The + operator "
+                    "requires them to be of the same size.");
+  return VectorExpression<Construct,
+                          internal::SumType<Expression1, Expression2>>(
+      expression1.get_expression() + expression2.get_expression());
+}
+
+template <typename Construct, typename Expression1, typename Expression2>
+VectorExpression<Construct, internal::DifferenceType<Expression1, Expression2>>
+operator-(const VectorExpression<Construct, Expression1>& expression1,
+          const VectorExpression<Construct, Expression2>& expression2) {
+  MORPH_HOT_REQUIRE(expression1.get_size() == expression2.get_size(),
+                    std::invalid_argument,
+                    "Constructs are not of the same size. The - operator "
+                    "requires them to be of the same size.");
+  return VectorExpression<Construct,
+                          internal::DifferenceType<Expression1, Expression2>>(
+      expression1.get_expression() - expression2.get_expression());
+}
+
+template <typename Construct, typename Expression>
+VectorExpression<Construct, internal::ProductType<Expression>> operator*(
+    const double scalar,
+    const VectorExpression<Construct, Expression>& expression) {
+  return VectorExpression<Construct, internal::ProductType<Expression>>(
+      scalar * expression.get_expression());
+}
+
+template <typename Construct, typename Expression>
+VectorExpression<Construct, internal::ProductType<Expression>> operator*(
+    const VectorExpression<Construct, Expression>& expression,
+    const double scalar) {
+  return scalar * expression;
+}
+
+// The State expressions combine the pose and velocity parts separately. Both
+// sizes are validated before anything else, so that the error doesn't depend
+// on which part is checked first.
+template <typename PoseExpression1, typename VelocityExpression1,
+          typename PoseExpression2, typename VelocityExpression2>
+StateExpression<internal::SumType<PoseExpression1, PoseExpression2>,
+                internal::SumType<VelocityExpression1, VelocityExpression2>>
+operator+(
+    const StateExpression<PoseExpression1, VelocityExpression1>& expression1,
+    const StateExpression<PoseExpression2, VelocityExpression2>& expression2) {
+  MORPH_HOT_REQUIRE(
+      expression1.get_pose_size() == expression2.get_pose_size() &&
+          expression1.get_velocity_size() == expression2.get_velocity_size(),
+      std::invalid_argument,
+      "States are not of the same size. The + operator requires them to be of "
+      "the same size.");
+  return {expression1.get_pose_expression() + expression2.get_pose_expression(),
+          expression1.get_velocity_expression() +
+              expression2.get_velocity_expression()};
+}
+
+template <typename PoseExpression1, typename VelocityExpression1,
+          typename PoseExpression2, typename VelocityExpression2>
+StateExpression<
+    internal::DifferenceType<PoseExpression1, PoseExpression2>,
+    internal::DifferenceType<VelocityExpression1, VelocityExpression2>>
+operator-(
+    const StateExpression<PoseExpression1, VelocityExpression1>& expression1,
+    const StateExpression<PoseExpression2, VelocityExpression2>& expression2) {
+  MORPH_HOT_REQUIRE(
+      expression1.get_pose_size() == expression2.get_pose_size() &&
+          expression1.get_velocity_size() == expression2.get_velocity_size(),
+      std::invalid_argument,
+      "States are not of the same size. The - operator requires them to be of "
+      "the same size.");
+  return {expression1.get_pose_expression() - expression2.get_pose_expression(),
+          expression1.get_velocity_expression() -
+              expression2.get_velocity_expression()};
+}
+
+template <typename PoseExpression, typename VelocityExpression>
+StateExpression<internal::ProductType<PoseExpression>,
+                internal::ProductType<VelocityExpression>>
+operator*(
+    const double scalar,
+    const StateExpression<PoseExpression, VelocityExpression>& expression) {
+  return {scalar * expression.get_pose_expression(),
+          scalar * expression.get_velocity_expression()};
+}
+
+template <typename PoseExpression, typename VelocityExpression>
+StateExpression<internal::ProductType<PoseExpression>,
+                internal::ProductType<VelocityExpression>>
+operator*(
+    const StateExpression<PoseExpression, VelocityExpression>& expression,
+    const double scalar) {
+  return scalar * expression;
+}
+
+}  // namespace constructs
+}  // namespace morphac
+
+#endif
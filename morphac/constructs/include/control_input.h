@@ -6,6 +6,7 @@
 
 #include "Eigen/Dense"
 #include "common/error_handling/include/error_macros.h"
+#include "constructs/include/construct_expression.h"
 
 namespace morphac {
 namespace constructs {
@@ -22,11 +23,51 @@ class ControlInput {
   // Copy assignment.
   ControlInput& operator=(const ControlInput& control_input) = default;
 
+  // Move constructor. The moved from control input is left empty.
+  ControlInput(ControlInput&& control_input) noexcept;
+
+  // Move assignment. The moved from control input is left empty.
+  ControlInput& operator=(ControlInput&& control_input) noexcept;
+
+  // Evaluates the expression (See construct_expression.h) into a new control
+  // input.
+  template <typename Expression>
+  ControlInput(const VectorExpression<ControlInput, Expression>& expression)
+      : size_(expression.get_size()), data_(expression.get_expression()) {}
+
+  // Evaluates the expression in place. The control input itself may be a part
+  // of the expression.
+  template <typename Expression>
+  ControlInput& operator=(
+      const VectorExpression<ControlInput, Expression>& expression) {
+    data_ = expression.get_expression();
+    size_ = data_.size();
+    return *this;
+  }
+
   ControlInput& operator+=(const ControlInput& control_input);
   ControlInput operator+(const ControlInput& control_input) const;
   ControlInput& operator-=(const ControlInput& control_input);
   ControlInput operator-(const ControlInput& control_input) const;
   ControlInput& operator*=(const double scalar);
+  template <typename Expression>
+  ControlInput& operator+=(
+      const VectorExpression<ControlInput, Expression>& expression) {
+    MORPH_HOT_REQUIRE(size_ == expression.get_size(), std::invalid_argument,
+                      "Control inputs are not of the same size. The += "
+                      "operator requires them to be of the same size.");
+    data_ += expression.get_expression();
+    return *this;
+  }
+  template <typename Expression>
+  ControlInput& operator-=(
+      const VectorExpression<ControlInput, Expression>& expression) {
+    MORPH_HOT_REQUIRE(size_ == expression.get_size(), std::invalid_argument,
+                      "Control inputs are not of the same size. The -= "
+                      "operator requires them to be of the same size.");
+    data_ -= expression.get_expression();
+    return *this;
+  }
 
   friend bool operator==(const ControlInput& control_input1,
                          const ControlInput& control_input2);
@@ -44,10 +85,20 @@ class ControlInput {
 
   int get_size() const;
   const Eigen::VectorXd& get_data() const;
+  // Mutable reference to the data, for in place computations. The data must
+  // not be resized.
+  Eigen::VectorXd& get_data_ref();
   void set_data(const Eigen::VectorXd& data);
   void set_data(std::initializer_list<double> elements);
 
   bool IsEmpty() const;
+  // Expression that refers to the data of the control input (See
+  // construct_expression.h). Unlike get_data, this is also valid when the
+  // control input is empty.
+  ConstructExpression<ControlInput> ToExpression() const {
+    return ConstructExpression<ControlInput>(
+        Eigen::Map<const Eigen::VectorXd>(data_.data(), size_));
+  }
   static ControlInput CreateLike(
       const morphac::constructs::ControlInput& control_input);
 
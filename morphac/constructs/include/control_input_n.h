@@ -0,0 +1,141 @@
+#ifndef CONTROL_INPUT_N_H
+#define CONTROL_INPUT_N_H
+
+#include <sstream>
+
+#include "Eigen/Dense"
+#include "common/error_handling/include/error_macros.h"
+#include "constructs/include/control_input.h"
+
+namespace morphac {
+namespace constructs {
+
+// Fixed size variant of the ControlInput, with the size known at compile
+// time. Like StateN, none of the operations allocate any memory and it
+// converts to and from the dynamic ControlInput at API boundaries.
+template <int C>
+class ControlInputN {
+  static_assert(C >= 0, "ControlInputN size must be non-negative.");
+
+ public:
+  static constexpr int size = C;
+
+  using DataVector = Eigen::Matrix<double, C, 1>;
+
+  // Fixed size Eigen members may require aligned allocation.
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  // Zero initialized control input.
+  ControlInputN() : data_(DataVector::Zero()) {}
+  explicit ControlInputN(const DataVector& data) : data_(data) {}
+  explicit ControlInputN(
+      const morphac::constructs::ControlInput& control_input) {
+    MORPH_HOT_REQUIRE(control_input.get_size() == C, std::invalid_argument,
+                      "ControlInput dimensions do not match the dimensions of "
+                      "the fixed size control input.");
+    // Element wise copy so that no temporaries are created.
+    for (int i = 0; i < C; ++i) {
+      data_(i) = control_input[i];
+    }
+  }
+
+  // Copy constructor.
+  ControlInputN(const ControlInputN& control_input) = default;
+
+  // Copy assignment.
+  ControlInputN& operator=(const ControlInputN& control_input) = default;
+
+  ControlInputN& operator+=(const ControlInputN& control_input) {
+    data_ += control_input.data_;
+    return *this;
+  }
+  ControlInputN operator+(const ControlInputN& control_input) const {
+    return ControlInputN(DataVector(data_ + control_input.data_));
+  }
+  ControlInputN& operator-=(const ControlInputN& control_input) {
+    data_ -= control_input.data_;
+    return *this;
+  }
+  ControlInputN operator-(const ControlInputN& control_input) const {
+    return ControlInputN(DataVector(data_ - control_input.data_));
+  }
+  ControlInputN& operator*=(const double scalar) {
+    data_ *= scalar;
+    return *this;
+  }
+
+  friend bool operator==(const ControlInputN& control_input1,
+                         const ControlInputN& control_input2) {
+    return control_input1.data_.isApprox(control_input2.data_, 1e-6);
+  }
+  friend bool operator!=(const ControlInputN& control_input1,
+                         const ControlInputN& control_input2) {
+    return !(control_input1 == control_input2);
+  }
+
+  double& operator[](const int index) {
+    MORPH_HOT_REQUIRE(index >= 0 && index < C, std::out_of_range,
+                      "ControlInput index out of bounds.");
+    return data_(index);
+  }
+  const double& operator[](const int index) const {
+    MORPH_HOT_REQUIRE(index >= 0 && index < C, std::out_of_range,
+                      "ControlInput index out of bounds.");
+    return data_(index);
+  }
+
+  friend std::ostream& operator<<(std::ostream& os,
+                                  const ControlInputN& control_input) {
+    return os << control_input.ToControlInput();
+  }
+
+  int get_size() const { return C; }
+  const DataVector& get_data() const { return data_; }
+  DataVector& get_data_ref() { return data_; }
+  void set_data(const DataVector& data) { data_ = data; }
+
+  // Conversion to the dynamic ControlInput.
+  morphac::constructs::ControlInput ToControlInput() const {
+    return morphac::constructs::ControlInput(Eigen::VectorXd(data_));
+  }
+
+  // Copies the data into an existing ControlInput of the same size. Unlike
+  // ToControlInput, this doesn't allocate any memory.
+  void CopyTo(morphac::constructs::ControlInput& control_input) const {
+    MORPH_HOT_REQUIRE(control_input.get_size() == C, std::invalid_argument,
+                      "ControlInput dimensions do not match the dimensions of "
+                      "the fixed size control input.");
+    for (int i = 0; i < C; ++i) {
+      control_input[i] = data_(i);
+    }
+  }
+
+ private:
+  DataVector data_;
+};
+
+// Definition of the static member, so that it may be odr-used (Like being
+// bound to a const reference) before C++17.
+template <int C>
+constexpr int ControlInputN<C>::size;
+
+// Non-member multiplication operator functions to support lhs scalar
+// multiplication
+template <int C>
+ControlInputN<C> operator*(ControlInputN<C> control_input,
+                           const double scalar) {
+  control_input *= scalar;
+  return control_input;
+}
+
+template <int C>
+ControlInputN<C> operator*(const double scalar,
+                           ControlInputN<C> control_input) {
+  control_input *= scalar;
+  return control_input;
+}
+
+}  // namespace constructs
+}  // namespace morphac
+
+#endif
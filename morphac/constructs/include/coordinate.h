@@ -21,6 +21,12 @@ class Coordinate {
   // Copy assignment.
   Coordinate& operator=(const Coordinate& coord) = default;
 
+  // Move constructor.
+  Coordinate(Coordinate&& coord) noexcept = default;
+
+  // Move assignment.
+  Coordinate& operator=(Coordinate&& coord) noexcept = default;
+
   Coordinate& operator+=(const Coordinate& coord);
   Coordinate operator+(const Coordinate& coord) const;
   Coordinate& operator-=(const Coordinate& coord);
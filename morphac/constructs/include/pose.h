@@ -6,6 +6,7 @@
 
 #include "Eigen/Dense"
 #include "common/error_handling/include/error_macros.h"
+#include "constructs/include/construct_expression.h"
 
 namespace morphac {
 namespace constructs {
@@ -22,11 +23,47 @@ class Pose {
   // Copy assignment.
   Pose& operator=(const Pose& pose) = default;
 
+  // Move constructor. The moved from pose is left empty.
+  Pose(Pose&& pose) noexcept;
+
+  // Move assignment. The moved from pose is left empty.
+  Pose& operator=(Pose&& pose) noexcept;
+
+  // Evaluates the expression (See construct_expression.h) into a new pose.
+  template <typename Expression>
+  Pose(const VectorExpression<Pose, Expression>& expression)
+      : size_(expression.get_size()), data_(expression.get_expression()) {}
+
+  // Evaluates the expression in place. The pose itself may be a part of the
+  // expression.
+  template <typename Expression>
+  Pose& operator=(const VectorExpression<Pose, Expression>& expression) {
+    data_ = expression.get_expression();
+    size_ = data_.size();
+    return *this;
+  }
+
   Pose& operator+=(const Pose& pose);
   Pose operator+(const Pose& pose) const;
   Pose& operator-=(const Pose& pose);
   Pose operator-(const Pose& pose) const;
   Pose& operator*=(const double scalar);
+  template <typename Expression>
+  Pose& operator+=(const VectorExpression<Pose, Expression>& expression) {
+    MORPH_HOT_REQUIRE(size_ == expression.get_size(), std::invalid_argument,
+                      "Poses are not of the same size. The += operator "
+                      "requires them to be of the same size.");
+    data_ += expression.get_expression();
+    return *this;
+  }
+  template <typename Expression>
+  Pose& operator-=(const VectorExpression<Pose, Expression>& expression) {
+    MORPH_HOT_REQUIRE(size_ == expression.get_size(), std::invalid_argument,
+                      "Poses are not of the same size. The -= operator "
+                      "requires them to be of the same size.");
+    data_ -= expression.get_expression();
+    return *this;
+  }
 
   friend bool operator==(const Pose& pose1, const Pose& pose2);
   friend bool operator!=(const Pose& pose1, const Pose& pose2);
@@ -41,10 +78,20 @@ class Pose {
 
   int get_size() const;
   const Eigen::VectorXd& get_data() const;
+  // Mutable reference to the data, for in place computations. The data must
+  // not be resized.
+  Eigen::VectorXd& get_data_ref();
   void set_data(const Eigen::VectorXd& data);
   void set_data(std::initializer_list<double> elements);
 
   bool IsEmpty() const;
+  // Expression that refers to the data of the pose (See
+  // construct_expression.h). Unlike get_data, this is also valid when the pose
+  // is empty.
+  ConstructExpression<Pose> ToExpression() const {
+    return ConstructExpression<Pose>(
+        Eigen::Map<const Eigen::VectorXd>(data_.data(), size_));
+  }
   static Pose CreateLike(const morphac::constructs::Pose& pose);
 
  private:
@@ -29,11 +29,59 @@ class State {
   // Copy assignment.
   State& operator=(const State& state) = default;
 
+  // Move constructor. The moved from state is left empty.
+  State(State&& state) noexcept = default;
+
+  // Move assignment. The moved from state is left empty.
+  State& operator=(State&& state) noexcept = default;
+
+  // Evaluates the expression (See construct_expression.h) into a new state.
+  template <typename PoseExpression, typename VelocityExpression>
+  State(const StateExpression<PoseExpression, VelocityExpression>& expression)
+      : pose_(expression.get_pose_expression()),
+        velocity_(expression.get_velocity_expression()) {}
+
+  // Evaluates the expression in place. The state itself may be a part of the
+  // expression.
+  template <typename PoseExpression, typename VelocityExpression>
+  State& operator=(
+      const StateExpression<PoseExpression, VelocityExpression>& expression) {
+    pose_ = expression.get_pose_expression();
+    velocity_ = expression.get_velocity_expression();
+    return *this;
+  }
+
   State& operator+=(const State& state);
   State operator+(const State& state) const;
   State& operator-=(const State& state);
   State operator-(const State& state) const;
   State& operator*=(const double scalar);
+  template <typename PoseExpression, typename VelocityExpression>
+  State& operator+=(
+      const StateExpression<PoseExpression, VelocityExpression>& expression) {
+    MORPH_HOT_REQUIRE(
+        get_pose_size() == expression.get_pose_size() &&
+            get_velocity_size() == expression.get_velocity_size(),
+        std::invalid_argument,
+        "States are not of the same size. The += operator requires them to "
+        "be of the same size.");
+    pose_ += expression.get_pose_expression();
+    velocity_ += expression.get_velocity_expression();
+    return *this;
+  }
+  template <typename PoseExpression, typename VelocityExpression>
+  State& operator-=(
+      const StateExpression<PoseExpression, VelocityExpression>& expression) {
+    MORPH_HOT_REQUIRE(
+        get_pose_size() == expression.get_pose_size() &&
+            get_velocity_size() == expression.get_velocity_size(),
+        std::invalid_argument,
+        "States are not of the same size. The -= operator requires them to "
+        "be of the same size.");
+    pose_ -= expression.get_pose_expression();
+    velocity_ -= expression.get_velocity_expression();
+    return *this;
+  }
 
   friend bool operator==(const State& state1, const State& state2);
   friend bool operator!=(const State& state1, const State& state2);
@@ -58,6 +106,10 @@ class State {
 
   const Eigen::VectorXd& get_pose_data() const;
   const Eigen::VectorXd& get_velocity_data() const;
+  // Mutable references to the pose and velocity data, for in place
+  // computations. The data must not be resized.
+  Eigen::VectorXd& get_pose_data_ref();
+  Eigen::VectorXd& get_velocity_data_ref();
   const Eigen::VectorXd get_data() const;
 
   void set_pose(const morphac::constructs::Pose& pose);
@@ -73,6 +125,13 @@ class State {
   bool IsEmpty() const;
   bool IsPoseEmpty() const;
   bool IsVelocityEmpty() const;
+  // Expression that refers to the pose and velocity data of the state (See
+  // construct_expression.h).
+  StateExpression<Eigen::Map<const Eigen::VectorXd>,
+                  Eigen::Map<const Eigen::VectorXd>>
+  ToExpression() const {
+    return {pose_.ToExpression(), velocity_.ToExpression()};
+  }
   static State CreateLike(const morphac::constructs::State& state);
 
  private:
@@ -0,0 +1,168 @@
+#ifndef STATE_N_H
+#define STATE_N_H
+
+#include <sstream>
+
+#include "Eigen/Dense"
+#include "common/error_handling/include/error_macros.h"
+#include "constructs/include/state.h"
+
+namespace morphac {
+namespace constructs {
+
+// Fixed size variant of the State, with the pose and velocity sizes known at
+// compile time. The data is stored in a fixed size Eigen vector, so none of
+// the operations allocate any memory. This makes it suitable for hot code
+// paths (like model derivative computations) where the dimensions are known
+// beforehand. It converts to and from the dynamic State at API boundaries.
+// The data is stored as [pose, velocity], similar to State::get_data.
+template <int P, int V>
+class StateN {
+  static_assert(P >= 0 && V >= 0, "StateN sizes must be non-negative.");
+
+ public:
+  static constexpr int pose_size = P;
+  static constexpr int velocity_size = V;
+  static constexpr int size = P + V;
+
+  using PoseVector = Eigen::Matrix<double, P, 1>;
+  using VelocityVector = Eigen::Matrix<double, V, 1>;
+  using DataVector = Eigen::Matrix<double, P + V, 1>;
+
+  // Fixed size Eigen members may require aligned allocation.
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  // Zero initialized state.
+  StateN() : data_(DataVector::Zero()) {}
+  StateN(const PoseVector& pose_data, const VelocityVector& velocity_data) {
+    data_.template head<P>() = pose_data;
+    data_.template tail<V>() = velocity_data;
+  }
+  explicit StateN(const DataVector& data) : data_(data) {}
+  explicit StateN(const morphac::constructs::State& state) {
+    MORPH_HOT_REQUIRE(
+        state.get_pose_size() == P && state.get_velocity_size() == V,
+        std::invalid_argument,
+        "State dimensions do not match the dimensions of the fixed size "
+        "state.");
+    // Element wise copy so that no temporaries are created.
+    for (int i = 0; i < P + V; ++i) {
+      data_(i) = state[i];
+    }
+  }
+
+  // Copy constructor.
+  StateN(const StateN& state) = default;
+
+  // Copy assignment.
+  StateN& operator=(const StateN& state) = default;
+
+  StateN& operator+=(const StateN& state) {
+    data_ += state.data_;
+    return *this;
+  }
+  StateN operator+(const StateN& state) const {
+    return StateN(DataVector(data_ + state.data_));
+  }
+  StateN& operator-=(const StateN& state) {
+    data_ -= state.data_;
+    return *this;
+  }
+  StateN operator-(const StateN& state) const {
+    return StateN(DataVector(data_ - state.data_));
+  }
+  StateN& operator*=(const double scalar) {
+    data_ *= scalar;
+    return *this;
+  }
+
+  friend bool operator==(const StateN& state1, const StateN& state2) {
+    return state1.data_.isApprox(state2.data_, 1e-6);
+  }
+  friend bool operator!=(const StateN& state1, const StateN& state2) {
+    return !(state1 == state2);
+  }
+
+  double& operator[](const int index) {
+    MORPH_HOT_REQUIRE(index >= 0 && index < P + V, std::out_of_range,
+                      "State index out of bounds.");
+    return data_(index);
+  }
+  const double& operator[](const int index) const {
+    MORPH_HOT_REQUIRE(index >= 0 && index < P + V, std::out_of_range,
+                      "State index out of bounds.");
+    return data_(index);
+  }
+
+  friend std::ostream& operator<<(std::ostream& os, const StateN& state) {
+    return os << state.ToState();
+  }
+
+  int get_pose_size() const { return P; }
+  int get_velocity_size() const { return V; }
+  int get_size() const { return P + V; }
+
+  PoseVector get_pose_data() const { return data_.template head<P>(); }
+  VelocityVector get_velocity_data() const { return data_.template tail<V>(); }
+  const DataVector& get_data() const { return data_; }
+  DataVector& get_data_ref() { return data_; }
+
+  void set_pose_data(const PoseVector& pose_data) {
+    data_.template head<P>() = pose_data;
+  }
+  void set_velocity_data(const VelocityVector& velocity_data) {
+    data_.template tail<V>() = velocity_data;
+  }
+  void set_data(const DataVector& data) { data_ = data; }
+
+  // Conversion to the dynamic State.
+  morphac::constructs::State ToState() const {
+    return morphac::constructs::State(
+        Eigen::VectorXd(data_.template head<P>()),
+        Eigen::VectorXd(data_.template tail<V>()));
+  }
+
+  // Copies the data into an existing State of the same dimensions. Unlike
+  // ToState, this doesn't allocate any memory.
+  void CopyTo(morphac::constructs::State& state) const {
+    MORPH_HOT_REQUIRE(
+        state.get_pose_size() == P && state.get_velocity_size() == V,
+        std::invalid_argument,
+        "State dimensions do not match the dimensions of the fixed size "
+        "state.");
+    for (int i = 0; i < P + V; ++i) {
+      state[i] = data_(i);
+    }
+  }
+
+ private:
+  DataVector data_;
+};
+
+// Definitions of the static members, so that they may be odr-used (Like being
+// bound to a const reference) before C++17.
+template <int P, int V>
+constexpr int StateN<P, V>::pose_size;
+template <int P, int V>
+constexpr int StateN<P, V>::velocity_size;
+template <int P, int V>
+constexpr int StateN<P, V>::size;
+
+// Non-member multiplication operator functions to support lhs scalar
+// multiplication
+template <int P, int V>
+StateN<P, V> operator*(StateN<P, V> state, const double scalar) {
+  state *= scalar;
+  return state;
+}
+
+template <int P, int V>
+StateN<P, V> operator*(const double scalar, StateN<P, V> state) {
+  state *= scalar;
+  return state;
+}
+
+}  // namespace constructs
+}  // namespace morphac
+
+#endif
@@ -2,28 +2,73 @@
 #define TRAJECTORY_H
 
 #include <algorithm>
+#include <cstdint>
+#include <memory>
 #include <sstream>
 #include <vector>
 
 #include "Eigen/Dense"
+#include "common/aliases/include/eigen_aliases.h"
 #include "common/error_handling/include/error_macros.h"
 #include "constructs/include/state.h"
+#include "utils/include/angle_utils.h"
 
 namespace morphac {
 namespace constructs {
 
+// Interpolation between the knot points when sampling a timed trajectory. The
+// Hermite interpolation uses finite difference tangents at the knot points,
+// so that the sampled trajectory is C1 continuous.
+enum class InterpolationType { kLinear, kHermite };
+
+// Point on the path of a trajectory (See Trajectory::FindNearestPathPoint).
+struct PathPoint {
+  // Index of the knot point at the start of the segment that the point lies
+  // on, and the fraction of the segment at which it lies.
+  int segment;
+  double fraction;
+  double arc_length;
+  // Distance from the query point.
+  double distance;
+  morphac::common::aliases::Point position;
+};
+
+// Sequence of knot point states. The knot points are stored contiguously as the
+// rows of a single row major matrix, which may have more rows (the capacity)
+// than the number of knot points (the size) so that knot points can be added
+// without reallocating every time.
+// A trajectory may optionally be timed, with a strictly increasing timestamp
+// for each knot point, in which case it can be sampled at arbitrary times.
 class Trajectory {
  public:
+  // Row major so that each knot point is contiguous in memory.
+  using DataMatrix =
+      Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  // Read only views into the data, that don't copy anything. Note that they
+  // are invalidated if the trajectory reallocates (When knot points are added
+  // beyond the capacity).
+  using DataView = Eigen::Map<const DataMatrix>;
+  using ConstKnotPointView =
+      Eigen::Block<const DataMatrix, 1, Eigen::Dynamic, true>;
+
   Trajectory(const morphac::constructs::State& knot_point);
   Trajectory(const std::vector<morphac::constructs::State>& knot_points);
   Trajectory(const Eigen::MatrixXd& data, const int pose_size,
              const int velocity_size);
 
   // Copy constructor.
-  Trajectory(const Trajectory& trajectory) = default;
+  Trajectory(const Trajectory& trajectory);
 
   // Copy assignment.
-  Trajectory& operator=(const Trajectory& trajectory) = default;
+  Trajectory& operator=(const Trajectory& trajectory);
+
+  // Move constructor. The moved from trajectory is left without any knot
+  // points.
+  Trajectory(Trajectory&& trajectory) noexcept;
+
+  // Move assignment. The moved from trajectory is left without any knot
+  // points.
+  Trajectory& operator=(Trajectory&& trajectory) noexcept;
 
   Trajectory& operator+=(const Trajectory& trajectory);
   Trajectory operator+(const Trajectory& trajectory) const;
@@ -33,11 +78,10 @@ class Trajectory {
   friend bool operator!=(const Trajectory& trajectory1,
                          const Trajectory& trajectory2);
 
-  // We don't allow for setting a trajectory point through the () operator as
-  // we don't keep track of each row of the data matrix as a State object.
-  // The ReplaceKnotPoint function needs to be used for this.
-  morphac::constructs::State& operator[](const int index);
-  const morphac::constructs::State& operator[](const int index) const;
+  // Row view of the knot point data ([pose, velocity]). The knot points are
+  // only modified through the trajectory (Like set_knot_point), so that the
+  // path queries always see the current knot points.
+  ConstKnotPointView operator[](const int index) const;
 
   friend std::ostream& operator<<(std::ostream& os,
                                   const Trajectory& trajectory);
@@ -49,31 +93,183 @@ class Trajectory {
   int get_size() const;
   int get_pose_size() const;
   int get_velocity_size() const;
-  Eigen::MatrixXd get_data() const;
+  int get_capacity() const;
+  // Each row of the data is a knot point.
+  DataView get_data() const;
+  morphac::constructs::State get_knot_point(const int index) const;
+  const std::vector<double>& get_timestamps() const;
+  const std::vector<int>& get_angle_indices() const;
 
   void set_data(const Eigen::MatrixXd& data);
+  void set_knot_point(const int index,
+                      const morphac::constructs::State& knot_point);
+  // The timestamps must be strictly increasing, with one for each knot point.
+  void set_timestamps(const std::vector<double>& timestamps);
+  // Indices of the knot point components ([pose, velocity]) that are angles.
+  // These are interpolated along the shortest arc and normalized.
+  void set_angle_indices(const std::vector<int>& angle_indices);
+
+  bool HasTimestamps() const;
+  void ClearTimestamps();
+
+  // Makes sure that the capacity is at least the given capacity, so that the
+  // trajectory can grow up to it without reallocating.
+  void Reserve(const int capacity);
+  // Releases any unused capacity.
+  void ShrinkToFit();
 
   void AddKnotPoint(const morphac::constructs::State& knot_point,
                     const int index);
   void AddKnotPoint(const morphac::constructs::State& knot_point);
+  // Inserts the knot points such that each of them ends up at the
+  // corresponding index of the resulting trajectory (The ith smallest index
+  // is matched with the ith knot point). The indices must be unique. All the
+  // existing knot points are moved at most once.
   void AddKnotPoints(const std::vector<morphac::constructs::State>& knot_points,
                      std::vector<int> indices);
+  // Appends the knot points to the end of the trajectory. Appending is
+  // amortized O(1) per knot point. The data variant appends each row as a
+  // knot point.
+  void AppendKnotPoints(
+      const std::vector<morphac::constructs::State>& knot_points);
+  void AppendKnotPoints(const Eigen::MatrixXd& data);
+  // Timed variants, that require the trajectory to either be timed or empty.
+  // The timestamps must be strictly increasing and must come after the
+  // existing ones.
+  void AppendKnotPoints(
+      const std::vector<morphac::constructs::State>& knot_points,
+      const std::vector<double>& timestamps);
+  void AppendKnotPoints(const Eigen::MatrixXd& data,
+                        const std::vector<double>& timestamps);
 
   void RemoveKnotPoint(const int index);
   void RemoveKnotPoint();
+  // Removes the knot points at the given (unique) indices of the trajectory.
+  // All the remaining knot points are moved at most once.
   void RemoveKnotPoints(std::vector<int> indices);
 
+  // Samples the timed trajectory at the given time, by interpolating between
+  // the knot points around it. Times outside of the trajectory are clamped to
+  // its first and last knot points. The segment is found through a binary
+  // search.
+  morphac::constructs::State Sample(
+      const double time, const InterpolationType interpolation_type =
+                             InterpolationType::kLinear) const;
+  void Sample(const double time, morphac::constructs::State& sample,
+              const InterpolationType interpolation_type =
+                  InterpolationType::kLinear) const;
+  // Sampling with a cursor that is owned by the caller, and holds the segment
+  // of the previous sample (It may start at any value, like 0). The segment
+  // is searched for around the cursor first, so sampling at monotonic times
+  // through the same cursor is amortized O(1).
+  void Sample(const double time, morphac::constructs::State& sample,
+              int& segment_cursor,
+              const InterpolationType interpolation_type =
+                  InterpolationType::kLinear) const;
+  // Each row of the result is the sample at the corresponding time.
+  Eigen::MatrixXd SampleBatch(const std::vector<double>& times,
+                              const InterpolationType interpolation_type =
+                                  InterpolationType::kLinear) const;
+
+  // Path queries. The path is traced by the positions of the knot points
+  // (Their first two pose components), with straight segments between them.
+  // The cumulative arc lengths and a uniform grid over the segments are
+  // computed on the first query after the knot points change. Like sampling,
+  // the path queries may be made concurrently, as long as the trajectory
+  // isn't being modified at the same time.
+  // Cumulative arc length at each knot point.
+  const std::vector<double>& get_arc_lengths() const;
+  double get_path_length() const;
+  // Linearly interpolated knot point at the given arc length, which is
+  // clamped to the path.
+  morphac::constructs::State SampleAtArcLength(const double arc_length) const;
+  // Closest point on the path. The grid is searched outwards from the point,
+  // which is sublinear in the number of knot points for most paths.
+  PathPoint FindNearestPathPoint(
+      const morphac::common::aliases::Point& point) const;
+  // Closest point on the segments within the window around the given segment,
+  // which is O(window). For consecutive queries (like tracking the path), the
+  // segment of the previous query makes a good warm start, and the window
+  // also prevents jumping to other parts of a path that crosses itself.
+  PathPoint FindNearestPathPoint(const morphac::common::aliases::Point& point,
+                                 const int segment, const int window) const;
+
  private:
-  // Dim is constant for a trajectory once it is defined. Even if the entire
-  // data of the trajectory is changed, it must maintain the original dimension.
-  // This is because dim is the identity of the trajectory and changing this
-  // probably warrants the creation of a new Trajectory object.
+  // Lazily computed data for the path queries.
+  struct PathIndex {
+    std::vector<double> arc_lengths;
+    // Uniform grid over the bounding box of the path. The segments whose
+    // bounding boxes overlap the cell with index i are given by
+    // cell_segments[cell_offsets[i], cell_offsets[i + 1]).
+    morphac::common::aliases::Point origin =
+        morphac::common::aliases::Point::Zero();
+    double cell_size = 0.;
+    int num_cols = 0;
+    int num_rows = 0;
+    std::vector<int> cell_offsets;
+    std::vector<int> cell_segments;
+  };
 
-  void copy_data_to_knot_points(const Eigen::MatrixXd& data);
+  // Makes sure that the capacity is at least the given capacity. The capacity
+  // is grown geometrically so that adding knot points one at a time is
+  // amortized O(1).
+  void EnsureCapacity(const int capacity);
+  void ReleaseKnotPoints() noexcept;
+  void RequireCompatible(const morphac::constructs::State& knot_point) const;
+  // Copies the (compatible) knot point into the row at the given index.
+  void CopyKnotPoint(const morphac::constructs::State& knot_point,
+                     const int index);
+  // Adding knot points without timestamps requires the trajectory to be
+  // untimed, while adding them with timestamps requires it to be timed (or
+  // empty) and the timestamps to come after the existing ones.
+  void RequireUntimed() const;
+  void RequireAppendable(const std::vector<double>& timestamps) const;
+  // Removes the rows at the given sorted and unique indices, moving every
+  // remaining row at most once. Returns the number of remaining rows.
+  static int RemoveRows(double* data, const int dim, const int size,
+                        const std::vector<int>& indices);
+  // Index k of the segment [b_k, b_k+1) of the (non-decreasing) breakpoints
+  // that contains the value, which must lie within the breakpoints. The
+  // cursor is checked first, and is updated to the segment.
+  int FindSegment(const std::vector<double>& breakpoints, const double value,
+                  int& segment_cursor) const;
+  // Linearly interpolates a component at the fraction of the segment.
+  double InterpolateLinearly(const int component, const int segment,
+                             const double fraction) const;
+  // Interpolates a component of the knot points at the given time, which
+  // must lie within the segment.
+  double InterpolateComponent(const int component, const int segment,
+                              const double time,
+                              const InterpolationType interpolation_type) const;
+  // Finite difference tangent of a component at the knot point.
+  double ComputeTangent(const int component, const int index) const;
+  // Difference between the components of two knot points, that is normalized
+  // for the angle components.
+  double ComputeDifference(const int component, const int index1,
+                           const int index2) const;
+  bool IsAngle(const int component) const;
+  void RequirePath() const;
+  // Builds the path index if required.
+  const PathIndex& GetPathIndex() const;
+  void InvalidatePathIndex();
+  PathPoint ProjectOntoSegment(const PathIndex& path_index,
+                               const morphac::common::aliases::Point& point,
+                               const int segment) const;
 
   int pose_size_;
   int velocity_size_;
-  std::vector<morphac::constructs::State> knot_points_;
+  int size_;
+  // Only the first size_ rows are valid knot points.
+  DataMatrix data_;
+  // Either empty (untimed) or has one timestamp for each knot point.
+  std::vector<double> timestamps_;
+  std::vector<int> angle_indices_;
+  std::vector<bool> is_angle_;
+  // Null until the path index is built. Concurrent queries may build it at
+  // the same time, so it is only accessed atomically in the const functions,
+  // and is set at most once until the knot points change. The (immutable)
+  // path index is shared by copies of the trajectory.
+  mutable std::shared_ptr<const PathIndex> path_index_;
 };
 
 }  // namespace constructs
@@ -6,6 +6,7 @@
 
 #include "Eigen/Dense"
 #include "common/error_handling/include/error_macros.h"
+#include "constructs/include/construct_expression.h"
 
 namespace morphac {
 namespace constructs {
@@ -22,11 +23,50 @@ class Velocity {
   // Copy assignment.
   Velocity& operator=(const Velocity& velocity) = default;
 
+  // Move constructor. The moved from velocity is left empty.
+  Velocity(Velocity&& velocity) noexcept;
+
+  // Move assignment. The moved from velocity is left empty.
+  Velocity& operator=(Velocity&& velocity) noexcept;
+
+  // Evaluates the expression (See construct_expression.h) into a new velocity.
+  template <typename Expression>
+  Velocity(const VectorExpression<Velocity, Expression>& expression)
+      : size_(expression.get_size()), data_(expression.get_expression()) {}
+
+  // Evaluates the expression in place. The velocity itself may be a part of the
+  // expression.
+  template <typename Expression>
+  Velocity& operator=(
+      const VectorExpression<Velocity, Expression>& expression) {
+    data_ = expression.get_expression();
+    size_ = data_.size();
+    return *this;
+  }
+
   Velocity& operator+=(const Velocity& velocity);
   Velocity operator+(const Velocity& velocity) const;
   Velocity& operator-=(const Velocity& velocity);
   Velocity operator-(const Velocity& velocity) const;
   Velocity& operator*=(const double scalar);
+  template <typename Expression>
+  Velocity& operator+=(
+      const VectorExpression<Velocity, Expression>& expression) {
+    MORPH_HOT_REQUIRE(size_ == expression.get_size(), std::invalid_argument,
+                      "Velocities are not of the same size. The += operator "
+                      "requires them to be of the same size.");
+    data_ += expression.get_expression();
+    return *this;
+  }
+  template <typename Expression>
+  Velocity& operator-=(
+      const VectorExpression<Velocity, Expression>& expression) {
+    MORPH_HOT_REQUIRE(size_ == expression.get_size(), std::invalid_argument,
+                      "Velocities are not of the same size. The -= operator "
+                      "requires them to be of the same size.");
+    data_ -= expression.get_expression();
+    return *this;
+  }
 
   friend bool operator==(const Velocity& velocity1, const Velocity& velocity2);
   friend bool operator!=(const Velocity& velocity1, const Velocity& velocity2);
@@ -41,10 +81,20 @@ class Velocity {
 
   int get_size() const;
   const Eigen::VectorXd& get_data() const;
+  // Mutable reference to the data, for in place computations. The data must
+  // not be resized.
+  Eigen::VectorXd& get_data_ref();
   void set_data(const Eigen::VectorXd& data);
   void set_data(std::initializer_list<double> elements);
 
   bool IsEmpty() const;
+  // Expression that refers to the data of the velocity (See
+  // construct_expression.h). Unlike get_data, this is also valid when the
+  // velocity is empty.
+  ConstructExpression<Velocity> ToExpression() const {
+    return ConstructExpression<Velocity>(
+        Eigen::Map<const Eigen::VectorXd>(data_.data(), size_));
+  }
   static Velocity CreateLike(const morphac::constructs::Velocity& velocity);
 
  private:
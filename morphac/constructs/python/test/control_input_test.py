@@ -61,6 +61,33 @@ def test_data(generate_control_input_list):
         ci2.data = [1, 1]
 
 
+def test_data_view():
+
+    # The data is a view of the control input storage and not a copy.
+    ci = ControlInput([1, 2, 3])
+    data = ci.data
+    assert not data.flags.owndata
+    assert np.shares_memory(data, ci.data)
+
+    # The view is read only.
+    assert not data.flags.writeable
+    with pytest.raises(ValueError):
+        data[1] = 5
+
+    # Writing to the mutable view updates the control input.
+    data_ref = ci.get_data_ref()
+    assert data_ref.flags.writeable
+    assert np.shares_memory(data_ref, data)
+    data_ref[1] = 5
+    assert ci[1] == 5
+    ci.get_data_ref()[2] = -1
+    assert np.allclose(ci.data, [1, 5, -1])
+
+    # And updating the control input is reflected in the view.
+    ci[0] = 7
+    assert data[0] == 7
+
+
 def test_getitem(generate_control_input_list):
 
     ci1, ci2, ci3, ci4 = generate_control_input_list
@@ -61,6 +61,33 @@ def test_data(generate_pose_list):
         p2.data = [1, 1]
 
 
+def test_data_view():
+
+    # The data is a view of the pose storage and not a copy.
+    p = Pose([1, 2, 3])
+    data = p.data
+    assert not data.flags.owndata
+    assert np.shares_memory(data, p.data)
+
+    # The view is read only.
+    assert not data.flags.writeable
+    with pytest.raises(ValueError):
+        data[1] = 5
+
+    # Writing to the mutable view updates the pose.
+    data_ref = p.get_data_ref()
+    assert data_ref.flags.writeable
+    assert np.shares_memory(data_ref, data)
+    data_ref[1] = 5
+    assert p[1] == 5
+    p.get_data_ref()[2] = -1
+    assert np.allclose(p.data, [1, 5, -1])
+
+    # And updating the pose is reflected in the view.
+    p[0] = 7
+    assert data[0] == 7
+
+
 def test_getitem(generate_pose_list):
 
     p1, p2, p3, p4 = generate_pose_list
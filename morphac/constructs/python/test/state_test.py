@@ -247,6 +247,23 @@ def test_data(generate_state_list):
         sp2.data = [1, 1]
 
 
+def test_data_view():
+
+    # The pose and velocity data are views of the state storage.
+    s = State([1, 2], [3, 4])
+    assert not s.pose.data.flags.writeable
+    assert not s.velocity.data.flags.writeable
+    s.pose.get_data_ref()[0] = 5
+    s.velocity.get_data_ref()[1] = -1
+    assert np.allclose(s.data, [5, 2, 3, -1])
+
+    # The state data itself is a copy, as the pose and velocity are stored
+    # separately.
+    data = s.data
+    data[0] = 0
+    assert s[0] == 5
+
+
 def test_getitem(generate_state_list):
 
     sf1, sf2, sf3, sf4, sf5, sp1, sp2 = generate_state_list
@@ -1,7 +1,7 @@
 import numpy as np
 import pytest
 
-from morphac.constructs import State, Trajectory
+from morphac.constructs import InterpolationType, State, Trajectory
 from morphac.utils.pytest_utils import set_standard_testing_random_seed
 
 
@@ -134,6 +134,35 @@ def test_data(generate_trajectory_list):
         t3.data = np.zeros([100, 4])
 
 
+def test_data_copy(generate_trajectory_list):
+
+    _, t2, t3 = generate_trajectory_list
+
+    # The data is a copy, so it stays valid (And unchanged) when the knot
+    # points change or the trajectory storage is reallocated.
+    data = t3.data
+    t3[0] = State([1, 2, 3], [4, 5])
+    for _ in range(100):
+        t3.add_knot_point(State([0, 0, 0], [0, 0]))
+
+    assert not np.allclose(data[0], [1, 2, 3, 4, 5])
+    assert np.allclose(t3.data[0], [1, 2, 3, 4, 5])
+
+    # Writing to the copy doesn't change the trajectory.
+    data[0, 0] = 7
+    assert t3[0][0] == 1
+
+    # The capacity is at least the size.
+    assert t2.capacity >= t2.size
+    for _ in range(10):
+        t2.add_knot_point(State([1, 1], [1]))
+    assert t2.capacity >= t2.size == 13
+
+    # Making sure that the capacity is read only.
+    with pytest.raises(AttributeError):
+        t2.capacity = 20
+
+
 def test_getitem(generate_trajectory_list):
 
     t1, t2, t3 = generate_trajectory_list
@@ -178,9 +207,7 @@ def test_setitem(generate_trajectory_list):
     with pytest.raises(IndexError):
         t3[100] = State(3, 2)
 
-    # Note that this check for invalid state setting is only applicable for
-    # the python binding. In cpp, this is done through the [] operator that
-    # returns a reference and thus no state validation can take place.
+    # The state must be compatible with the trajectory.
     with pytest.raises(ValueError):
         t1[0] = State(0, 0)
     with pytest.raises(ValueError):
@@ -346,6 +373,50 @@ def test_invalid_add_knot_points_due_to_indices(generate_trajectory_list):
     with pytest.raises(IndexError):
         t3.add_knot_points([State(3, 2), State(3, 2), State(3, 2)], [0, 50, 103])
 
+    # Indices must be unique.
+    with pytest.raises(ValueError):
+        t2.add_knot_points([State(2, 1), State(2, 1)], [1, 1])
+
+
+def test_append_knot_points(generate_trajectory_list):
+
+    t1, t2, t3 = generate_trajectory_list
+
+    t1.append_knot_points([State([1, 1], [1, 1]), State([2, 2], [2, 2])])
+    t2.append_knot_points(data=np.ones([2, 3]))
+
+    set_standard_testing_random_seed()
+    data3 = np.random.randn(100, 5)
+    t3.append_knot_points(knot_points=[])
+
+    assert np.allclose(t1.data, [[0, 0, 0, 0], [1, 1, 1, 1], [2, 2, 2, 2]])
+    assert np.allclose(
+        t2.data, [[1, 1, 1], [2, 2, 2], [3, 3, 3], [1, 1, 1], [1, 1, 1]]
+    )
+    assert np.allclose(t3.data, data3)
+
+    # Invalid knot points.
+    with pytest.raises(ValueError):
+        t1.append_knot_points([State(2, 1)])
+    with pytest.raises(ValueError):
+        t2.append_knot_points(np.ones([2, 4]))
+
+
+def test_reserve(generate_trajectory_list):
+
+    _, t2, _ = generate_trajectory_list
+
+    t2.reserve(100)
+    assert t2.capacity == 100
+    assert t2.size == 3
+
+    t2.shrink_to_fit()
+    assert t2.capacity == 3
+    assert np.allclose(t2.data, [[1, 1, 1], [2, 2, 2], [3, 3, 3]])
+
+    with pytest.raises(ValueError):
+        t2.reserve(-1)
+
 
 def test_remove_knot_point(generate_trajectory_list):
 
@@ -403,3 +474,151 @@ def test_invalid_remove_knot_points(generate_trajectory_list):
         t2.remove_knot_points([-1, 2])
     with pytest.raises(IndexError):
         t3.remove_knot_points([0, 100])
+
+    # Indices must be unique.
+    with pytest.raises(ValueError):
+        t2.remove_knot_points([1, 1])
+
+
+def test_timestamps(generate_trajectory_list):
+
+    _, t2, _ = generate_trajectory_list
+
+    assert not t2.has_timestamps()
+    assert t2.timestamps == []
+
+    t2.timestamps = [0.0, 0.5, 2.0]
+    assert t2.has_timestamps()
+    assert np.allclose(t2.timestamps, [0.0, 0.5, 2.0])
+
+    t2.append_knot_points([State([4, 4], [4])], [3.0])
+    t2.append_knot_points(data=np.zeros([2, 3]), timestamps=[4.0, 5.0])
+    assert t2.size == 6
+    assert np.allclose(t2.timestamps, [0.0, 0.5, 2.0, 3.0, 4.0, 5.0])
+
+    t2.remove_knot_points([0, 5])
+    assert np.allclose(t2.timestamps, [0.5, 2.0, 3.0, 4.0])
+
+    t2.clear_timestamps()
+    assert not t2.has_timestamps()
+
+
+def test_invalid_timestamps(generate_trajectory_list):
+
+    _, t2, _ = generate_trajectory_list
+
+    with pytest.raises(ValueError):
+        t2.timestamps = [0.0, 1.0]
+    with pytest.raises(ValueError):
+        t2.timestamps = [0.0, 1.0, 1.0]
+    with pytest.raises(RuntimeError):
+        t2.append_knot_points([State([4, 4], [4])], [3.0])
+
+    t2.timestamps = [0.0, 1.0, 2.0]
+    with pytest.raises(RuntimeError):
+        t2.add_knot_point(State([4, 4], [4]))
+    with pytest.raises(ValueError):
+        t2.append_knot_points([State([4, 4], [4])], [2.0])
+
+
+def test_sample(generate_trajectory_list):
+
+    _, t2, _ = generate_trajectory_list
+
+    t2.timestamps = [0.0, 0.5, 2.0]
+
+    assert t2.sample(0.0) == State([1, 1], [1])
+    assert t2.sample(0.25) == State([1.5, 1.5], [1.5])
+    assert t2.sample(time=1.25, interpolation_type=InterpolationType.LINEAR) == State(
+        [2.5, 2.5], [2.5]
+    )
+    # The knot points lie on a line, but the timestamps aren't uniform, so the
+    # hermite samples only coincide at the knot points.
+    assert t2.sample(0.5, InterpolationType.HERMITE) == State([2, 2], [2])
+
+    # Clamped outside the trajectory.
+    assert t2.sample(-1.0) == State([1, 1], [1])
+    assert t2.sample(3.0) == State([3, 3], [3])
+
+    samples = t2.sample_batch([0.0, 0.25, 1.25, 3.0])
+    assert np.allclose(
+        samples, [[1, 1, 1], [1.5, 1.5, 1.5], [2.5, 2.5, 2.5], [3, 3, 3]]
+    )
+
+
+def test_angle_sample():
+
+    t = Trajectory(
+        knot_points=[
+            State([0, 0, np.pi - 0.2], []),
+            State([1, 0, -np.pi + 0.2], []),
+        ]
+    )
+    t.timestamps = [0.0, 1.0]
+    t.angle_indices = [2]
+
+    assert t.angle_indices == [2]
+    assert np.isclose(t.sample(0.25)[2], np.pi - 0.1)
+    assert np.isclose(t.sample(0.75)[2], -np.pi + 0.1)
+
+    with pytest.raises(IndexError):
+        t.angle_indices = [3]
+
+
+def test_invalid_sample(generate_trajectory_list):
+
+    t1, _, _ = generate_trajectory_list
+
+    with pytest.raises(RuntimeError):
+        t1.sample(0.0)
+    with pytest.raises(RuntimeError):
+        t1.sample_batch([0.0])
+
+
+def test_arc_lengths():
+
+    t = Trajectory(
+        data=np.array([[0, 0, 0], [1, 0, 2], [1, 1, 4]]), pose_size=2, velocity_size=1
+    )
+
+    assert np.allclose(t.arc_lengths, [0, 1, 2])
+    assert np.isclose(t.path_length, 2)
+    assert t.sample_at_arc_length(0.5) == State([0.5, 0], [1])
+    assert t.sample_at_arc_length(arc_length=1.5) == State([1, 0.5], [3])
+
+    # The arc lengths are updated with the knot points.
+    t[2] = State([1, 2], [4])
+    assert np.isclose(t.path_length, 3)
+
+
+def test_find_nearest_path_point():
+
+    t = Trajectory(
+        data=np.array([[0, 0], [2, 2], [2, 0], [0, 2]]), pose_size=2, velocity_size=0
+    )
+
+    path_point = t.find_nearest_path_point([1.8, 0.5])
+    assert path_point.segment == 1
+    assert np.isclose(path_point.fraction, 0.75)
+    assert np.isclose(path_point.distance, 0.2)
+    assert np.allclose(path_point.position, [2, 0.5])
+    assert np.isclose(path_point.arc_length, 2 * np.sqrt(2) + 1.5)
+
+    # The windowed search stays around the given segment.
+    assert t.find_nearest_path_point(np.array([1.1, 0.9])).segment == 2
+    assert t.find_nearest_path_point([1.1, 0.9], segment=0, window=1).segment == 0
+
+    with pytest.raises(IndexError):
+        t.find_nearest_path_point([0, 0], 3, 1)
+    with pytest.raises(ValueError):
+        t.find_nearest_path_point([0, 0], 0, -1)
+
+
+def test_invalid_path_queries():
+
+    t = Trajectory(data=np.ones([3, 2]), pose_size=1, velocity_size=1)
+
+    with pytest.raises(RuntimeError):
+        t.path_length
+    with pytest.raises(RuntimeError):
+        t.find_nearest_path_point([0, 0])
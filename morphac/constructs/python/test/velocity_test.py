@@ -61,6 +61,33 @@ def test_data(generate_velocity_list):
         v2.data = [1, 1]
 
 
+def test_data_view():
+
+    # The data is a view of the velocity storage and not a copy.
+    v = Velocity([1, 2, 3])
+    data = v.data
+    assert not data.flags.owndata
+    assert np.shares_memory(data, v.data)
+
+    # The view is read only.
+    assert not data.flags.writeable
+    with pytest.raises(ValueError):
+        data[1] = 5
+
+    # Writing to the mutable view updates the velocity.
+    data_ref = v.get_data_ref()
+    assert data_ref.flags.writeable
+    assert np.shares_memory(data_ref, data)
+    data_ref[1] = 5
+    assert v[1] == 5
+    v.get_data_ref()[2] = -1
+    assert np.allclose(v.data, [1, 5, -1])
+
+    # And updating the velocity is reflected in the view.
+    v[0] = 7
+    assert data[0] == 7
+
+
 def test_getitem(generate_velocity_list):
 
     v1, v2, v3, v4 = generate_velocity_list
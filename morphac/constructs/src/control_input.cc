@@ -32,8 +32,25 @@ ControlInput::ControlInput(initializer_list<double> control_input_elements)
   data_ = Map<VectorXd>(&data_vector[0], size_);
 }
 
+ControlInput::ControlInput(ControlInput&& control_input) noexcept
+    : size_(control_input.size_), data_(std::move(control_input.data_)) {
+  control_input.size_ = 0;
+}
+
+ControlInput& ControlInput::operator=(ControlInput&& control_input) noexcept {
+  if (this != &control_input) {
+    size_ = control_input.size_;
+    data_ = std::move(control_input.data_);
+    // Eigen swaps the buffers on move assignment, so the moved from data has
+    // to be released explicitly.
+    control_input.size_ = 0;
+    control_input.data_.resize(0);
+  }
+  return *this;
+}
+
 ControlInput& ControlInput::operator+=(const ControlInput& control_input) {
-  MORPH_REQUIRE(
+  MORPH_HOT_REQUIRE(
       this->size_ == control_input.size_, std::invalid_argument,
       "Control inputs are not of the same size. The += operator requires them "
       "to be of the same size.");
@@ -49,7 +66,7 @@ ControlInput ControlInput::operator+(const ControlInput& control_input) const {
 }
 
 ControlInput& ControlInput::operator-=(const ControlInput& control_input) {
-  MORPH_REQUIRE(
+  MORPH_HOT_REQUIRE(
       this->size_ == control_input.size_, std::invalid_argument,
       "Control inputs are not of the same size. The -= operator requires them "
       "to be of the same size.");
@@ -97,16 +114,18 @@ bool operator!=(const ControlInput& control_input1,
 }
 
 double& ControlInput::operator[](const int index) {
-  MORPH_REQUIRE(index >= 0 && index < size_, std::out_of_range,
-                "ControlInput index out of bounds.");
-  MORPH_REQUIRE(!IsEmpty(), std::logic_error, "ControlInput object is empty");
+  MORPH_HOT_REQUIRE(index >= 0 && index < size_, std::out_of_range,
+                    "ControlInput index out of bounds.");
+  MORPH_HOT_REQUIRE(!IsEmpty(), std::logic_error,
+                    "ControlInput object is empty");
   return data_(index);
 }
 
 const double& ControlInput::operator[](const int index) const {
-  MORPH_REQUIRE(index >= 0 && index < size_, std::out_of_range,
-                "ControlInput index out of bounds.");
-  MORPH_REQUIRE(!IsEmpty(), std::logic_error, "ControlInput object is empty");
+  MORPH_HOT_REQUIRE(index >= 0 && index < size_, std::out_of_range,
+                    "ControlInput index out of bounds.");
+  MORPH_HOT_REQUIRE(!IsEmpty(), std::logic_error,
+                    "ControlInput object is empty");
   return data_(index);
 }
 
@@ -126,7 +145,14 @@ bool ControlInput::IsEmpty() const { return size_ == 0; }
 int ControlInput::get_size() const { return size_; }
 
 const VectorXd& ControlInput::get_data() const {
-  MORPH_REQUIRE(!IsEmpty(), std::logic_error, "ControlInput object is empty");
+  MORPH_HOT_REQUIRE(!IsEmpty(), std::logic_error,
+                    "ControlInput object is empty");
+  return data_;
+}
+
+VectorXd& ControlInput::get_data_ref() {
+  MORPH_HOT_REQUIRE(!IsEmpty(), std::logic_error,
+                    "ControlInput object is empty");
   return data_;
 }
 
@@ -53,8 +53,8 @@ Coordinate operator*(const double scalar, Coordinate coord) {
 }
 
 double& Coordinate::operator[](const int index) {
-  MORPH_REQUIRE(index >= 0 && index < 2, std::out_of_range,
-                "Coordinate index out of bounds.");
+  MORPH_HOT_REQUIRE(index >= 0 && index < 2, std::out_of_range,
+                    "Coordinate index out of bounds.");
   if (index == 0) {
     return this->x_;
   } else {
@@ -63,8 +63,8 @@ double& Coordinate::operator[](const int index) {
 }
 
 const double& Coordinate::operator[](const int index) const {
-  MORPH_REQUIRE(index >= 0 && index < 2, std::out_of_range,
-                "Coordinate index out of bounds.");
+  MORPH_HOT_REQUIRE(index >= 0 && index < 2, std::out_of_range,
+                    "Coordinate index out of bounds.");
   if (index == 0) {
     return this->x_;
   } else {
@@ -29,11 +29,27 @@ Pose::Pose(initializer_list<double> elements) : size_(elements.size()) {
   data_ = Map<VectorXd>(&data_vector[0], size_);
 }
 
+Pose::Pose(Pose&& pose) noexcept
+    : size_(pose.size_), data_(std::move(pose.data_)) {
+  pose.size_ = 0;
+}
+
+Pose& Pose::operator=(Pose&& pose) noexcept {
+  if (this != &pose) {
+    size_ = pose.size_;
+    data_ = std::move(pose.data_);
+    // Eigen swaps the buffers on move assignment, so the moved from data has
+    // to be released explicitly.
+    pose.size_ = 0;
+    pose.data_.resize(0);
+  }
+  return *this;
+}
+
 Pose& Pose::operator+=(const Pose& pose) {
-  MORPH_REQUIRE(this->size_ == pose.size_, std::invalid_argument,
-                "Poses are not of the same size. The += operator requires them "
-                "to be of the "
-                "same size.");
+  MORPH_HOT_REQUIRE(this->size_ == pose.size_, std::invalid_argument,
+                    "Poses are not of the same size. The += operator "
+                    "requires them to be of the same size.");
   this->data_ += pose.data_;
   return *this;
 }
@@ -46,10 +62,9 @@ Pose Pose::operator+(const Pose& pose) const {
 }
 
 Pose& Pose::operator-=(const Pose& pose) {
-  MORPH_REQUIRE(this->size_ == pose.size_, std::invalid_argument,
-                "Poses are not of the same size. The -= operator requires them "
-                "to be of the "
-                "same size.");
+  MORPH_HOT_REQUIRE(this->size_ == pose.size_, std::invalid_argument,
+                    "Poses are not of the same size. The -= operator "
+                    "requires them to be of the same size.");
   this->data_ -= pose.data_;
   return *this;
 }
@@ -87,16 +102,16 @@ bool operator!=(const Pose& pose1, const Pose& pose2) {
 }
 
 double& Pose::operator[](const int index) {
-  MORPH_REQUIRE(index >= 0 && index < size_, std::out_of_range,
-                "Pose index out of bounds.");
-  MORPH_REQUIRE(!IsEmpty(), std::logic_error, "Pose object is empty");
+  MORPH_HOT_REQUIRE(index >= 0 && index < size_, std::out_of_range,
+                    "Pose index out of bounds.");
+  MORPH_HOT_REQUIRE(!IsEmpty(), std::logic_error, "Pose object is empty");
   return data_(index);
 }
 
 const double& Pose::operator[](const int index) const {
-  MORPH_REQUIRE(index >= 0 && index < size_, std::out_of_range,
-                "Pose index out of bounds.");
-  MORPH_REQUIRE(!IsEmpty(), std::logic_error, "Pose object is empty");
+  MORPH_HOT_REQUIRE(index >= 0 && index < size_, std::out_of_range,
+                    "Pose index out of bounds.");
+  MORPH_HOT_REQUIRE(!IsEmpty(), std::logic_error, "Pose object is empty");
   return data_(index);
 }
 
@@ -116,7 +131,12 @@ bool Pose::IsEmpty() const { return size_ == 0; }
 int Pose::get_size() const { return size_; }
 
 const VectorXd& Pose::get_data() const {
-  MORPH_REQUIRE(!IsEmpty(), std::logic_error, "Pose object is empty");
+  MORPH_HOT_REQUIRE(!IsEmpty(), std::logic_error, "Pose object is empty");
+  return data_;
+}
+
+VectorXd& Pose::get_data_ref() {
+  MORPH_HOT_REQUIRE(!IsEmpty(), std::logic_error, "Pose object is empty");
   return data_;
 }
 
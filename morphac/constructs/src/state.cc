@@ -45,23 +45,16 @@ State::State(const Pose& pose, const Velocity& velocity)
     : pose_(pose), velocity_(velocity) {}
 
 State& State::operator+=(const State& state) {
-  MORPH_REQUIRE(
+  MORPH_HOT_REQUIRE(
       this->get_pose_size() == state.get_pose_size() &&
           this->get_velocity_size() == state.get_velocity_size(),
       std::invalid_argument,
       "States are not of the same size. The += operator requires them "
       "to be of the "
       "same size.");
-  // The pose and velocities are added and set if they are non empty. If they
-  // are empty, the default empty objects are kept as is and the resulting
-  // pose/velocity is also empty.
-  if (!IsPoseEmpty()) {
-    this->set_pose_data(this->get_pose_data() + state.get_pose_data());
-  }
-  if (!IsVelocityEmpty()) {
-    this->set_velocity_data(this->get_velocity_data() +
-                            state.get_velocity_data());
-  }
+  // Empty poses/velocities are of the same size, so they remain empty.
+  pose_ += state.pose_;
+  velocity_ += state.velocity_;
   return *this;
 }
 
@@ -73,47 +66,33 @@ State State::operator+(const State& state) const {
 }
 
 State& State::operator-=(const State& state) {
-  MORPH_REQUIRE(
+  MORPH_HOT_REQUIRE(
       this->get_pose_size() == state.get_pose_size() &&
           this->get_velocity_size() == state.get_velocity_size(),
       std::invalid_argument,
       "States are not of the same size. The -= operator requires them "
       "to be of the "
       "same size.");
-  // The pose and velocities are subtracted and set if they are non empty. If
-  // they are empty, the default empty objects are kept as is and the resulting
-  // pose/velocity is also empty.
-  if (!IsPoseEmpty()) {
-    this->set_pose_data(this->get_pose_data() - state.get_pose_data());
-  }
-  if (!IsVelocityEmpty()) {
-    this->set_velocity_data(this->get_velocity_data() -
-                            state.get_velocity_data());
-  }
+  // Empty poses/velocities are of the same size, so they remain empty.
+  pose_ -= state.pose_;
+  velocity_ -= state.velocity_;
   return *this;
 }
 
 State State::operator-(const State& state) const {
-  // Argument validation happens in the += function call.
+  // Argument validation happens in the -= function call.
   State result(*this);
   result -= state;
   return result;
 }
 
 State& State::operator*=(const double scalar) {
-  // The pose and velocities are multiplied and set if they are non empty. If
-  // they are empty, the default empty objects are kept as is and the resulting
-  // pose/velocity is also empty.
-  if (!IsPoseEmpty()) {
-    this->set_pose_data(this->get_pose_data() * scalar);
-  }
-  if (!IsVelocityEmpty()) {
-    this->set_velocity_data(this->get_velocity_data() * scalar);
-  }
+  pose_ *= scalar;
+  velocity_ *= scalar;
   return *this;
 }
 
-//// Non-member multiplication functions
+// Non-member multiplication functions
 State operator*(State state, const double scalar) { return state *= scalar; }
 
 State operator*(const double scalar, State state) { return state *= scalar; }
@@ -133,9 +112,9 @@ bool operator!=(const State& state1, const State& state2) {
 }
 
 double& State::operator[](const int index) {
-  MORPH_REQUIRE(index >= 0 && index < get_size(), std::out_of_range,
-                "State index out of bounds.");
-  MORPH_REQUIRE(!IsEmpty(), std::logic_error, "State object is empty.");
+  MORPH_HOT_REQUIRE(index >= 0 && index < get_size(), std::out_of_range,
+                    "State index out of bounds.");
+  MORPH_HOT_REQUIRE(!IsEmpty(), std::logic_error, "State object is empty.");
   // If the index corresponds to the pose
   if (index < get_pose_size()) {
     return pose_[index];
@@ -146,9 +125,9 @@ double& State::operator[](const int index) {
 }
 
 const double& State::operator[](const int index) const {
-  MORPH_REQUIRE(index >= 0 && index < get_size(), std::out_of_range,
-                "State index out of bounds.");
-  MORPH_REQUIRE(!IsEmpty(), std::logic_error, "State object is empty.");
+  MORPH_HOT_REQUIRE(index >= 0 && index < get_size(), std::out_of_range,
+                    "State index out of bounds.");
+  MORPH_HOT_REQUIRE(!IsEmpty(), std::logic_error, "State object is empty.");
   // If the index corresponds to the pose
   if (index < get_pose_size()) {
     return pose_[index];
@@ -208,43 +187,58 @@ int State::get_size() const { return pose_.get_size() + velocity_.get_size(); }
 
 Pose& State::get_pose() {
   // We return only if the pose is non empty.
-  MORPH_REQUIRE(!pose_.IsEmpty(), std::logic_error, "Pose component is empty.");
+  MORPH_HOT_REQUIRE(!pose_.IsEmpty(), std::logic_error,
+                    "Pose component is empty.");
   return pose_;
 }
 
 const Pose& State::get_pose() const {
   // We return only if the pose is non empty.
-  MORPH_REQUIRE(!pose_.IsEmpty(), std::logic_error, "Pose component is empty.");
+  MORPH_HOT_REQUIRE(!pose_.IsEmpty(), std::logic_error,
+                    "Pose component is empty.");
   return pose_;
 }
 
 Velocity& State::get_velocity() {
   // We return only if the velocity is non empty.
-  MORPH_REQUIRE(!velocity_.IsEmpty(), std::logic_error,
-                "Velocity component is empty.");
+  MORPH_HOT_REQUIRE(!velocity_.IsEmpty(), std::logic_error,
+                    "Velocity component is empty.");
   return velocity_;
 }
 
 const Velocity& State::get_velocity() const {
   // We return only if the velocity is non empty.
-  MORPH_REQUIRE(!velocity_.IsEmpty(), std::logic_error,
-                "Velocity component is empty.");
+  MORPH_HOT_REQUIRE(!velocity_.IsEmpty(), std::logic_error,
+                    "Velocity component is empty.");
   return velocity_;
 }
 
 const VectorXd& State::get_pose_data() const {
   // We return the pose data only if the pose is non empty.
-  MORPH_REQUIRE(!pose_.IsEmpty(), std::logic_error, "Pose component is empty.");
+  MORPH_HOT_REQUIRE(!pose_.IsEmpty(), std::logic_error,
+                    "Pose component is empty.");
   return pose_.get_data();
 }
 
 const VectorXd& State::get_velocity_data() const {
   // We return the velocity data only if the velocity is non empty.
-  MORPH_REQUIRE(!velocity_.IsEmpty(), std::logic_error,
-                "Velocity component is empty.");
+  MORPH_HOT_REQUIRE(!velocity_.IsEmpty(), std::logic_error,
+                    "Velocity component is empty.");
   return velocity_.get_data();
 }
 
+VectorXd& State::get_pose_data_ref() {
+  MORPH_HOT_REQUIRE(!pose_.IsEmpty(), std::logic_error,
+                    "Pose component is empty.");
+  return pose_.get_data_ref();
+}
+
+VectorXd& State::get_velocity_data_ref() {
+  MORPH_HOT_REQUIRE(!velocity_.IsEmpty(), std::logic_error,
+                    "Velocity component is empty.");
+  return velocity_.get_data_ref();
+}
+
 void State::set_pose(const Pose& pose) {
   MORPH_REQUIRE(pose_.get_size() == pose.get_size(), std::invalid_argument,
                 "Pose dimensions do not match.");
@@ -261,7 +255,7 @@ void State::set_velocity(const Velocity& velocity) {
 }
 
 const VectorXd State::get_data() const {
-  MORPH_REQUIRE(!IsEmpty(), std::logic_error, "State is empty.");
+  MORPH_HOT_REQUIRE(!IsEmpty(), std::logic_error, "State is empty.");
   VectorXd data(get_size());
   VectorXd pose_data = VectorXd::Zero(0);
   VectorXd velocity_data = VectorXd::Zero(0);
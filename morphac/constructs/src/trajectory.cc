@@ -3,32 +3,43 @@
 namespace morphac {
 namespace constructs {
 
+using std::adjacent_find;
+using std::atomic_compare_exchange_strong;
+using std::atomic_load;
+using std::copy;
+using std::copy_backward;
+using std::floor;
 using std::greater;
+using std::greater_equal;
+using std::logic_error;
+using std::make_shared;
+using std::max;
+using std::min;
+using std::numeric_limits;
 using std::ostream;
 using std::ostringstream;
+using std::shared_ptr;
 using std::sort;
+using std::sqrt;
 using std::string;
+using std::upper_bound;
 using std::vector;
 
 using Eigen::MatrixXd;
 
-using morphac::constructs::State;
+using morphac::common::aliases::Point;
 
-void Trajectory::copy_data_to_knot_points(const MatrixXd& data) {
-  // First we clear all of the existing points.
-  knot_points_.clear();
-  for (unsigned int i = 0; i < data.rows(); ++i) {
-    knot_points_.push_back(
-        State(data.row(i).head(pose_size_), data.row(i).tail(velocity_size_)));
-  }
-}
+using morphac::constructs::State;
+using morphac::utils::NormalizeAngle;
 
 Trajectory::Trajectory(const State& knot_point)
     : pose_size_(knot_point.get_pose_size()),
-      velocity_size_(knot_point.get_velocity_size()) {
+      velocity_size_(knot_point.get_velocity_size()),
+      size_(1) {
   MORPH_REQUIRE(!knot_point.IsEmpty(), std::invalid_argument,
                 "State must not be empty.");
-  knot_points_.push_back(knot_point);
+  data_.resize(1, get_dim());
+  CopyKnotPoint(knot_point, 0);
 }
 
 Trajectory::Trajectory(const vector<State>& knot_points) {
@@ -46,19 +57,76 @@ Trajectory::Trajectory(const vector<State>& knot_points) {
   }
   pose_size_ = knot_points.at(0).get_pose_size();
   velocity_size_ = knot_points.at(0).get_velocity_size();
-  knot_points_ = knot_points;
+  size_ = knot_points.size();
+  data_.resize(size_, get_dim());
+  for (int i = 0; i < size_; ++i) {
+    CopyKnotPoint(knot_points.at(i), i);
+  }
 }
 
 Trajectory::Trajectory(const MatrixXd& data, const int pose_size,
                        const int velocity_size)
-    : pose_size_(pose_size), velocity_size_(velocity_size) {
+    : pose_size_(pose_size), velocity_size_(velocity_size), size_(data.rows()) {
   // Data matrix must be valid.
   MORPH_REQUIRE(data.rows() > 0 && data.cols() > 0, std::invalid_argument,
                 "Trajectory data must not have zero rows or columns.");
   // pose_size + velocity_dim must equal dim.
   MORPH_REQUIRE(data.cols() == pose_size + velocity_size, std::invalid_argument,
                 "Trajectory data and pose/velocity sizes are incompatible.");
-  copy_data_to_knot_points(data);
+  data_ = data;
+}
+
+Trajectory::Trajectory(const Trajectory& trajectory)
+    : pose_size_(trajectory.pose_size_),
+      velocity_size_(trajectory.velocity_size_),
+      size_(trajectory.size_),
+      data_(trajectory.data_),
+      timestamps_(trajectory.timestamps_),
+      angle_indices_(trajectory.angle_indices_),
+      is_angle_(trajectory.is_angle_),
+      path_index_(atomic_load(&trajectory.path_index_)) {}
+
+Trajectory& Trajectory::operator=(const Trajectory& trajectory) {
+  if (this != &trajectory) {
+    pose_size_ = trajectory.pose_size_;
+    velocity_size_ = trajectory.velocity_size_;
+    size_ = trajectory.size_;
+    data_ = trajectory.data_;
+    timestamps_ = trajectory.timestamps_;
+    angle_indices_ = trajectory.angle_indices_;
+    is_angle_ = trajectory.is_angle_;
+    // The trajectory may be queried concurrently, which builds its path
+    // index.
+    path_index_ = atomic_load(&trajectory.path_index_);
+  }
+  return *this;
+}
+
+Trajectory::Trajectory(Trajectory&& trajectory) noexcept
+    : pose_size_(trajectory.pose_size_),
+      velocity_size_(trajectory.velocity_size_),
+      size_(trajectory.size_),
+      data_(std::move(trajectory.data_)),
+      timestamps_(std::move(trajectory.timestamps_)),
+      angle_indices_(std::move(trajectory.angle_indices_)),
+      is_angle_(std::move(trajectory.is_angle_)),
+      path_index_(std::move(trajectory.path_index_)) {
+  trajectory.ReleaseKnotPoints();
+}
+
+Trajectory& Trajectory::operator=(Trajectory&& trajectory) noexcept {
+  if (this != &trajectory) {
+    pose_size_ = trajectory.pose_size_;
+    velocity_size_ = trajectory.velocity_size_;
+    size_ = trajectory.size_;
+    data_ = std::move(trajectory.data_);
+    timestamps_ = std::move(trajectory.timestamps_);
+    angle_indices_ = std::move(trajectory.angle_indices_);
+    is_angle_ = std::move(trajectory.is_angle_);
+    path_index_ = std::move(trajectory.path_index_);
+    trajectory.ReleaseKnotPoints();
+  }
+  return *this;
 }
 
 Trajectory& Trajectory::operator+=(const Trajectory& trajectory) {
@@ -74,9 +142,19 @@ Trajectory& Trajectory::operator+=(const Trajectory& trajectory) {
                 std::invalid_argument,
                 "Trajectories do not have the same velocity size. The += "
                 "operator requires them to have the same velocity sizes.");
-  this->knot_points_.insert(this->knot_points_.end(),
-                            trajectory.knot_points_.begin(),
-                            trajectory.knot_points_.end());
+  // Timed trajectories can only be extended by timed trajectories that come
+  // after them.
+  if (trajectory.HasTimestamps()) {
+    RequireAppendable(trajectory.timestamps_);
+  } else if (trajectory.size_ > 0) {
+    RequireUntimed();
+  }
+  InvalidatePathIndex();
+  EnsureCapacity(size_ + trajectory.size_);
+  data_.middleRows(size_, trajectory.size_) = trajectory.get_data();
+  size_ += trajectory.size_;
+  timestamps_.insert(timestamps_.end(), trajectory.timestamps_.begin(),
+                     trajectory.timestamps_.end());
   return *this;
 }
 
@@ -94,8 +172,25 @@ bool operator==(const Trajectory& trajectory1, const Trajectory& trajectory2) {
       (trajectory1.pose_size_ != trajectory2.pose_size_)) {
     return false;
   }
+  // Knot points are compared like States, with the pose and velocity
+  // components compared separately.
+  const int pose_size = trajectory1.pose_size_;
+  const int velocity_size = trajectory1.velocity_size_;
   for (int i = 0; i < trajectory1.get_size(); ++i) {
-    if (trajectory1.knot_points_.at(i) != trajectory2.knot_points_.at(i)) {
+    if (!trajectory1[i].head(pose_size).isApprox(
+            trajectory2[i].head(pose_size), 1e-6) ||
+        !trajectory1[i].tail(velocity_size).isApprox(
+            trajectory2[i].tail(velocity_size), 1e-6)) {
+      return false;
+    }
+  }
+  // Either both trajectories are untimed or their timestamps are equal.
+  if (trajectory1.timestamps_.size() != trajectory2.timestamps_.size()) {
+    return false;
+  }
+  for (unsigned int i = 0; i < trajectory1.timestamps_.size(); ++i) {
+    if (std::abs(trajectory1.timestamps_.at(i) -
+                 trajectory2.timestamps_.at(i)) > 1e-6) {
       return false;
     }
   }
@@ -107,23 +202,17 @@ bool operator!=(const Trajectory& trajectory1, const Trajectory& trajectory2) {
   return !(trajectory1 == trajectory2);
 }
 
-State& Trajectory::operator[](const int index) {
-  MORPH_REQUIRE(index >= 0 && index < this->get_size(), std::out_of_range,
-                "Trajectory index out of range.");
-  return knot_points_.at(index);
-}
-
-const State& Trajectory::operator[](const int index) const {
+Trajectory::ConstKnotPointView Trajectory::operator[](const int index) const {
   MORPH_REQUIRE(index >= 0 && index < this->get_size(), std::out_of_range,
                 "Trajectory index out of range.");
-  return knot_points_.at(index);
+  return data_.row(index);
 }
 
 ostream& operator<<(ostream& os, const Trajectory& trajectory) {
   os << "Trajectory[\n";
   for (int i = 0; i < trajectory.get_size(); ++i) {
     // Print states with some offset.
-    os << "  " << trajectory.knot_points_.at(i) << "\n";
+    os << "  " << trajectory.get_knot_point(i) << "\n";
   }
   os << "]";
   return os;
@@ -137,20 +226,31 @@ string Trajectory::ToString() const {
 
 int Trajectory::get_dim() const { return pose_size_ + velocity_size_; }
 
-int Trajectory::get_size() const { return knot_points_.size(); }
+int Trajectory::get_size() const { return size_; }
 
 int Trajectory::get_pose_size() const { return pose_size_; }
 
 int Trajectory::get_velocity_size() const { return velocity_size_; }
 
-MatrixXd Trajectory::get_data() const {
-  MatrixXd data(get_size(), get_dim());
+int Trajectory::get_capacity() const { return data_.rows(); }
 
-  for (int i = 0; i < get_size(); ++i) {
-    data.row(i) = knot_points_.at(i).get_data();
-  }
+Trajectory::DataView Trajectory::get_data() const {
+  // As the data is row major, the knot points are the leading block of the
+  // storage.
+  return DataView(data_.data(), size_, get_dim());
+}
+
+State Trajectory::get_knot_point(const int index) const {
+  // Index validation happens in the [] operator.
+  ConstKnotPointView knot_point = (*this)[index];
+  return State(knot_point.head(pose_size_).transpose(),
+               knot_point.tail(velocity_size_).transpose());
+}
+
+const vector<double>& Trajectory::get_timestamps() const { return timestamps_; }
 
-  return data;
+const vector<int>& Trajectory::get_angle_indices() const {
+  return angle_indices_;
 }
 
 void Trajectory::set_data(const MatrixXd& data) {
@@ -160,21 +260,83 @@ void Trajectory::set_data(const MatrixXd& data) {
                 "Trajectory data has an incompatible number of columns. The "
                 "number of columns must equal the dimension of the "
                 "Trajectory.");
-  copy_data_to_knot_points(data);
+  // The timestamps can only be kept if the number of knot points remains the
+  // same.
+  if (data.rows() != size_) {
+    RequireUntimed();
+  }
+  InvalidatePathIndex();
+  data_ = data;
+  size_ = data.rows();
+}
+
+void Trajectory::set_knot_point(const int index, const State& knot_point) {
+  RequireCompatible(knot_point);
+  MORPH_REQUIRE(index >= 0 && index < size_, std::out_of_range,
+                "Trajectory index out of range.");
+  InvalidatePathIndex();
+  CopyKnotPoint(knot_point, index);
+}
+
+void Trajectory::set_timestamps(const vector<double>& timestamps) {
+  MORPH_REQUIRE(static_cast<int>(timestamps.size()) == size_,
+                std::invalid_argument,
+                "Number of timestamps must equal the number of knot points.");
+  MORPH_REQUIRE(adjacent_find(timestamps.begin(), timestamps.end(),
+                              greater_equal<double>()) == timestamps.end(),
+                std::invalid_argument,
+                "Timestamps must be strictly increasing.");
+  timestamps_ = timestamps;
+}
+
+void Trajectory::set_angle_indices(const vector<int>& angle_indices) {
+  vector<bool> is_angle(get_dim(), false);
+  for (const int angle_index : angle_indices) {
+    MORPH_REQUIRE(angle_index >= 0 && angle_index < get_dim(),
+                  std::out_of_range, "Angle index out of bounds.");
+    is_angle.at(angle_index) = true;
+  }
+  angle_indices_ = angle_indices;
+  is_angle_ = is_angle;
+}
+
+bool Trajectory::HasTimestamps() const { return !timestamps_.empty(); }
+
+void Trajectory::ClearTimestamps() { timestamps_.clear(); }
+
+void Trajectory::Reserve(const int capacity) {
+  MORPH_REQUIRE(capacity >= 0, std::invalid_argument,
+                "Capacity must be non-negative.");
+  if (capacity > get_capacity()) {
+    data_.conservativeResize(capacity, get_dim());
+  }
+  if (HasTimestamps()) {
+    timestamps_.reserve(capacity);
+  }
+}
+
+void Trajectory::ShrinkToFit() {
+  data_.conservativeResize(size_, get_dim());
+  timestamps_.shrink_to_fit();
 }
 
 void Trajectory::AddKnotPoint(const State& knot_point, const int index) {
-  // Make sure that the state is compatible.
-  MORPH_REQUIRE(
-      knot_point.get_pose_size() == pose_size_ &&
-          knot_point.get_velocity_size() == velocity_size_,
-      std::invalid_argument,
-      "State pose/velocity sizes do not match that of the trajectory.");
+  RequireUntimed();
+  RequireCompatible(knot_point);
   // Making sure that the index is correct.
   MORPH_REQUIRE(index >= 0 && index <= get_size(), std::out_of_range,
                 "Index out of bounds. Indices must lie in [0, size]");
 
-  knot_points_.insert(knot_points_.begin() + index, knot_point);
+  InvalidatePathIndex();
+  EnsureCapacity(size_ + 1);
+  // Shifting the knot points after the index by one row. The rows are
+  // contiguous, so this is a single (overlapping) copy.
+  const int dim = get_dim();
+  double* data = data_.data();
+  copy_backward(data + index * dim, data + size_ * dim,
+                data + (size_ + 1) * dim);
+  CopyKnotPoint(knot_point, index);
+  ++size_;
 }
 
 void Trajectory::AddKnotPoint(const State& knot_point) {
@@ -190,28 +352,121 @@ void Trajectory::AddKnotPoints(const vector<State>& knot_points,
   // Making sure that both vectors have the same number of elements.
   MORPH_REQUIRE(knot_points.size() == indices.size(), std::invalid_argument,
                 "States and indices must have the same number of elements");
+  if (indices.empty()) {
+    return;
+  }
+  RequireUntimed();
+  for (auto& knot_point : knot_points) {
+    RequireCompatible(knot_point);
+  }
 
-  // As the length of the vector changes as we keep inserting points, we cannot
-  // do this in a loop directly.
-  // We first sort the indices in ascending order, after which the points
-  // can be inserted in loop.
+  // The ith smallest index is the position of the ith knot point in the
+  // resulting trajectory.
   sort(indices.begin(), indices.end());
+  const int num_knot_points = indices.size();
+  MORPH_REQUIRE(adjacent_find(indices.begin(), indices.end()) == indices.end(),
+                std::invalid_argument, "Indices must be unique.");
+  MORPH_REQUIRE(indices.front() >= 0 &&
+                    indices.back() < get_size() + num_knot_points,
+                std::out_of_range,
+                "Index out of bounds. Indices must lie in [0, size]");
+
+  // Everything is validated before the trajectory is modified, so that it
+  // isn't left in a partially modified state.
+  InvalidatePathIndex();
+  EnsureCapacity(size_ + num_knot_points);
+
+  // Merging from the back. The existing knot points that end up after the ith
+  // new knot point have i + 1 new knot points before them, so each contiguous
+  // run of them is shifted back by that many rows in one copy.
+  const int dim = get_dim();
+  double* data = data_.data();
+  int end = size_;
+  for (int i = num_knot_points - 1; i >= 0; --i) {
+    const int begin = indices.at(i) - i;
+    copy_backward(data + begin * dim, data + end * dim,
+                  data + (end + i + 1) * dim);
+    CopyKnotPoint(knot_points.at(i), indices.at(i));
+    end = begin;
+  }
+  size_ += num_knot_points;
+}
 
-  for (unsigned int i = 0; i < knot_points.size(); ++i) {
-    // State validation is done in the AddKnotPoint function.
+void Trajectory::AppendKnotPoints(const vector<State>& knot_points) {
+  RequireUntimed();
+  for (auto& knot_point : knot_points) {
+    RequireCompatible(knot_point);
+  }
 
-    // Note that even if a knot point is invalid, any valid knot point that
-    // occurs before the invalid one will get added to the trajectory. It is
-    // recommended to not not catch any exception arising from these functions
-    // as it would mean that the trajectory might have mutated.
-    AddKnotPoint(knot_points.at(i), indices.at(i));
+  InvalidatePathIndex();
+  EnsureCapacity(size_ + knot_points.size());
+  for (auto& knot_point : knot_points) {
+    CopyKnotPoint(knot_point, size_++);
   }
 }
 
+void Trajectory::AppendKnotPoints(const MatrixXd& data) {
+  RequireUntimed();
+  MORPH_REQUIRE(data.cols() == get_dim(), std::invalid_argument,
+                "Trajectory data has an incompatible number of columns. The "
+                "number of columns must equal the dimension of the "
+                "Trajectory.");
+
+  InvalidatePathIndex();
+  EnsureCapacity(size_ + data.rows());
+  data_.middleRows(size_, data.rows()) = data;
+  size_ += data.rows();
+}
+
+void Trajectory::AppendKnotPoints(const vector<State>& knot_points,
+                                  const vector<double>& timestamps) {
+  MORPH_REQUIRE(knot_points.size() == timestamps.size(), std::invalid_argument,
+                "Knot points and timestamps must have the same number of "
+                "elements.");
+  RequireAppendable(timestamps);
+  for (auto& knot_point : knot_points) {
+    RequireCompatible(knot_point);
+  }
+
+  InvalidatePathIndex();
+  EnsureCapacity(size_ + knot_points.size());
+  for (auto& knot_point : knot_points) {
+    CopyKnotPoint(knot_point, size_++);
+  }
+  timestamps_.insert(timestamps_.end(), timestamps.begin(), timestamps.end());
+}
+
+void Trajectory::AppendKnotPoints(const MatrixXd& data,
+                                  const vector<double>& timestamps) {
+  MORPH_REQUIRE(data.rows() == static_cast<int>(timestamps.size()),
+                std::invalid_argument,
+                "Knot points and timestamps must have the same number of "
+                "elements.");
+  RequireAppendable(timestamps);
+  MORPH_REQUIRE(data.cols() == get_dim(), std::invalid_argument,
+                "Trajectory data has an incompatible number of columns. The "
+                "number of columns must equal the dimension of the "
+                "Trajectory.");
+
+  InvalidatePathIndex();
+  EnsureCapacity(size_ + data.rows());
+  data_.middleRows(size_, data.rows()) = data;
+  size_ += data.rows();
+  timestamps_.insert(timestamps_.end(), timestamps.begin(), timestamps.end());
+}
+
 void Trajectory::RemoveKnotPoint(const int index) {
   MORPH_REQUIRE(index >= 0 && index < get_size(), std::out_of_range,
                 "Index out of bounds");
-  knot_points_.erase(knot_points_.begin() + index);
+  InvalidatePathIndex();
+  // Shifting the knot points after the index back by one row.
+  const int dim = get_dim();
+  double* data = data_.data();
+  copy(data + (index + 1) * dim, data + size_ * dim, data + index * dim);
+  --size_;
+  if (HasTimestamps()) {
+    timestamps_.erase(timestamps_.begin() + index);
+  }
 }
 
 void Trajectory::RemoveKnotPoint() {
@@ -221,15 +476,496 @@ void Trajectory::RemoveKnotPoint() {
 }
 
 void Trajectory::RemoveKnotPoints(vector<int> indices) {
-  // Validity check for the indices happens in the RemoveKnotPoint function.
-
-  // As the length of the vector changes as we keep removing points, we cannot
-  // do this in a loop directly.
-  // We first sort the indices in descending order, after which the points
-  // can be removed in loop.
-  sort(indices.begin(), indices.end(), greater<int>());
-  for (auto& index : indices) {
-    RemoveKnotPoint(index);
+  if (indices.empty()) {
+    return;
+  }
+
+  sort(indices.begin(), indices.end());
+  MORPH_REQUIRE(indices.front() >= 0 && indices.back() < get_size(),
+                std::out_of_range, "Index out of bounds");
+  MORPH_REQUIRE(adjacent_find(indices.begin(), indices.end()) == indices.end(),
+                std::invalid_argument, "Indices must be unique.");
+
+  InvalidatePathIndex();
+  size_ = RemoveRows(data_.data(), get_dim(), size_, indices);
+  if (HasTimestamps()) {
+    timestamps_.resize(
+        RemoveRows(timestamps_.data(), 1, timestamps_.size(), indices));
+  }
+}
+
+State Trajectory::Sample(const double time,
+                         const InterpolationType interpolation_type) const {
+  State sample(pose_size_, velocity_size_);
+  Sample(time, sample, interpolation_type);
+  return sample;
+}
+
+void Trajectory::Sample(const double time, State& sample,
+                        const InterpolationType interpolation_type) const {
+  // Without a cursor from a previous sample, the segment is found through a
+  // binary search.
+  int segment_cursor = 0;
+  Sample(time, sample, segment_cursor, interpolation_type);
+}
+
+void Trajectory::Sample(const double time, State& sample, int& segment_cursor,
+                        const InterpolationType interpolation_type) const {
+  MORPH_REQUIRE(HasTimestamps(), logic_error,
+                "Only timed trajectories can be sampled.");
+  RequireCompatible(sample);
+
+  // A single knot point is held for all time.
+  if (size_ == 1) {
+    for (int i = 0; i < get_dim(); ++i) {
+      sample[i] = data_(0, i);
+    }
+    return;
+  }
+
+  const double clamped_time =
+      min(max(time, timestamps_.front()), timestamps_.back());
+  const int segment = FindSegment(timestamps_, clamped_time, segment_cursor);
+  for (int i = 0; i < get_dim(); ++i) {
+    sample[i] =
+        InterpolateComponent(i, segment, clamped_time, interpolation_type);
+  }
+}
+
+MatrixXd Trajectory::SampleBatch(
+    const vector<double>& times,
+    const InterpolationType interpolation_type) const {
+  MORPH_REQUIRE(HasTimestamps(), logic_error,
+                "Only timed trajectories can be sampled.");
+  MatrixXd samples(times.size(), get_dim());
+  State sample(pose_size_, velocity_size_);
+  int segment_cursor = 0;
+  for (unsigned int i = 0; i < times.size(); ++i) {
+    Sample(times.at(i), sample, segment_cursor, interpolation_type);
+    for (int j = 0; j < get_dim(); ++j) {
+      samples(i, j) = sample[j];
+    }
+  }
+  return samples;
+}
+
+const vector<double>& Trajectory::get_arc_lengths() const {
+  return GetPathIndex().arc_lengths;
+}
+
+double Trajectory::get_path_length() const {
+  return GetPathIndex().arc_lengths.back();
+}
+
+State Trajectory::SampleAtArcLength(const double arc_length) const {
+  const vector<double>& arc_lengths = GetPathIndex().arc_lengths;
+  if (size_ == 1) {
+    return get_knot_point(0);
+  }
+
+  const double clamped_arc_length =
+      min(max(arc_length, 0.), arc_lengths.back());
+  int segment_cursor = 0;
+  const int segment =
+      FindSegment(arc_lengths, clamped_arc_length, segment_cursor);
+  const double segment_length =
+      arc_lengths.at(segment + 1) - arc_lengths.at(segment);
+  // Segments of zero length are sampled at their start.
+  const double fraction =
+      segment_length > 0.
+          ? (clamped_arc_length - arc_lengths.at(segment)) / segment_length
+          : 0.;
+
+  State sample(pose_size_, velocity_size_);
+  for (int i = 0; i < get_dim(); ++i) {
+    sample[i] = InterpolateLinearly(i, segment, fraction);
+  }
+  return sample;
+}
+
+PathPoint Trajectory::FindNearestPathPoint(const Point& point) const {
+  const PathIndex& path_index = GetPathIndex();
+  MORPH_REQUIRE(point.allFinite(), std::invalid_argument,
+                "Point must be finite.");
+
+  // Cell of the point, which may lie outside of the grid. Far away points are
+  // clamped so that the cell indices don't overflow, which doesn't matter as
+  // the search starts at the grid anyway.
+  const double cell_limit = 1e15;
+  const Point cell_position =
+      ((point - path_index.origin) / path_index.cell_size)
+          .cwiseMax(-cell_limit)
+          .cwiseMin(cell_limit);
+  const int64_t col = static_cast<int64_t>(floor(cell_position(0)));
+  const int64_t row = static_cast<int64_t>(floor(cell_position(1)));
+  const int64_t num_cols = path_index.num_cols;
+  const int64_t num_rows = path_index.num_rows;
+
+  // Searching rings of cells around the cell of the point, until the rest of
+  // the cells are further away than the nearest point found so far. The rings
+  // before the first one don't have any cells in the grid.
+  const int64_t first_ring = max<int64_t>(
+      {0, -col, col - (num_cols - 1), -row, row - (num_rows - 1)});
+  PathPoint nearest_path_point;
+  nearest_path_point.distance = numeric_limits<double>::infinity();
+  for (int64_t ring = first_ring;; ++ring) {
+    if (ring > 0) {
+      // Every cell in the ring lies outside the square of cells of the
+      // previous rings.
+      const double min_x =
+          path_index.origin(0) + (col - ring + 1) * path_index.cell_size;
+      const double max_x =
+          path_index.origin(0) + (col + ring) * path_index.cell_size;
+      const double min_y =
+          path_index.origin(1) + (row - ring + 1) * path_index.cell_size;
+      const double max_y =
+          path_index.origin(1) + (row + ring) * path_index.cell_size;
+      const double ring_distance =
+          min({point(0) - min_x, max_x - point(0), point(1) - min_y,
+               max_y - point(1)});
+      if (ring_distance > nearest_path_point.distance) {
+        break;
+      }
+    }
+
+    auto search_cell = [&](const int64_t i, const int64_t j) {
+      const int cell = i * num_cols + j;
+      for (int k = path_index.cell_offsets.at(cell);
+           k < path_index.cell_offsets.at(cell + 1); ++k) {
+        const PathPoint path_point = ProjectOntoSegment(
+            path_index, point, path_index.cell_segments.at(k));
+        // Ties are broken by the segment index so that the result doesn't
+        // depend on the order in which the cells are searched.
+        if (path_point.distance < nearest_path_point.distance ||
+            (path_point.distance == nearest_path_point.distance &&
+             path_point.segment < nearest_path_point.segment)) {
+          nearest_path_point = path_point;
+        }
+      }
+    };
+    for (int64_t i = max<int64_t>(row - ring, 0);
+         i <= min<int64_t>(row + ring, num_rows - 1); ++i) {
+      if (std::abs(i - row) == ring) {
+        // The first and last rows of the ring are complete.
+        for (int64_t j = max<int64_t>(col - ring, 0);
+             j <= min<int64_t>(col + ring, num_cols - 1); ++j) {
+          search_cell(i, j);
+        }
+      } else {
+        // The other rows only have their first and last cells in the ring.
+        if (col - ring >= 0) {
+          search_cell(i, col - ring);
+        }
+        if (col + ring < num_cols) {
+          search_cell(i, col + ring);
+        }
+      }
+    }
+
+    // Stopping once the rings cover the whole grid.
+    if (row - ring <= 0 && row + ring >= num_rows - 1 && col - ring <= 0 &&
+        col + ring >= num_cols - 1) {
+      break;
+    }
+  }
+
+  return nearest_path_point;
+}
+
+PathPoint Trajectory::FindNearestPathPoint(const Point& point,
+                                           const int segment,
+                                           const int window) const {
+  const PathIndex& path_index = GetPathIndex();
+  const int num_segments = max(size_ - 1, 1);
+  MORPH_REQUIRE(segment >= 0 && segment < num_segments, std::out_of_range,
+                "Segment index out of bounds.");
+  MORPH_REQUIRE(window >= 0, std::invalid_argument,
+                "Window must be non-negative.");
+
+  PathPoint nearest_path_point = ProjectOntoSegment(path_index, point, segment);
+  for (int i = max(segment - window, 0);
+       i <= min(segment + window, num_segments - 1); ++i) {
+    const PathPoint path_point = ProjectOntoSegment(path_index, point, i);
+    if (path_point.distance < nearest_path_point.distance ||
+        (path_point.distance == nearest_path_point.distance &&
+         path_point.segment < nearest_path_point.segment)) {
+      nearest_path_point = path_point;
+    }
+  }
+  return nearest_path_point;
+}
+
+void Trajectory::ReleaseKnotPoints() noexcept {
+  // Leaves a (moved from) trajectory without any knot points. The pose and
+  // velocity sizes are kept so that it can be reused.
+  size_ = 0;
+  data_.resize(0, get_dim());
+  timestamps_.clear();
+  angle_indices_.clear();
+  is_angle_.clear();
+  path_index_.reset();
+}
+
+void Trajectory::EnsureCapacity(const int capacity) {
+  if (capacity <= get_capacity()) {
+    return;
+  }
+  // conservativeResize keeps the existing rows.
+  data_.conservativeResize(max(capacity, 2 * get_capacity()), get_dim());
+}
+
+void Trajectory::RequireCompatible(const State& knot_point) const {
+  MORPH_REQUIRE(
+      knot_point.get_pose_size() == pose_size_ &&
+          knot_point.get_velocity_size() == velocity_size_,
+      std::invalid_argument,
+      "State pose/velocity sizes do not match that of the trajectory.");
+}
+
+void Trajectory::RequireUntimed() const {
+  MORPH_REQUIRE(!HasTimestamps(), logic_error,
+                "Knot points can only be added to a timed trajectory along "
+                "with their timestamps.");
+}
+
+void Trajectory::RequireAppendable(const vector<double>& timestamps) const {
+  MORPH_REQUIRE(HasTimestamps() || size_ == 0, logic_error,
+                "Knot points with timestamps can only be added to timed or "
+                "empty trajectories.");
+  MORPH_REQUIRE(adjacent_find(timestamps.begin(), timestamps.end(),
+                              greater_equal<double>()) == timestamps.end(),
+                std::invalid_argument,
+                "Timestamps must be strictly increasing.");
+  MORPH_REQUIRE(!HasTimestamps() || timestamps.empty() ||
+                    timestamps.front() > timestamps_.back(),
+                std::invalid_argument,
+                "Timestamps must come after the existing timestamps.");
+}
+
+int Trajectory::RemoveRows(double* data, const int dim, const int size,
+                           const vector<int>& indices) {
+  // Compacting from the front. Each contiguous run of rows between two removed
+  // indices is moved forward in one copy.
+  int write_index = indices.front();
+  for (unsigned int i = 0; i < indices.size(); ++i) {
+    const int begin = indices.at(i) + 1;
+    const int end = i + 1 < indices.size() ? indices.at(i + 1) : size;
+    copy(data + begin * dim, data + end * dim, data + write_index * dim);
+    write_index += end - begin;
+  }
+  return write_index;
+}
+
+int Trajectory::FindSegment(const vector<double>& breakpoints,
+                            const double value, int& segment_cursor) const {
+  // Checking the segment of the cursor and the one after it first, which
+  // covers queries at monotonically increasing values.
+  const int last_segment = size_ - 2;
+  const int first_segment = min(max(segment_cursor, 0), last_segment);
+  for (int segment = first_segment;
+       segment <= min(first_segment + 1, last_segment); ++segment) {
+    if (breakpoints.at(segment) <= value &&
+        (value < breakpoints.at(segment + 1) || segment == last_segment)) {
+      segment_cursor = segment;
+      return segment;
+    }
+  }
+
+  // Binary search for the first breakpoint after the value.
+  const int index = upper_bound(breakpoints.begin(), breakpoints.end(), value) -
+                    breakpoints.begin();
+  segment_cursor = min(max(index - 1, 0), last_segment);
+  return segment_cursor;
+}
+
+double Trajectory::InterpolateLinearly(const int component, const int segment,
+                                       const double fraction) const {
+  const double value =
+      data_(segment, component) +
+      fraction * ComputeDifference(component, segment, segment + 1);
+  return IsAngle(component) ? NormalizeAngle(value) : value;
+}
+
+double Trajectory::InterpolateComponent(
+    const int component, const int segment, const double time,
+    const InterpolationType interpolation_type) const {
+  const double dt = timestamps_.at(segment + 1) - timestamps_.at(segment);
+  const double s = (time - timestamps_.at(segment)) / dt;
+  if (interpolation_type == InterpolationType::kLinear) {
+    return InterpolateLinearly(component, segment, s);
+  }
+
+  // Cubic Hermite basis functions. As h00 + h01 = 1, the interpolation is
+  // expressed relative to the first knot point, which keeps the angles
+  // continuous.
+  const double h10 = s * (s - 1.) * (s - 1.);
+  const double h01 = s * s * (3. - 2. * s);
+  const double h11 = s * s * (s - 1.);
+  const double value =
+      data_(segment, component) +
+      h01 * ComputeDifference(component, segment, segment + 1) +
+      dt * (h10 * ComputeTangent(component, segment) +
+            h11 * ComputeTangent(component, segment + 1));
+  return IsAngle(component) ? NormalizeAngle(value) : value;
+}
+
+double Trajectory::ComputeTangent(const int component, const int index) const {
+  // Central differences for the interior knot points and one sided
+  // differences at the ends. The differences are accumulated over adjacent
+  // knot points so that they are correct for angles as well.
+  const int previous = max(index - 1, 0);
+  const int next = min(index + 1, size_ - 1);
+  double difference = 0.;
+  for (int i = previous; i < next; ++i) {
+    difference += ComputeDifference(component, i, i + 1);
+  }
+  return difference / (timestamps_.at(next) - timestamps_.at(previous));
+}
+
+double Trajectory::ComputeDifference(const int component, const int index1,
+                                     const int index2) const {
+  const double difference = data_(index2, component) - data_(index1, component);
+  return IsAngle(component) ? NormalizeAngle(difference) : difference;
+}
+
+bool Trajectory::IsAngle(const int component) const {
+  return !is_angle_.empty() && is_angle_.at(component);
+}
+
+void Trajectory::RequirePath() const {
+  MORPH_REQUIRE(size_ > 0, logic_error,
+                "Path queries require a non-empty trajectory.");
+  MORPH_REQUIRE(pose_size_ >= 2, logic_error,
+                "Path queries require the pose to have a position (The first "
+                "two components).");
+}
+
+const Trajectory::PathIndex& Trajectory::GetPathIndex() const {
+  RequirePath();
+  shared_ptr<const PathIndex> built_path_index = atomic_load(&path_index_);
+  if (built_path_index != nullptr) {
+    return *built_path_index;
+  }
+
+  auto path_index = make_shared<PathIndex>();
+
+  // Cumulative arc lengths.
+  vector<double>& arc_lengths = path_index->arc_lengths;
+  arc_lengths.resize(size_);
+  arc_lengths.at(0) = 0.;
+  for (int i = 1; i < size_; ++i) {
+    arc_lengths.at(i) =
+        arc_lengths.at(i - 1) +
+        (data_.row(i).head<2>() - data_.row(i - 1).head<2>()).norm();
+  }
+
+  // The cells are roughly as large as the segments, while there are roughly
+  // as many cells as there are segments.
+  const int num_segments = max(size_ - 1, 1);
+  const Point min_position =
+      data_.topRows(size_).leftCols<2>().colwise().minCoeff();
+  const Point max_position =
+      data_.topRows(size_).leftCols<2>().colwise().maxCoeff();
+  const Point extent = max_position - min_position;
+  double cell_size = max(arc_lengths.back() / num_segments,
+                         sqrt(extent(0) * extent(1) / num_segments));
+  if (cell_size <= 0.) {
+    // All the knot points are at the same position.
+    cell_size = 1.;
+  }
+  path_index->origin = min_position;
+  path_index->cell_size = cell_size;
+  path_index->num_cols = static_cast<int>(floor(extent(0) / cell_size)) + 1;
+  path_index->num_rows = static_cast<int>(floor(extent(1) / cell_size)) + 1;
+
+  // Each segment is added to the cells that its bounding box overlaps. The
+  // segments are first counted per cell, and then filled in.
+  auto for_each_cell = [&](const int segment, auto function) {
+    const int next = min(segment + 1, size_ - 1);
+    const Point start =
+        (data_.row(segment).head<2>().transpose() - min_position) / cell_size;
+    const Point end =
+        (data_.row(next).head<2>().transpose() - min_position) / cell_size;
+    const int min_col = min(static_cast<int>(floor(min(start(0), end(0)))),
+                            path_index->num_cols - 1);
+    const int max_col = min(static_cast<int>(floor(max(start(0), end(0)))),
+                            path_index->num_cols - 1);
+    const int min_row = min(static_cast<int>(floor(min(start(1), end(1)))),
+                            path_index->num_rows - 1);
+    const int max_row = min(static_cast<int>(floor(max(start(1), end(1)))),
+                            path_index->num_rows - 1);
+    for (int i = min_row; i <= max_row; ++i) {
+      for (int j = min_col; j <= max_col; ++j) {
+        function(i * path_index->num_cols + j);
+      }
+    }
+  };
+
+  vector<int>& cell_offsets = path_index->cell_offsets;
+  cell_offsets.assign(path_index->num_cols * path_index->num_rows + 1, 0);
+  for (int segment = 0; segment < num_segments; ++segment) {
+    for_each_cell(segment,
+                  [&](const int cell) { ++cell_offsets.at(cell + 1); });
+  }
+  for (unsigned int i = 1; i < cell_offsets.size(); ++i) {
+    cell_offsets.at(i) += cell_offsets.at(i - 1);
+  }
+  vector<int> cell_sizes(cell_offsets.size() - 1, 0);
+  path_index->cell_segments.resize(cell_offsets.back());
+  for (int segment = 0; segment < num_segments; ++segment) {
+    for_each_cell(segment, [&](const int cell) {
+      path_index->cell_segments.at(cell_offsets.at(cell) +
+                                   cell_sizes.at(cell)++) = segment;
+    });
+  }
+
+  // Publishing the path index, unless a concurrent query has already built
+  // one. Either way, the path index is only replaced once the knot points
+  // change, so the reference remains valid until then.
+  built_path_index = nullptr;
+  if (atomic_compare_exchange_strong(
+          &path_index_, &built_path_index,
+          shared_ptr<const PathIndex>(std::move(path_index)))) {
+    return *atomic_load(&path_index_);
+  }
+  return *built_path_index;
+}
+
+void Trajectory::InvalidatePathIndex() { path_index_.reset(); }
+
+PathPoint Trajectory::ProjectOntoSegment(const PathIndex& path_index,
+                                         const Point& point,
+                                         const int segment) const {
+  // A single knot point is a segment of zero length.
+  const int next = min(segment + 1, size_ - 1);
+  const Point start = data_.row(segment).head<2>().transpose();
+  const Point direction = data_.row(next).head<2>().transpose() - start;
+  const double squared_length = direction.squaredNorm();
+
+  PathPoint path_point;
+  path_point.segment = segment;
+  path_point.fraction =
+      squared_length > 0.
+          ? min(max((point - start).dot(direction) / squared_length, 0.), 1.)
+          : 0.;
+  path_point.position = start + path_point.fraction * direction;
+  path_point.distance = (point - path_point.position).norm();
+  const vector<double>& arc_lengths = path_index.arc_lengths;
+  path_point.arc_length =
+      arc_lengths.at(segment) +
+      path_point.fraction * (arc_lengths.at(next) - arc_lengths.at(segment));
+  return path_point;
+}
+
+void Trajectory::CopyKnotPoint(const State& knot_point, const int index) {
+  // Copying the pose and velocity parts separately avoids the temporary that
+  // State::get_data creates. Either of them may be empty.
+  if (pose_size_ > 0) {
+    data_.row(index).head(pose_size_) = knot_point.get_pose_data().transpose();
+  }
+  if (velocity_size_ > 0) {
+    data_.row(index).tail(velocity_size_) =
+        knot_point.get_velocity_data().transpose();
   }
 }
 
@@ -30,8 +30,25 @@ Velocity::Velocity(initializer_list<double> elements) : size_(elements.size()) {
   data_ = Map<VectorXd>(&data_vector[0], size_);
 }
 
+Velocity::Velocity(Velocity&& velocity) noexcept
+    : size_(velocity.size_), data_(std::move(velocity.data_)) {
+  velocity.size_ = 0;
+}
+
+Velocity& Velocity::operator=(Velocity&& velocity) noexcept {
+  if (this != &velocity) {
+    size_ = velocity.size_;
+    data_ = std::move(velocity.data_);
+    // Eigen swaps the buffers on move assignment, so the moved from data has
+    // to be released explicitly.
+    velocity.size_ = 0;
+    velocity.data_.resize(0);
+  }
+  return *this;
+}
+
 Velocity& Velocity::operator+=(const Velocity& velocity) {
-  MORPH_REQUIRE(
+  MORPH_HOT_REQUIRE(
       this->size_ == velocity.size_, std::invalid_argument,
       "Velocities are not of the same size. The += operator requires them "
       "to be of the "
@@ -48,7 +65,7 @@ Velocity Velocity::operator+(const Velocity& velocity) const {
 }
 
 Velocity& Velocity::operator-=(const Velocity& velocity) {
-  MORPH_REQUIRE(
+  MORPH_HOT_REQUIRE(
       this->size_ == velocity.size_, std::invalid_argument,
       "Velocities are not of the same size. The -= operator requires them "
       "to be of the "
@@ -94,16 +111,16 @@ bool operator!=(const Velocity& velocity1, const Velocity& velocity2) {
 }
 
 double& Velocity::operator[](const int index) {
-  MORPH_REQUIRE(index >= 0 && index < size_, std::out_of_range,
-                "Velocity index out of bounds.");
-  MORPH_REQUIRE(!IsEmpty(), std::logic_error, "Velocity object is empty");
+  MORPH_HOT_REQUIRE(index >= 0 && index < size_, std::out_of_range,
+                    "Velocity index out of bounds.");
+  MORPH_HOT_REQUIRE(!IsEmpty(), std::logic_error, "Velocity object is empty");
   return data_(index);
 }
 
 const double& Velocity::operator[](const int index) const {
-  MORPH_REQUIRE(index >= 0 && index < size_, std::out_of_range,
-                "Velocity index out of bounds.");
-  MORPH_REQUIRE(!IsEmpty(), std::logic_error, "Velocity object is empty");
+  MORPH_HOT_REQUIRE(index >= 0 && index < size_, std::out_of_range,
+                    "Velocity index out of bounds.");
+  MORPH_HOT_REQUIRE(!IsEmpty(), std::logic_error, "Velocity object is empty");
   return data_(index);
 }
 
@@ -123,7 +140,12 @@ bool Velocity::IsEmpty() const { return size_ == 0; }
 int Velocity::get_size() const { return size_; }
 
 const VectorXd& Velocity::get_data() const {
-  MORPH_REQUIRE(!IsEmpty(), std::logic_error, "Velocity object is empty");
+  MORPH_HOT_REQUIRE(!IsEmpty(), std::logic_error, "Velocity object is empty");
+  return data_;
+}
+
+VectorXd& Velocity::get_data_ref() {
+  MORPH_HOT_REQUIRE(!IsEmpty(), std::logic_error, "Velocity object is empty");
   return data_;
 }
 
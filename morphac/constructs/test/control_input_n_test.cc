@@ -0,0 +1,108 @@
+#include "constructs/include/control_input_n.h"
+
+#include "Eigen/Dense"
+#include "gtest/gtest.h"
+
+namespace {
+
+using std::ostringstream;
+using std::srand;
+
+using Eigen::Vector2d;
+using Eigen::Vector3d;
+
+using morphac::constructs::ControlInput;
+using morphac::constructs::ControlInputN;
+
+class ControlInputNTest : public ::testing::Test {
+ protected:
+  ControlInputNTest() {
+    // Set random seed for Eigen.
+    srand(7);
+  }
+
+  void SetUp() override {}
+};
+
+TEST_F(ControlInputNTest, Construction) {
+  ControlInputN<2> control_input1;
+  ControlInputN<3> control_input2(Vector3d(1., 2., 3.));
+
+  ASSERT_EQ(control_input1.get_size(), 2);
+  ASSERT_TRUE(control_input1.get_data().isApprox(Vector2d::Zero()));
+  ASSERT_TRUE(control_input2.get_data().isApprox(Vector3d(1., 2., 3.)));
+
+  // The static size is taken by reference here, which requires its
+  // definition.
+  ASSERT_EQ(ControlInputN<3>::size, 3);
+}
+
+TEST_F(ControlInputNTest, Conversion) {
+  ControlInput control_input1({1., 2.});
+  ControlInput control_input2(2);
+
+  ControlInputN<2> control_input_n(control_input1);
+  ASSERT_TRUE(control_input_n.get_data().isApprox(Vector2d(1., 2.)));
+  ASSERT_TRUE(control_input_n.ToControlInput() == control_input1);
+
+  control_input_n.CopyTo(control_input2);
+  ASSERT_TRUE(control_input2 == control_input1);
+}
+
+TEST_F(ControlInputNTest, InvalidConversion) {
+  ControlInput control_input(3);
+
+  ASSERT_THROW(ControlInputN<2>{control_input}, std::invalid_argument);
+  ASSERT_THROW(ControlInputN<2>().CopyTo(control_input),
+               std::invalid_argument);
+}
+
+TEST_F(ControlInputNTest, Arithmetic) {
+  Vector2d data1 = Vector2d::Random(), data2 = Vector2d::Random();
+  ControlInputN<2> control_input1(data1), control_input2(data2);
+
+  ASSERT_TRUE(
+      (control_input1 + control_input2).get_data().isApprox(data1 + data2));
+  ASSERT_TRUE(
+      (control_input1 - control_input2).get_data().isApprox(data1 - data2));
+  ASSERT_TRUE((control_input1 * 2.5).get_data().isApprox(data1 * 2.5));
+  ASSERT_TRUE((2.5 * control_input1).get_data().isApprox(data1 * 2.5));
+
+  control_input1 += control_input2;
+  ASSERT_TRUE(control_input1.get_data().isApprox(data1 + data2));
+  control_input1 -= control_input2;
+  ASSERT_TRUE(control_input1.get_data().isApprox(data1));
+  control_input1 *= -3.;
+  ASSERT_TRUE(control_input1.get_data().isApprox(-3. * data1));
+}
+
+TEST_F(ControlInputNTest, DataAccess) {
+  ControlInputN<2> control_input;
+
+  control_input[0] = 1.;
+  control_input.get_data_ref()(1) = 2.;
+
+  ASSERT_EQ(control_input[0], 1.);
+  ASSERT_EQ(control_input[1], 2.);
+  ASSERT_TRUE(control_input == ControlInputN<2>(Vector2d(1., 2.)));
+  ASSERT_TRUE(control_input != ControlInputN<2>(Vector2d(1., 3.)));
+
+  ASSERT_THROW(control_input[-1], std::out_of_range);
+  ASSERT_THROW(control_input[2], std::out_of_range);
+}
+
+TEST_F(ControlInputNTest, StringRepresentation) {
+  ControlInputN<2> control_input(Vector2d(1., 2.));
+
+  ostringstream os;
+  os << control_input;
+
+  ASSERT_EQ(os.str(), control_input.ToControlInput().ToString());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
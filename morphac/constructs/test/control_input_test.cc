@@ -53,6 +53,36 @@ TEST_F(ControlInputTest, CopyAssignment) {
   ASSERT_TRUE(control_input3.get_data().isApprox(data));
 }
 
+TEST_F(ControlInputTest, MoveConstructor) {
+  static_assert(std::is_nothrow_move_constructible<ControlInput>::value,
+                "ControlInput must be nothrow move constructible.");
+
+  VectorXd data = VectorXd::Random(4);
+  ControlInput control_input1(data);
+  ControlInput control_input2(std::move(control_input1));
+
+  ASSERT_TRUE(control_input2.get_data().isApprox(data));
+  // The moved from control input is left empty.
+  ASSERT_TRUE(control_input1.IsEmpty());
+}
+
+TEST_F(ControlInputTest, MoveAssignment) {
+  static_assert(std::is_nothrow_move_assignable<ControlInput>::value,
+                "ControlInput must be nothrow move assignable.");
+
+  VectorXd data = VectorXd::Random(4);
+  ControlInput control_input1(data);
+  ControlInput control_input2(3);
+  control_input2 = std::move(control_input1);
+
+  ASSERT_TRUE(control_input2.get_data().isApprox(data));
+  ASSERT_TRUE(control_input1.IsEmpty());
+
+  // The moved from control input can be assigned to again.
+  control_input1 = ControlInput(2);
+  ASSERT_TRUE(control_input1.get_data().isApprox(VectorXd::Zero(2)));
+}
+
 TEST_F(ControlInputTest, InvalidConstruction) {
   ASSERT_THROW(ControlInput(-1), std::invalid_argument);
 }
@@ -110,6 +140,19 @@ TEST_F(ControlInputTest, GetData) {
   ASSERT_TRUE(control_input.get_data().isApprox(data));
 }
 
+TEST_F(ControlInputTest, GetDataRef) {
+  VectorXd data = VectorXd::Random(3);
+  ControlInput control_input(3);
+
+  control_input.get_data_ref() = data;
+  ASSERT_TRUE(control_input.get_data().isApprox(data));
+
+  control_input.get_data_ref()(1) = 5.;
+  ASSERT_EQ(control_input[1], 5.);
+
+  ASSERT_THROW(ControlInput(0).get_data_ref(), std::logic_error);
+}
+
 TEST_F(ControlInputTest, GetControlInputAt) {
   for (int i = 0; i < control_input1_->get_size(); ++i) {
     ASSERT_EQ((*control_input1_)[i], 0);
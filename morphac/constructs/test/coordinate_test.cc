@@ -54,6 +54,19 @@ TEST_F(CoordinateTest, CopyAssignment) {
   ASSERT_TRUE(coord1.get_data().isApprox(coord1_.get_data()));
 }
 
+TEST_F(CoordinateTest, MoveConstruction) {
+  static_assert(std::is_nothrow_move_constructible<Coordinate>::value &&
+                    std::is_nothrow_move_assignable<Coordinate>::value,
+                "Coordinate must be nothrow movable.");
+
+  Coordinate coord1(coord1_);
+  Coordinate coord2(std::move(coord1));
+  Coordinate coord3;
+  coord3 = std::move(coord2);
+
+  ASSERT_TRUE(coord3.get_data().isApprox(coord1_.get_data()));
+}
+
 TEST_F(CoordinateTest, DefaultCoordinate) {
   Coordinate default_coord;
   ASSERT_DOUBLE_EQ(default_coord.get_x(), 0.0);
@@ -13,6 +13,7 @@ using std::unique_ptr;
 
 using Eigen::VectorXd;
 
+using morphac::constructs::Lazy;
 using morphac::constructs::Pose;
 
 class PoseTest : public ::testing::Test {
@@ -52,6 +53,36 @@ TEST_F(PoseTest, CopyAssignment) {
   ASSERT_TRUE(pose3.get_data().isApprox(data));
 }
 
+TEST_F(PoseTest, MoveConstructor) {
+  static_assert(std::is_nothrow_move_constructible<Pose>::value,
+                "Pose must be nothrow move constructible.");
+
+  VectorXd data = VectorXd::Random(4);
+  Pose pose1(data);
+  Pose pose2(std::move(pose1));
+
+  ASSERT_TRUE(pose2.get_data().isApprox(data));
+  // The moved from pose is left empty.
+  ASSERT_TRUE(pose1.IsEmpty());
+}
+
+TEST_F(PoseTest, MoveAssignment) {
+  static_assert(std::is_nothrow_move_assignable<Pose>::value,
+                "Pose must be nothrow move assignable.");
+
+  VectorXd data = VectorXd::Random(4);
+  Pose pose1(data);
+  Pose pose2(3);
+  pose2 = std::move(pose1);
+
+  ASSERT_TRUE(pose2.get_data().isApprox(data));
+  ASSERT_TRUE(pose1.IsEmpty());
+
+  // The moved from pose can be assigned to again.
+  pose1 = Pose(2);
+  ASSERT_TRUE(pose1.get_data().isApprox(VectorXd::Zero(2)));
+}
+
 TEST_F(PoseTest, InvalidConstruction) {
   ASSERT_THROW(Pose(-1), std::invalid_argument);
 }
@@ -109,6 +140,19 @@ TEST_F(PoseTest, GetData) {
   ASSERT_TRUE(pose.get_data().isApprox(data));
 }
 
+TEST_F(PoseTest, GetDataRef) {
+  VectorXd data = VectorXd::Random(3);
+  Pose pose(3);
+
+  pose.get_data_ref() = data;
+  ASSERT_TRUE(pose.get_data().isApprox(data));
+
+  pose.get_data_ref()(1) = 5.;
+  ASSERT_EQ(pose[1], 5.);
+
+  ASSERT_THROW(Pose(0).get_data_ref(), std::logic_error);
+}
+
 TEST_F(PoseTest, GetPoseAt) {
   for (int i = 0; i < pose1_->get_size(); ++i) {
     ASSERT_EQ((*pose1_)[i], 0);
@@ -286,6 +330,39 @@ TEST_F(PoseTest, Multiplication) {
   ASSERT_TRUE(empty_pose_mult2.IsEmpty());
 }
 
+TEST_F(PoseTest, LazyArithmetic) {
+  VectorXd p1(3), p2(3);
+  p1 << 1, 2, 3;
+  p2 << 4, -5, 6;
+
+  Pose pose1(p1);
+  Pose pose2(p2);
+
+  // The combination is only evaluated when it's assigned to a pose.
+  Pose pose3 = Lazy(pose1) + 2. * (Lazy(pose2) - Lazy(pose1)) * 0.5;
+  ASSERT_TRUE(pose3.get_data().isApprox(p2));
+
+  // The assigned pose may be a part of the expression.
+  pose3 = Lazy(pose1) - 3. * Lazy(pose3);
+  ASSERT_TRUE(pose3.get_data().isApprox(p1 - 3. * p2));
+  pose3 += 3. * Lazy(pose2);
+  ASSERT_TRUE(pose3.get_data().isApprox(p1));
+  pose3 -= Lazy(pose1) - Lazy(pose2);
+  ASSERT_TRUE(pose3.get_data().isApprox(p2));
+
+  // The evaluated pose is resized if required.
+  Pose pose4(1);
+  pose4 = Lazy(pose1) + Lazy(pose2);
+  ASSERT_TRUE(pose4.get_data().isApprox(p1 + p2));
+  ASSERT_EQ(pose4.get_size(), 3);
+
+  // Sizes are validated anywhere in the expression.
+  ASSERT_THROW(Lazy(pose1) + 2. * (Lazy(pose2) - Lazy(Pose(2))),
+               std::invalid_argument);
+  ASSERT_THROW(pose4 += Lazy(pose1) + Lazy(Pose(2)), std::invalid_argument);
+  ASSERT_THROW(pose4 -= 2. * Lazy(Pose(4)), std::invalid_argument);
+}
+
 TEST_F(PoseTest, Equality) {
   ASSERT_TRUE(Pose(3) == Pose(3));
   ASSERT_TRUE(Pose(3) == Pose(VectorXd::Zero(3)));
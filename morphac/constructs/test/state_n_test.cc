@@ -0,0 +1,136 @@
+#include "constructs/include/state_n.h"
+
+#include "Eigen/Dense"
+#include "gtest/gtest.h"
+
+namespace {
+
+using std::ostringstream;
+using std::srand;
+
+using Eigen::Vector2d;
+using Eigen::Vector3d;
+using Eigen::Vector4d;
+using Eigen::VectorXd;
+
+using morphac::constructs::State;
+using morphac::constructs::StateN;
+
+class StateNTest : public ::testing::Test {
+ protected:
+  StateNTest() {
+    // Set random seed for Eigen.
+    srand(7);
+  }
+
+  void SetUp() override {}
+};
+
+TEST_F(StateNTest, Construction) {
+  StateN<3, 0> state1;
+  StateN<2, 2> state2(Vector2d(1., 2.), Vector2d(3., 4.));
+  StateN<3, 0> state3(Vector3d(1., 2., 3.));
+
+  ASSERT_EQ(state1.get_pose_size(), 3);
+  ASSERT_EQ(state1.get_velocity_size(), 0);
+  ASSERT_EQ(state1.get_size(), 3);
+  ASSERT_TRUE(state1.get_data().isApprox(Vector3d::Zero()));
+
+  ASSERT_TRUE(state2.get_pose_data().isApprox(Vector2d(1., 2.)));
+  ASSERT_TRUE(state2.get_velocity_data().isApprox(Vector2d(3., 4.)));
+  ASSERT_TRUE(state2.get_data().isApprox(Vector4d(1., 2., 3., 4.)));
+
+  ASSERT_TRUE(state3.get_pose_data().isApprox(Vector3d(1., 2., 3.)));
+
+  // The static sizes are taken by reference here, which requires their
+  // definitions.
+  ASSERT_EQ((StateN<2, 1>::pose_size), 2);
+  ASSERT_EQ((StateN<2, 1>::velocity_size), 1);
+  ASSERT_EQ((StateN<2, 1>::size), 3);
+}
+
+TEST_F(StateNTest, Conversion) {
+  State state1({1., 2.}, {3., 4.});
+  State state2(2, 2);
+
+  StateN<2, 2> state_n(state1);
+  ASSERT_TRUE(state_n.get_data().isApprox(Vector4d(1., 2., 3., 4.)));
+  ASSERT_TRUE(state_n.ToState() == state1);
+
+  state_n.CopyTo(state2);
+  ASSERT_TRUE(state2 == state1);
+}
+
+TEST_F(StateNTest, InvalidConversion) {
+  State state(3, 1);
+
+  ASSERT_THROW((StateN<3, 0>(state)), std::invalid_argument);
+  ASSERT_THROW((StateN<2, 2>(state)), std::invalid_argument);
+  ASSERT_THROW((StateN<3, 0>().CopyTo(state)), std::invalid_argument);
+}
+
+TEST_F(StateNTest, Arithmetic) {
+  Vector4d data1 = Vector4d::Random(), data2 = Vector4d::Random();
+  StateN<4, 0> state1(data1), state2(data2);
+
+  ASSERT_TRUE((state1 + state2).get_data().isApprox(data1 + data2));
+  ASSERT_TRUE((state1 - state2).get_data().isApprox(data1 - data2));
+  ASSERT_TRUE((state1 * 2.5).get_data().isApprox(data1 * 2.5));
+  ASSERT_TRUE((2.5 * state1).get_data().isApprox(data1 * 2.5));
+
+  state1 += state2;
+  ASSERT_TRUE(state1.get_data().isApprox(data1 + data2));
+  state1 -= state2;
+  ASSERT_TRUE(state1.get_data().isApprox(data1));
+  state1 *= -3.;
+  ASSERT_TRUE(state1.get_data().isApprox(-3. * data1));
+
+  // The results must match the dynamic State.
+  State dynamic_state1(VectorXd(data1), VectorXd::Zero(0));
+  State dynamic_state2(VectorXd(data2), VectorXd::Zero(0));
+  ASSERT_TRUE((StateN<4, 0>(data1) + StateN<4, 0>(data2)).ToState() ==
+              dynamic_state1 + dynamic_state2);
+}
+
+TEST_F(StateNTest, Equality) {
+  StateN<2, 1> state1(Vector2d(1., 2.), Eigen::Matrix<double, 1, 1>(3.));
+  StateN<2, 1> state2(state1);
+
+  ASSERT_TRUE(state1 == state2);
+  state2[2] = 4.;
+  ASSERT_TRUE(state1 != state2);
+}
+
+TEST_F(StateNTest, DataAccess) {
+  StateN<2, 1> state;
+
+  state[0] = 1.;
+  state.get_data_ref()(1) = 2.;
+  state.set_velocity_data(Eigen::Matrix<double, 1, 1>(3.));
+
+  ASSERT_EQ(state[0], 1.);
+  ASSERT_EQ(state[1], 2.);
+  ASSERT_EQ(state[2], 3.);
+
+  state.set_pose_data(Vector2d(5., 6.));
+  ASSERT_TRUE(state.get_data().isApprox(Vector3d(5., 6., 3.)));
+
+  ASSERT_THROW(state[-1], std::out_of_range);
+  ASSERT_THROW(state[3], std::out_of_range);
+}
+
+TEST_F(StateNTest, StringRepresentation) {
+  StateN<2, 1> state(Vector2d(1., 2.), Eigen::Matrix<double, 1, 1>(3.));
+
+  ostringstream os;
+  os << state;
+
+  ASSERT_EQ(os.str(), state.ToState().ToString());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -13,6 +13,7 @@ using std::unique_ptr;
 
 using Eigen::VectorXd;
 
+using morphac::constructs::Lazy;
 using morphac::constructs::Pose;
 using morphac::constructs::State;
 using morphac::constructs::Velocity;
@@ -56,6 +57,42 @@ TEST_F(StateTest, CopyAssignment) {
   ASSERT_TRUE(state3.get_data().isApprox(data));
 }
 
+TEST_F(StateTest, MoveConstructor) {
+  static_assert(std::is_nothrow_move_constructible<State>::value,
+                "State must be nothrow move constructible.");
+
+  VectorXd data = VectorXd::Random(10);
+  State state1(data.head(6), data.tail(4));
+  State state2(std::move(state1));
+
+  ASSERT_TRUE(state2.get_data().isApprox(data));
+  // The moved from state is left empty.
+  ASSERT_TRUE(state1.IsEmpty());
+}
+
+TEST_F(StateTest, MoveAssignment) {
+  static_assert(std::is_nothrow_move_assignable<State>::value,
+                "State must be nothrow move assignable.");
+
+  VectorXd data = VectorXd::Random(10);
+  State state1(data.head(6), data.tail(4));
+  State state2(3, 2);
+  state2 = std::move(state1);
+
+  ASSERT_TRUE(state2.get_data().isApprox(data));
+  ASSERT_TRUE(state1.IsEmpty());
+
+  // The moved from state can be assigned to again.
+  state1 = State(3, 2);
+  ASSERT_TRUE(state1.get_data().isApprox(VectorXd::Zero(5)));
+
+  // Vectors of states move their elements when they grow.
+  std::vector<State> states(4, state2);
+  const double* data_pointer = states[0].get_pose_data().data();
+  states.reserve(2 * states.capacity());
+  ASSERT_EQ(states[0].get_pose_data().data(), data_pointer);
+}
+
 TEST_F(StateTest, ConstState) {
   const State state(3, 3);
 
@@ -267,6 +304,26 @@ TEST_F(StateTest, GetVelocityData) {
   ASSERT_THROW(State(3, 0).get_velocity_data(), std::logic_error);
 }
 
+TEST_F(StateTest, GetDataRef) {
+  VectorXd pose_data = VectorXd::Random(3);
+  VectorXd velocity_data = VectorXd::Random(2);
+  State state(3, 2);
+
+  state.get_pose_data_ref() = pose_data;
+  state.get_velocity_data_ref() = velocity_data;
+  ASSERT_TRUE(state.get_pose_data().isApprox(pose_data));
+  ASSERT_TRUE(state.get_velocity_data().isApprox(velocity_data));
+
+  state.get_pose_data_ref()(2) = 5.;
+  state.get_velocity_data_ref()(0) = 6.;
+  ASSERT_EQ(state[2], 5.);
+  ASSERT_EQ(state[3], 6.);
+
+  // Partial states.
+  ASSERT_THROW(State(0, 3).get_pose_data_ref(), std::logic_error);
+  ASSERT_THROW(State(3, 0).get_velocity_data_ref(), std::logic_error);
+}
+
 TEST_F(StateTest, GetData) {
   ASSERT_TRUE(state1_->get_data().isApprox(VectorXd::Zero(5)));
   ASSERT_TRUE(state2_->get_data().isApprox(VectorXd::Zero(6)));
@@ -774,6 +831,55 @@ TEST_F(StateTest, PartialMultiplication) {
   ASSERT_TRUE((State({}, {1, 2, 3}) * 1.0).get_data().isApprox(res1));
 }
 
+TEST_F(StateTest, LazyArithmetic) {
+  VectorXd p1(3), p2(3), v1(2), v2(2);
+  p1 << 1, 2, 3;
+  p2 << 3, 2, 1;
+  v1 << -1, 0;
+  v2 << -2, 4;
+
+  State state1{p1, v1};
+  State state2{p2, v2};
+
+  // The combination is only evaluated when it's assigned to a state.
+  State state3 = Lazy(state1) + 0.5 * (Lazy(state1) - 2. * Lazy(state2)) +
+                 Lazy(state2) * 3.;
+  ASSERT_TRUE(state3.get_pose_data().isApprox(1.5 * p1 + 2. * p2));
+  ASSERT_TRUE(state3.get_velocity_data().isApprox(1.5 * v1 + 2. * v2));
+
+  // The assigned state may be a part of the expression.
+  state3 = Lazy(state3) - 2. * Lazy(state3) + Lazy(state1);
+  ASSERT_TRUE(state3.get_pose_data().isApprox(-0.5 * p1 - 2. * p2));
+  state3 += Lazy(state1) + Lazy(state2);
+  ASSERT_TRUE(state3.get_pose_data().isApprox(0.5 * p1 - p2));
+  state3 -= 0.5 * Lazy(state1);
+  ASSERT_TRUE(state3.get_pose_data().isApprox(-p2));
+  ASSERT_TRUE(state3.get_velocity_data().isApprox(-v2));
+
+  // The evaluated state is resized if required.
+  State state4(1, 1);
+  state4 = Lazy(state1) + Lazy(state2);
+  ASSERT_EQ(state4.get_pose_size(), 3);
+  ASSERT_EQ(state4.get_velocity_size(), 2);
+  ASSERT_TRUE(state4 == State(p1 + p2, v1 + v2));
+
+  // Partial states.
+  const State partial_state1({1, 2}, {});
+  const State partial_state2({3, 4}, {});
+  State state5 = Lazy(partial_state1) + 2. * Lazy(partial_state2);
+  ASSERT_TRUE(state5 == State({7, 10}, {}));
+  ASSERT_TRUE(state5.IsVelocityEmpty());
+
+  // Sizes are validated anywhere in the expression.
+  const State state6(3, 1);
+  const State state7(3, 0);
+  ASSERT_THROW(Lazy(state1) + 2. * (Lazy(state2) - Lazy(state6)),
+               std::invalid_argument);
+  ASSERT_THROW(state4 += Lazy(state1) + Lazy(state7), std::invalid_argument);
+  ASSERT_THROW(state5 -= 2. * Lazy(state1), std::invalid_argument);
+  ASSERT_TRUE(state5 == State({7, 10}, {}));
+}
+
 TEST_F(StateTest, Equality) {
   ASSERT_TRUE(State(3, 2) == State(3, 2));
   ASSERT_TRUE(State(3, 2) == State(VectorXd::Zero(3), VectorXd::Zero(2)));
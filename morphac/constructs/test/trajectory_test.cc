@@ -1,19 +1,28 @@
 #include "constructs/include/trajectory.h"
 
+#include <numeric>
+#include <thread>
+
 #include "Eigen/Dense"
 #include "gtest/gtest.h"
 
 namespace {
 
+using std::iota;
 using std::make_unique;
+using std::min;
 using std::ostringstream;
 using std::srand;
+using std::thread;
 using std::unique_ptr;
 using std::vector;
 
 using Eigen::MatrixXd;
 using Eigen::VectorXd;
 
+using morphac::common::aliases::Point;
+using morphac::constructs::InterpolationType;
+using morphac::constructs::PathPoint;
 using morphac::constructs::State;
 using morphac::constructs::Trajectory;
 
@@ -76,6 +85,49 @@ TEST_F(TrajectoryTest, CopyAssignment) {
   ASSERT_TRUE(trajectory4.get_data().isApprox(trajectory4_->get_data()));
 }
 
+TEST_F(TrajectoryTest, MoveConstructor) {
+  static_assert(std::is_nothrow_move_constructible<Trajectory>::value,
+                "Trajectory must be nothrow move constructible.");
+
+  Trajectory trajectory1(*trajectory4_);
+  const double* data_pointer = trajectory1.get_data().data();
+  Trajectory trajectory2(std::move(trajectory1));
+
+  // The data is moved and not copied.
+  ASSERT_TRUE(trajectory2 == *trajectory4_);
+  ASSERT_EQ(trajectory2.get_data().data(), data_pointer);
+
+  // The moved from trajectory is left without any knot points, but with the
+  // same dimensions.
+  ASSERT_EQ(trajectory1.get_size(), 0);
+  ASSERT_EQ(trajectory1.get_pose_size(), trajectory4_->get_pose_size());
+  ASSERT_EQ(trajectory1.get_velocity_size(),
+            trajectory4_->get_velocity_size());
+  trajectory1.AddKnotPoint(trajectory4_->get_knot_point(0));
+  ASSERT_EQ(trajectory1.get_size(), 1);
+}
+
+TEST_F(TrajectoryTest, MoveAssignment) {
+  static_assert(std::is_nothrow_move_assignable<Trajectory>::value,
+                "Trajectory must be nothrow move assignable.");
+
+  Trajectory trajectory1(*trajectory4_);
+  vector<double> timestamps;
+  for (int i = 0; i < trajectory1.get_size(); ++i) {
+    timestamps.push_back(i);
+  }
+  trajectory1.set_timestamps(timestamps);
+  Trajectory trajectory2(*trajectory1_);
+  trajectory2 = std::move(trajectory1);
+
+  ASSERT_EQ(trajectory2.get_size(), trajectory4_->get_size());
+  ASSERT_TRUE(trajectory2.get_data().isApprox(trajectory4_->get_data()));
+  ASSERT_TRUE(trajectory2.HasTimestamps());
+
+  ASSERT_EQ(trajectory1.get_size(), 0);
+  ASSERT_FALSE(trajectory1.HasTimestamps());
+}
+
 TEST_F(TrajectoryTest, InvalidConstruction) {
   // The following ways of construction must throw an exception.
   // Constructing with an empty state.
@@ -116,7 +168,7 @@ TEST_F(TrajectoryTest, ConstTrajectory) {
   ASSERT_TRUE(trajectory.get_data().isApprox(data.transpose()));
 
   // Positional accessing.
-  ASSERT_EQ(trajectory[0], state);
+  ASSERT_EQ(trajectory.get_knot_point(0), state);
 
   // After const casting, we should be able to modify the data.
   MatrixXd new_data = MatrixXd::Random(100, 4);
@@ -194,11 +246,13 @@ TEST_F(TrajectoryTest, InvalidSetData) {
 }
 
 TEST_F(TrajectoryTest, GetKnotPointAt) {
-  // Tests the () overload.
-  ASSERT_EQ((*trajectory1_)[0], State(3, 2));
+  ASSERT_EQ(trajectory1_->get_knot_point(0), State(3, 2));
 
   for (int i = 0; i < trajectory2_->get_size(); ++i) {
-    ASSERT_EQ((*trajectory2_)[i], knot_points_.at(i));
+    ASSERT_EQ(trajectory2_->get_knot_point(i), knot_points_.at(i));
+    // The [] operator returns a view of the knot point data.
+    ASSERT_TRUE((*trajectory2_)[i].isApprox(
+        knot_points_.at(i).get_data().transpose()));
   }
 
   for (int i = 0; i < trajectory3_->get_size(); ++i) {
@@ -206,7 +260,7 @@ TEST_F(TrajectoryTest, GetKnotPointAt) {
         trajectory3_->get_data().row(i).head(trajectory3_->get_pose_size());
     VectorXd velocity_data =
         trajectory3_->get_data().row(i).tail(trajectory3_->get_velocity_size());
-    ASSERT_EQ((*trajectory3_)[i], State(pose_data, velocity_data));
+    ASSERT_EQ(trajectory3_->get_knot_point(i), State(pose_data, velocity_data));
   }
 
   for (int i = 0; i < trajectory4_->get_size(); ++i) {
@@ -214,7 +268,7 @@ TEST_F(TrajectoryTest, GetKnotPointAt) {
         trajectory4_->get_data().row(i).head(trajectory4_->get_pose_size());
     VectorXd velocity_data =
         trajectory4_->get_data().row(i).tail(trajectory4_->get_velocity_size());
-    ASSERT_EQ((*trajectory4_)[i], State(pose_data, velocity_data));
+    ASSERT_EQ(trajectory4_->get_knot_point(i), State(pose_data, velocity_data));
   }
 }
 
@@ -229,12 +283,12 @@ TEST_F(TrajectoryTest, GetKnotPointAtAfterSetData) {
         trajectory1_->get_data().row(i).head(trajectory1_->get_pose_size());
     VectorXd velocity_data =
         trajectory1_->get_data().row(i).tail(trajectory1_->get_velocity_size());
-    ASSERT_EQ((*trajectory1_)[i], State(pose_data, velocity_data));
+    ASSERT_EQ(trajectory1_->get_knot_point(i), State(pose_data, velocity_data));
   }
 }
 
 TEST_F(TrajectoryTest, InvalidGetKnotPointAt) {
-  // Calling the () overload with out of bounds indices must throw an exception.
+  // Calling the [] overload with out of bounds indices must throw an exception.
   ASSERT_THROW((*trajectory1_)[-1], std::out_of_range);
   ASSERT_THROW((*trajectory1_)[1], std::out_of_range);
   ASSERT_THROW((*trajectory2_)[-1], std::out_of_range);
@@ -243,17 +297,75 @@ TEST_F(TrajectoryTest, InvalidGetKnotPointAt) {
   ASSERT_THROW((*trajectory3_)[10], std::out_of_range);
   ASSERT_THROW((*trajectory4_)[-1], std::out_of_range);
   ASSERT_THROW((*trajectory4_)[200], std::out_of_range);
+  ASSERT_THROW(trajectory1_->get_knot_point(-1), std::out_of_range);
+  ASSERT_THROW(trajectory4_->get_knot_point(200), std::out_of_range);
 }
 
 TEST_F(TrajectoryTest, SetKnotPointAt) {
-  // Test that the () overload can be used for setting.
-  (*trajectory1_)[0] = State({1, 1, 1}, {1, 1});
+  trajectory1_->set_knot_point(0, State({1, 1, 1}, {1, 1}));
   ASSERT_TRUE(trajectory1_->get_data().isApprox(MatrixXd::Ones(1, 5)));
 
   for (int i = 0; i < trajectory4_->get_size(); ++i) {
-    (*trajectory4_)[i] = State({0, 0, 0, 0}, {0, 0});
+    trajectory4_->set_knot_point(i, State({0, 0, 0, 0}, {0, 0}));
   }
   ASSERT_TRUE(trajectory4_->get_data().isApprox(MatrixXd::Zero(200, 6)));
+
+  // The [] operator views reflect the new knot points.
+  trajectory2_->set_knot_point(1, State({1, 1}, {1}));
+  ASSERT_TRUE((*trajectory2_)[1].isApprox(VectorXd::Ones(3).transpose()));
+}
+
+TEST_F(TrajectoryTest, InvalidSetKnotPointAt) {
+  ASSERT_THROW(trajectory1_->set_knot_point(1, State(3, 2)),
+               std::out_of_range);
+  ASSERT_THROW(trajectory2_->set_knot_point(-1, State(2, 1)),
+               std::out_of_range);
+  ASSERT_THROW(trajectory1_->set_knot_point(0, State(2, 3)),
+               std::invalid_argument);
+  ASSERT_THROW(trajectory2_->set_knot_point(0, State(2, 2)),
+               std::invalid_argument);
+}
+
+TEST_F(TrajectoryTest, DataView) {
+  // The data is a view of the underlying storage, so it doesn't copy the data
+  // and reflects any changes to the knot points.
+  auto data = trajectory4_->get_data();
+  ASSERT_EQ(data.data(), trajectory4_->get_data().data());
+  ASSERT_EQ(data.data(), (*trajectory4_)[0].data());
+  // The knot points are contiguous.
+  ASSERT_EQ(data.data() + 6, (*trajectory4_)[1].data());
+
+  trajectory4_->set_knot_point(3, State({1, 2, 3, 4}, {5, 6}));
+  ASSERT_TRUE(data.row(3).isApprox(
+      (VectorXd(6) << 1, 2, 3, 4, 5, 6).finished().transpose()));
+}
+
+TEST_F(TrajectoryTest, Capacity) {
+  ASSERT_EQ(trajectory1_->get_capacity(), 1);
+  ASSERT_EQ(trajectory4_->get_capacity(), 200);
+
+  // Adding knot points grows the capacity geometrically, so that most of the
+  // additions don't reallocate.
+  int num_reallocations = 0;
+  for (int i = 0; i < 1000; ++i) {
+    const int capacity = trajectory1_->get_capacity();
+    trajectory1_->AddKnotPoint(State({1, 2, 3}, {4, 0.5 * i}));
+    if (trajectory1_->get_capacity() != capacity) {
+      ++num_reallocations;
+    }
+    ASSERT_GE(trajectory1_->get_capacity(), trajectory1_->get_size());
+  }
+  ASSERT_EQ(trajectory1_->get_size(), 1001);
+  ASSERT_LE(num_reallocations, 10);
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(trajectory1_->get_knot_point(i + 1),
+              State({1, 2, 3}, {4, 0.5 * i}));
+  }
+
+  // Removing knot points doesn't change the capacity.
+  const int capacity = trajectory1_->get_capacity();
+  trajectory1_->RemoveKnotPoint(0);
+  ASSERT_EQ(trajectory1_->get_capacity(), capacity);
 }
 
 TEST_F(TrajectoryTest, Addition) {
@@ -358,10 +470,10 @@ TEST_F(TrajectoryTest, AddKnotPoint) {
   trajectory1_->AddKnotPoint(State({3, 3, 3}, {3, 3}), 3);
 
   ASSERT_EQ(trajectory1_->get_size(), 4);
-  ASSERT_EQ((*trajectory1_)[0], State({1, 1, 1}, {1, 1}));
-  ASSERT_EQ((*trajectory1_)[1], State({2, 2, 2}, {2, 2}));
-  ASSERT_EQ((*trajectory1_)[2], State({0, 0, 0}, {0, 0}));
-  ASSERT_EQ((*trajectory1_)[3], State({3, 3, 3}, {3, 3}));
+  ASSERT_EQ(trajectory1_->get_knot_point(0), State({1, 1, 1}, {1, 1}));
+  ASSERT_EQ(trajectory1_->get_knot_point(1), State({2, 2, 2}, {2, 2}));
+  ASSERT_EQ(trajectory1_->get_knot_point(2), State({0, 0, 0}, {0, 0}));
+  ASSERT_EQ(trajectory1_->get_knot_point(3), State({3, 3, 3}, {3, 3}));
 
   // Testing on a trajectory with size > 1.
   // Add a point in the middle of the trajectory.
@@ -369,7 +481,7 @@ TEST_F(TrajectoryTest, AddKnotPoint) {
 
   // Test that the point has been added correctly.
   ASSERT_EQ(trajectory4_->get_size(), 201);
-  ASSERT_EQ((*trajectory4_)[99], State({1, 2, 3, 4}, {5, 6}));
+  ASSERT_EQ(trajectory4_->get_knot_point(99), State({1, 2, 3, 4}, {5, 6}));
   // Making sure that the rest of the data has not been affected and is ordered
   // correctly.
   ASSERT_TRUE(trajectory4_->get_data()
@@ -382,8 +494,8 @@ TEST_F(TrajectoryTest, AddKnotPoint) {
   // Adding a knot point at the start of the trajectory.
   trajectory4_->AddKnotPoint(State(4, 2), 0);
   ASSERT_EQ(trajectory4_->get_size(), 202);
-  ASSERT_EQ((*trajectory4_)[0], State({0, 0, 0, 0}, {0, 0}));
-  ASSERT_EQ((*trajectory4_)[100], State({1, 2, 3, 4}, {5, 6}));
+  ASSERT_EQ(trajectory4_->get_knot_point(0), State({0, 0, 0, 0}, {0, 0}));
+  ASSERT_EQ(trajectory4_->get_knot_point(100), State({1, 2, 3, 4}, {5, 6}));
   ASSERT_TRUE(trajectory4_->get_data()
                   .block(1, 0, 99, 6)
                   .isApprox(trajectory_data2_.block(0, 0, 99, 6)));
@@ -395,9 +507,9 @@ TEST_F(TrajectoryTest, AddKnotPoint) {
   // doesn't take in an index.
   trajectory4_->AddKnotPoint(State({1, 1, 1, 1}, {1, 1}));
   ASSERT_EQ(trajectory4_->get_size(), 203);
-  ASSERT_EQ((*trajectory4_)[0], State({0, 0, 0, 0}, {0, 0}));
-  ASSERT_EQ((*trajectory4_)[100], State({1, 2, 3, 4}, {5, 6}));
-  ASSERT_EQ((*trajectory4_)[202], State({1, 1, 1, 1}, {1, 1}));
+  ASSERT_EQ(trajectory4_->get_knot_point(0), State({0, 0, 0, 0}, {0, 0}));
+  ASSERT_EQ(trajectory4_->get_knot_point(100), State({1, 2, 3, 4}, {5, 6}));
+  ASSERT_EQ(trajectory4_->get_knot_point(202), State({1, 1, 1, 1}, {1, 1}));
   ASSERT_TRUE(trajectory4_->get_data()
                   .block(1, 0, 99, 6)
                   .isApprox(trajectory_data2_.block(0, 0, 99, 6)));
@@ -406,6 +518,20 @@ TEST_F(TrajectoryTest, AddKnotPoint) {
                   .isApprox(trajectory_data2_.block(99, 0, 101, 6)));
 }
 
+TEST_F(TrajectoryTest, AddPoseOnlyKnotPoint) {
+  // Knot points without a velocity component.
+  Trajectory trajectory(State({1., 2.}, {}));
+  trajectory.AddKnotPoint(State({3., 4.}, {}), 0);
+  trajectory.AddKnotPoint(State({5., 6.}, {}));
+  trajectory.AddKnotPoint(State({7., 8.}, {}), 1);
+
+  MatrixXd expected_data(4, 2);
+  expected_data << 3., 4., 7., 8., 1., 2., 5., 6.;
+  ASSERT_EQ(trajectory.get_size(), 4);
+  ASSERT_TRUE(trajectory.get_data().isApprox(expected_data));
+  ASSERT_EQ(trajectory.get_knot_point(1), State({7., 8.}, {}));
+}
+
 TEST_F(TrajectoryTest, InvalidAddKnotPoint) {
   // The function is invalid either if the state or the index is invalid.
   // Invalid state.
@@ -440,37 +566,37 @@ TEST_F(TrajectoryTest, AddKnotPoints) {
 
   // Making sure that the knot points are ordered correctly.
   ASSERT_EQ(trajectory2_copy1.get_size(), 7);
-  ASSERT_EQ(trajectory2_copy1[0], state1);
-  ASSERT_EQ(trajectory2_copy1[1], knot_points_.at(0));
-  ASSERT_EQ(trajectory2_copy1[2], state2);
-  ASSERT_EQ(trajectory2_copy1[3], knot_points_.at(1));
-  ASSERT_EQ(trajectory2_copy1[4], state3);
-  ASSERT_EQ(trajectory2_copy1[5], knot_points_.at(2));
-  ASSERT_EQ(trajectory2_copy1[6], state4);
+  ASSERT_EQ(trajectory2_copy1.get_knot_point(0), state1);
+  ASSERT_EQ(trajectory2_copy1.get_knot_point(1), knot_points_.at(0));
+  ASSERT_EQ(trajectory2_copy1.get_knot_point(2), state2);
+  ASSERT_EQ(trajectory2_copy1.get_knot_point(3), knot_points_.at(1));
+  ASSERT_EQ(trajectory2_copy1.get_knot_point(4), state3);
+  ASSERT_EQ(trajectory2_copy1.get_knot_point(5), knot_points_.at(2));
+  ASSERT_EQ(trajectory2_copy1.get_knot_point(6), state4);
 
   // Making sure that we get the same result even if the indices are not
   // ordered.
   trajectory2_copy2.AddKnotPoints(knot_points, indices2);
 
   ASSERT_EQ(trajectory2_copy2.get_size(), 7);
-  ASSERT_EQ(trajectory2_copy2[0], state1);
-  ASSERT_EQ(trajectory2_copy2[1], knot_points_.at(0));
-  ASSERT_EQ(trajectory2_copy2[2], state2);
-  ASSERT_EQ(trajectory2_copy2[3], knot_points_.at(1));
-  ASSERT_EQ(trajectory2_copy2[4], state3);
-  ASSERT_EQ(trajectory2_copy2[5], knot_points_.at(2));
-  ASSERT_EQ(trajectory2_copy2[6], state4);
+  ASSERT_EQ(trajectory2_copy2.get_knot_point(0), state1);
+  ASSERT_EQ(trajectory2_copy2.get_knot_point(1), knot_points_.at(0));
+  ASSERT_EQ(trajectory2_copy2.get_knot_point(2), state2);
+  ASSERT_EQ(trajectory2_copy2.get_knot_point(3), knot_points_.at(1));
+  ASSERT_EQ(trajectory2_copy2.get_knot_point(4), state3);
+  ASSERT_EQ(trajectory2_copy2.get_knot_point(5), knot_points_.at(2));
+  ASSERT_EQ(trajectory2_copy2.get_knot_point(6), state4);
 
   trajectory2_copy3.AddKnotPoints(knot_points, indices3);
 
   ASSERT_EQ(trajectory2_copy3.get_size(), 7);
-  ASSERT_EQ(trajectory2_copy3[0], state1);
-  ASSERT_EQ(trajectory2_copy3[1], knot_points_.at(0));
-  ASSERT_EQ(trajectory2_copy3[2], state2);
-  ASSERT_EQ(trajectory2_copy3[3], knot_points_.at(1));
-  ASSERT_EQ(trajectory2_copy3[4], state3);
-  ASSERT_EQ(trajectory2_copy3[5], knot_points_.at(2));
-  ASSERT_EQ(trajectory2_copy3[6], state4);
+  ASSERT_EQ(trajectory2_copy3.get_knot_point(0), state1);
+  ASSERT_EQ(trajectory2_copy3.get_knot_point(1), knot_points_.at(0));
+  ASSERT_EQ(trajectory2_copy3.get_knot_point(2), state2);
+  ASSERT_EQ(trajectory2_copy3.get_knot_point(3), knot_points_.at(1));
+  ASSERT_EQ(trajectory2_copy3.get_knot_point(4), state3);
+  ASSERT_EQ(trajectory2_copy3.get_knot_point(5), knot_points_.at(2));
+  ASSERT_EQ(trajectory2_copy3.get_knot_point(6), state4);
 }
 
 TEST_F(TrajectoryTest, InvalidAddKnotPoints) {
@@ -509,6 +635,121 @@ TEST_F(TrajectoryTest, InvalidAddKnotPoints) {
                std::out_of_range);
   ASSERT_THROW(trajectory2_copy5.AddKnotPoints(knot_points, indices3),
                std::out_of_range);
+
+  // The indices must be unique.
+  ASSERT_THROW(
+      trajectory2_copy1.AddKnotPoints(knot_points, vector<int>{0, 2, 2, 4}),
+      std::invalid_argument);
+
+  // The trajectory must not be modified if any of the arguments are invalid.
+  ASSERT_EQ(trajectory2_copy1, *trajectory2_);
+  ASSERT_EQ(trajectory2_copy2, *trajectory2_);
+  ASSERT_EQ(trajectory2_copy3, *trajectory2_);
+  ASSERT_EQ(trajectory2_copy4, *trajectory2_);
+  ASSERT_EQ(trajectory2_copy5, *trajectory2_);
+}
+
+TEST_F(TrajectoryTest, BulkAddKnotPoints) {
+  // The bulk insertion must match inserting the knot points one at a time in
+  // ascending order of the indices.
+  Trajectory trajectory{*trajectory4_};
+  Trajectory expected_trajectory{*trajectory4_};
+
+  vector<State> knot_points;
+  vector<int> indices;
+  for (int i = 0; i < 100; ++i) {
+    knot_points.push_back(State(VectorXd::Random(4), VectorXd::Random(2)));
+    // Runs of consecutive indices along with isolated ones, including the
+    // start and the end of the resulting trajectory.
+    indices.push_back(i < 50 ? i : 3 * i);
+  }
+  indices.back() = 299;
+
+  trajectory.AddKnotPoints(knot_points, indices);
+  for (unsigned int i = 0; i < knot_points.size(); ++i) {
+    expected_trajectory.AddKnotPoint(knot_points.at(i), indices.at(i));
+  }
+
+  ASSERT_EQ(trajectory.get_size(), 300);
+  ASSERT_TRUE(trajectory.get_data().isApprox(expected_trajectory.get_data()));
+}
+
+TEST_F(TrajectoryTest, PoseOnlyKnotPoints) {
+  // Knot points without a velocity component.
+  Trajectory trajectory(State({1., 2.}, {}));
+  trajectory.AddKnotPoint(State({3., 4.}, {}), 0);
+  trajectory.AppendKnotPoints({State({5., 6.}, {})});
+  trajectory.set_knot_point(1, State({7., 8.}, {}));
+
+  MatrixXd expected_data(3, 2);
+  expected_data << 3., 4., 7., 8., 5., 6.;
+  ASSERT_TRUE(trajectory.get_data().isApprox(expected_data));
+  ASSERT_TRUE(Trajectory({State({3., 4.}, {}), State({7., 8.}, {}),
+                          State({5., 6.}, {})}) == trajectory);
+}
+
+TEST_F(TrajectoryTest, AppendKnotPoints) {
+  vector<State> knot_points{State({1., 1.}, {1.}), State({2., 2.}, {2.})};
+  trajectory2_->AppendKnotPoints(knot_points);
+
+  ASSERT_EQ(trajectory2_->get_size(), 5);
+  ASSERT_EQ(trajectory2_->get_knot_point(2), knot_points_.at(2));
+  ASSERT_EQ(trajectory2_->get_knot_point(3), knot_points.at(0));
+  ASSERT_EQ(trajectory2_->get_knot_point(4), knot_points.at(1));
+
+  // Appending data.
+  MatrixXd data = MatrixXd::Random(1000, 6);
+  trajectory4_->AppendKnotPoints(data);
+
+  ASSERT_EQ(trajectory4_->get_size(), 1200);
+  ASSERT_TRUE(
+      trajectory4_->get_data().topRows(200).isApprox(trajectory_data2_));
+  ASSERT_TRUE(trajectory4_->get_data().bottomRows(1000).isApprox(data));
+
+  // Appending nothing.
+  trajectory4_->AppendKnotPoints(vector<State>{});
+  trajectory4_->AppendKnotPoints(MatrixXd::Zero(0, 6));
+  ASSERT_EQ(trajectory4_->get_size(), 1200);
+}
+
+TEST_F(TrajectoryTest, InvalidAppendKnotPoints) {
+  ASSERT_THROW(trajectory2_->AppendKnotPoints(
+                   vector<State>{State({1., 1.}, {1.}), State(3, 0)}),
+               std::invalid_argument);
+  ASSERT_THROW(trajectory2_->AppendKnotPoints(MatrixXd::Zero(10, 4)),
+               std::invalid_argument);
+
+  // The trajectory must not be modified.
+  ASSERT_EQ(trajectory2_->get_size(), 3);
+}
+
+TEST_F(TrajectoryTest, Reserve) {
+  trajectory2_->Reserve(100);
+  ASSERT_EQ(trajectory2_->get_capacity(), 100);
+  ASSERT_EQ(trajectory2_->get_size(), 3);
+
+  // The capacity never shrinks on reserving.
+  trajectory2_->Reserve(10);
+  ASSERT_EQ(trajectory2_->get_capacity(), 100);
+
+  // Adding knot points within the capacity doesn't reallocate.
+  const double* data = trajectory2_->get_data().data();
+  for (int i = 0; i < 97; ++i) {
+    trajectory2_->AddKnotPoint(State({1., 1.}, {1.}));
+  }
+  ASSERT_EQ(trajectory2_->get_data().data(), data);
+  ASSERT_EQ(trajectory2_->get_capacity(), 100);
+
+  // Releasing the unused capacity.
+  trajectory2_->RemoveKnotPoints(vector<int>{3, 4, 5, 6, 7});
+  trajectory2_->ShrinkToFit();
+  ASSERT_EQ(trajectory2_->get_capacity(), 95);
+  ASSERT_EQ(trajectory2_->get_size(), 95);
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(trajectory2_->get_knot_point(i), knot_points_.at(i));
+  }
+
+  ASSERT_THROW(trajectory2_->Reserve(-1), std::invalid_argument);
 }
 
 TEST_F(TrajectoryTest, RemoveKnotPoint) {
@@ -566,12 +807,12 @@ TEST_F(TrajectoryTest, RemoveKnotPoints) {
 
   trajectory2_copy1.RemoveKnotPoints(indices1);
   ASSERT_EQ(trajectory2_copy1.get_size(), 1);
-  ASSERT_EQ(trajectory2_copy1[0], knot_points_.at(1));
+  ASSERT_EQ(trajectory2_copy1.get_knot_point(0), knot_points_.at(1));
 
   // Making sure that it works even if the indices are not ordered.
   trajectory2_copy2.RemoveKnotPoints(indices2);
   ASSERT_EQ(trajectory2_copy2.get_size(), 1);
-  ASSERT_EQ(trajectory2_copy2[0], knot_points_.at(1));
+  ASSERT_EQ(trajectory2_copy2.get_knot_point(0), knot_points_.at(1));
 
   // Testing the same on a bigger trajectory.
   trajectory4_->RemoveKnotPoints(vector<int>{0, 99, 199});
@@ -600,6 +841,471 @@ TEST_F(TrajectoryTest, InvalidRemoveKnotPoints) {
                std::out_of_range);
   ASSERT_THROW(trajectory4_copy2.RemoveKnotPoints(vector<int>{100, 200}),
                std::out_of_range);
+
+  // The indices must be unique.
+  ASSERT_THROW(trajectory4_copy1.RemoveKnotPoints(vector<int>{0, 10, 10}),
+               std::invalid_argument);
+
+  // The trajectory must not be modified if any of the indices are invalid.
+  ASSERT_EQ(trajectory2_copy1, *trajectory2_);
+  ASSERT_EQ(trajectory2_copy2, *trajectory2_);
+  ASSERT_EQ(trajectory4_copy1, *trajectory4_);
+  ASSERT_EQ(trajectory4_copy2, *trajectory4_);
+}
+
+TEST_F(TrajectoryTest, BulkRemoveKnotPoints) {
+  // The bulk removal must match removing the knot points one at a time in
+  // descending order of the indices.
+  Trajectory expected_trajectory{*trajectory4_};
+
+  vector<int> indices;
+  for (int i = 0; i < 200; ++i) {
+    // Runs of consecutive indices along with isolated ones.
+    if (i < 20 || i % 7 == 0 || i > 190) {
+      indices.push_back(i);
+    }
+  }
+
+  trajectory4_->RemoveKnotPoints(indices);
+  for (auto it = indices.rbegin(); it != indices.rend(); ++it) {
+    expected_trajectory.RemoveKnotPoint(*it);
+  }
+
+  ASSERT_EQ(trajectory4_->get_size(), expected_trajectory.get_size());
+  ASSERT_TRUE(
+      trajectory4_->get_data().isApprox(expected_trajectory.get_data()));
+
+  // Removing all of the knot points.
+  vector<int> all_indices(trajectory4_->get_size());
+  iota(all_indices.begin(), all_indices.end(), 0);
+  trajectory4_->RemoveKnotPoints(all_indices);
+  ASSERT_EQ(trajectory4_->get_size(), 0);
+}
+
+TEST_F(TrajectoryTest, Timestamps) {
+  ASSERT_FALSE(trajectory2_->HasTimestamps());
+  ASSERT_TRUE(trajectory2_->get_timestamps().empty());
+
+  trajectory2_->set_timestamps({0., 0.5, 2.});
+  ASSERT_TRUE(trajectory2_->HasTimestamps());
+  ASSERT_EQ(trajectory2_->get_timestamps(), vector<double>({0., 0.5, 2.}));
+
+  // Timed trajectories are only equal to timed trajectories.
+  Trajectory trajectory2(knot_points_);
+  ASSERT_TRUE(*trajectory2_ != trajectory2);
+  trajectory2.set_timestamps({0., 0.5, 2.});
+  ASSERT_TRUE(*trajectory2_ == trajectory2);
+  trajectory2.set_timestamps({0., 1., 2.});
+  ASSERT_TRUE(*trajectory2_ != trajectory2);
+
+  // Removing knot points removes their timestamps.
+  trajectory2_->RemoveKnotPoint(1);
+  ASSERT_EQ(trajectory2_->get_timestamps(), vector<double>({0., 2.}));
+  trajectory2.RemoveKnotPoints({0, 2});
+  ASSERT_EQ(trajectory2.get_timestamps(), vector<double>({1.}));
+
+  // Appending with timestamps.
+  trajectory2_->AppendKnotPoints({State({1., 1.}, {1.})}, {3.});
+  trajectory2_->AppendKnotPoints(MatrixXd::Zero(2, 3), {4., 5.});
+  ASSERT_EQ(trajectory2_->get_size(), 5);
+  ASSERT_EQ(trajectory2_->get_timestamps(),
+            vector<double>({0., 2., 3., 4., 5.}));
+
+  // Extending with a timed trajectory.
+  Trajectory trajectory3(State({1., 1.}, {1.}));
+  trajectory3.set_timestamps({6.});
+  *trajectory2_ += trajectory3;
+  ASSERT_EQ(trajectory2_->get_size(), 6);
+  ASSERT_EQ(trajectory2_->get_timestamps(),
+            vector<double>({0., 2., 3., 4., 5., 6.}));
+
+  trajectory2_->ClearTimestamps();
+  ASSERT_FALSE(trajectory2_->HasTimestamps());
+  trajectory2_->AddKnotPoint(State({1., 1.}, {1.}), 0);
+  ASSERT_EQ(trajectory2_->get_size(), 7);
+}
+
+TEST_F(TrajectoryTest, InvalidTimestamps) {
+  // Wrong number of timestamps.
+  ASSERT_THROW(trajectory2_->set_timestamps({0., 1.}), std::invalid_argument);
+  ASSERT_THROW(trajectory2_->set_timestamps({}), std::invalid_argument);
+
+  // Timestamps that are not strictly increasing.
+  ASSERT_THROW(trajectory2_->set_timestamps({0., 1., 1.}),
+               std::invalid_argument);
+  ASSERT_THROW(trajectory2_->set_timestamps({0., 2., 1.}),
+               std::invalid_argument);
+
+  // Timed knot points can't be added to untimed trajectories.
+  ASSERT_THROW(trajectory2_->AppendKnotPoints({State({1., 1.}, {1.})}, {3.}),
+               std::logic_error);
+
+  // Untimed knot points can't be added to timed trajectories.
+  trajectory2_->set_timestamps({0., 1., 2.});
+  Trajectory trajectory2 = *trajectory2_;
+  ASSERT_THROW(trajectory2_->AddKnotPoint(State({1., 1.}, {1.})),
+               std::logic_error);
+  ASSERT_THROW(trajectory2_->AddKnotPoints({State({1., 1.}, {1.})}, {0}),
+               std::logic_error);
+  ASSERT_THROW(trajectory2_->AppendKnotPoints(MatrixXd::Zero(2, 3)),
+               std::logic_error);
+  ASSERT_THROW(trajectory2_->set_data(MatrixXd::Zero(2, 3)), std::logic_error);
+  ASSERT_THROW(*trajectory2_ += Trajectory(knot_points_), std::logic_error);
+
+  // Timestamps must come after the existing ones.
+  ASSERT_THROW(trajectory2_->AppendKnotPoints({State({1., 1.}, {1.})}, {2.}),
+               std::invalid_argument);
+  ASSERT_THROW(trajectory2_->AppendKnotPoints(MatrixXd::Zero(2, 3), {3., 3.}),
+               std::invalid_argument);
+  ASSERT_THROW(trajectory2_->AppendKnotPoints(MatrixXd::Zero(2, 3), {3.}),
+               std::invalid_argument);
+  ASSERT_THROW(*trajectory2_ += *trajectory2_, std::invalid_argument);
+
+  // The trajectory must be unmodified. Data of the same size keeps the
+  // timestamps.
+  ASSERT_TRUE(*trajectory2_ == trajectory2);
+  trajectory2_->set_data(MatrixXd::Zero(3, 3));
+  ASSERT_TRUE(trajectory2_->HasTimestamps());
+}
+
+TEST_F(TrajectoryTest, AngleIndices) {
+  ASSERT_TRUE(trajectory2_->get_angle_indices().empty());
+  trajectory2_->set_angle_indices({2});
+  ASSERT_EQ(trajectory2_->get_angle_indices(), vector<int>({2}));
+
+  ASSERT_THROW(trajectory2_->set_angle_indices({3}), std::out_of_range);
+  ASSERT_THROW(trajectory2_->set_angle_indices({-1}), std::out_of_range);
+}
+
+TEST_F(TrajectoryTest, LinearSample) {
+  trajectory2_->set_timestamps({0., 0.5, 2.});
+
+  ASSERT_TRUE(trajectory2_->Sample(0.) == knot_points_.at(0));
+  ASSERT_TRUE(trajectory2_->Sample(0.5) == knot_points_.at(1));
+  ASSERT_TRUE(trajectory2_->Sample(2.) == knot_points_.at(2));
+  ASSERT_TRUE(trajectory2_->Sample(0.25) == State({-3., 1.}, {1.5}));
+  ASSERT_TRUE(trajectory2_->Sample(1.25) == State({-1.5, 3.}, {5.5}));
+
+  // Times outside of the trajectory are clamped.
+  ASSERT_TRUE(trajectory2_->Sample(-1.) == knot_points_.at(0));
+  ASSERT_TRUE(trajectory2_->Sample(10.) == knot_points_.at(2));
+
+  // In place sampling.
+  State sample(2, 1);
+  trajectory2_->Sample(0.875, sample, InterpolationType::kLinear);
+  ASSERT_TRUE(sample == State({-4.25, 1.5}, {4.25}));
+
+  // A single knot point is held.
+  Trajectory trajectory(State({1., 2.}, {3.}));
+  trajectory.set_timestamps({1.});
+  ASSERT_TRUE(trajectory.Sample(0.) == State({1., 2.}, {3.}));
+  ASSERT_TRUE(trajectory.Sample(5.) == State({1., 2.}, {3.}));
+}
+
+TEST_F(TrajectoryTest, HermiteSample) {
+  // The knot points lie on a straight line with uniform timestamps, so the
+  // Hermite interpolation must be linear as well.
+  Trajectory trajectory(MatrixXd::Zero(5, 2), 1, 1);
+  for (int i = 0; i < 5; ++i) {
+    trajectory.set_knot_point(i, State({2. * i}, {-1. * i}));
+  }
+  trajectory.set_timestamps({0., 1., 2., 3., 4.});
+
+  for (const double time : {0., 0.3, 1.5, 2.9, 4.}) {
+    ASSERT_TRUE(trajectory.Sample(time, InterpolationType::kHermite) ==
+                State({2. * time}, {-time}));
+  }
+
+  // The samples pass through the knot points and are smooth in between.
+  trajectory.set_knot_point(2, State({10.}, {0.}));
+  ASSERT_TRUE(trajectory.Sample(2., InterpolationType::kHermite) ==
+              State({10.}, {0.}));
+  const double epsilon = 1e-6;
+  const double left_derivative =
+      (trajectory.Sample(2., InterpolationType::kHermite)[0] -
+       trajectory.Sample(2. - epsilon, InterpolationType::kHermite)[0]) /
+      epsilon;
+  const double right_derivative =
+      (trajectory.Sample(2. + epsilon, InterpolationType::kHermite)[0] -
+       trajectory.Sample(2., InterpolationType::kHermite)[0]) /
+      epsilon;
+  ASSERT_NEAR(left_derivative, right_derivative, 1e-4);
+  // Central difference tangent at the third knot point.
+  ASSERT_NEAR(left_derivative, (6. - 2.) / 2., 1e-4);
+}
+
+TEST_F(TrajectoryTest, AngleSample) {
+  // Heading that crosses pi.
+  Trajectory trajectory(MatrixXd::Zero(3, 3), 3, 0);
+  trajectory.set_knot_point(0, State({0., 0., M_PI - 0.2}, {}));
+  trajectory.set_knot_point(1, State({1., 0., -M_PI + 0.2}, {}));
+  trajectory.set_knot_point(2, State({2., 0., -M_PI + 0.6}, {}));
+  trajectory.set_timestamps({0., 1., 2.});
+
+  // Without the angle indices, the heading goes the long way around.
+  ASSERT_NEAR(trajectory.Sample(0.5)[2], 0., 1e-12);
+
+  trajectory.set_angle_indices({2});
+  ASSERT_NEAR(std::abs(trajectory.Sample(0.5)[2]), M_PI, 1e-12);
+  ASSERT_NEAR(trajectory.Sample(0.25)[2], M_PI - 0.1, 1e-12);
+  ASSERT_NEAR(trajectory.Sample(0.75)[2], -M_PI + 0.1, 1e-12);
+  ASSERT_NEAR(trajectory.Sample(1.5)[2], -M_PI + 0.4, 1e-12);
+
+  // The Hermite tangents are computed along the shortest arc as well, and
+  // the heading is uniformly increasing.
+  for (const double time : {0.25, 0.5, 0.75, 1.5}) {
+    ASSERT_NEAR(trajectory.Sample(time, InterpolationType::kHermite)[2],
+                trajectory.Sample(time)[2], 1e-12);
+  }
+}
+
+TEST_F(TrajectoryTest, SampleBatch) {
+  Trajectory trajectory(MatrixXd::Random(100, 4), 3, 1);
+  vector<double> timestamps(100);
+  for (int i = 0; i < 100; ++i) {
+    timestamps.at(i) = i * i;
+  }
+  trajectory.set_timestamps(timestamps);
+  trajectory.set_angle_indices({2});
+
+  // Monotonic and arbitrary times, which must give the same samples as
+  // sampling them one at a time.
+  vector<double> times;
+  for (int i = -10; i < 10000; i += 7) {
+    times.push_back(i);
+  }
+  for (int i = 0; i < 100; ++i) {
+    times.push_back((i * 7919) % 9801);
+  }
+
+  for (const auto interpolation_type :
+       {InterpolationType::kLinear, InterpolationType::kHermite}) {
+    MatrixXd samples = trajectory.SampleBatch(times, interpolation_type);
+    ASSERT_EQ(samples.rows(), static_cast<int>(times.size()));
+    ASSERT_EQ(samples.cols(), 4);
+
+    for (unsigned int i = 0; i < times.size(); ++i) {
+      ASSERT_TRUE(
+          trajectory.Sample(times.at(i), interpolation_type).get_data() ==
+          samples.row(i).transpose());
+    }
+  }
+}
+
+TEST_F(TrajectoryTest, SampleWithCursor) {
+  Trajectory trajectory(MatrixXd::Random(100, 3), 2, 1);
+  vector<double> timestamps(100);
+  for (int i = 0; i < 100; ++i) {
+    timestamps.at(i) = i;
+  }
+  trajectory.set_timestamps(timestamps);
+
+  // The cursor may start anywhere, and is moved to the segment of the
+  // sample. The samples must not depend on the cursor.
+  State sample(2, 1);
+  for (int segment_cursor : {-5, 0, 50, 1000}) {
+    for (const double time : {0.5, 1.5, 55.5, 20.5, 98.5, 200.}) {
+      trajectory.Sample(time, sample, segment_cursor);
+      ASSERT_TRUE(sample == trajectory.Sample(time));
+      ASSERT_EQ(segment_cursor, min(static_cast<int>(time), 98));
+    }
+  }
+}
+
+TEST_F(TrajectoryTest, InvalidSample) {
+  // Untimed trajectories can't be sampled.
+  ASSERT_THROW(trajectory2_->Sample(0.), std::logic_error);
+  ASSERT_THROW(trajectory2_->SampleBatch({0.}), std::logic_error);
+
+  trajectory2_->set_timestamps({0., 0.5, 2.});
+  State sample(3, 0);
+  ASSERT_THROW(trajectory2_->Sample(0., sample, InterpolationType::kLinear),
+               std::invalid_argument);
+}
+
+TEST_F(TrajectoryTest, ArcLengths) {
+  // Three sides of the unit square.
+  MatrixXd data(4, 3);
+  data << 0., 0., 0., 1., 0., 0., 1., 1., 0., 0., 1., 0.;
+  Trajectory trajectory(data, 2, 1);
+
+  ASSERT_EQ(trajectory.get_arc_lengths(), vector<double>({0., 1., 2., 3.}));
+  ASSERT_DOUBLE_EQ(trajectory.get_path_length(), 3.);
+
+  // The arc lengths are recomputed when the knot points change.
+  trajectory.set_knot_point(3, State({1., 3.}, {0.}));
+  ASSERT_EQ(trajectory.get_arc_lengths(), vector<double>({0., 1., 2., 4.}));
+  trajectory.set_knot_point(0, State({0., -1.}, {0.}));
+  ASSERT_DOUBLE_EQ(trajectory.get_path_length(), std::sqrt(2.) + 3.);
+  trajectory.RemoveKnotPoint(0);
+  ASSERT_DOUBLE_EQ(trajectory.get_path_length(), 3.);
+  trajectory.AppendKnotPoints({State({1., 5.}, {0.})});
+  ASSERT_DOUBLE_EQ(trajectory.get_path_length(), 5.);
+
+  // A single knot point has a path of zero length.
+  ASSERT_EQ(trajectory1_->get_arc_lengths(), vector<double>({0.}));
+}
+
+TEST_F(TrajectoryTest, SampleAtArcLength) {
+  MatrixXd data(4, 3);
+  data << 0., 0., 0., 1., 0., 2., 1., 0., 4., 1., 1., 6.;
+  Trajectory trajectory(data, 2, 1);
+
+  ASSERT_TRUE(trajectory.SampleAtArcLength(0.) == State({0., 0.}, {0.}));
+  ASSERT_TRUE(trajectory.SampleAtArcLength(0.25) == State({0.25, 0.}, {0.5}));
+  // The second segment is of zero length.
+  ASSERT_TRUE(trajectory.SampleAtArcLength(1.) == State({1., 0.}, {4.}));
+  ASSERT_TRUE(trajectory.SampleAtArcLength(1.5) == State({1., 0.5}, {5.}));
+
+  // The arc length is clamped to the path.
+  ASSERT_TRUE(trajectory.SampleAtArcLength(-1.) == State({0., 0.}, {0.}));
+  ASSERT_TRUE(trajectory.SampleAtArcLength(3.) == State({1., 1.}, {6.}));
+}
+
+TEST_F(TrajectoryTest, FindNearestPathPoint) {
+  MatrixXd data(4, 2);
+  data << 0., 0., 2., 0., 2., 2., 0., 2.;
+  Trajectory trajectory(data, 2, 0);
+
+  PathPoint path_point = trajectory.FindNearestPathPoint(Point(1.8, 0.5));
+  ASSERT_EQ(path_point.segment, 1);
+  ASSERT_DOUBLE_EQ(path_point.fraction, 0.25);
+  ASSERT_DOUBLE_EQ(path_point.arc_length, 2.5);
+  ASSERT_NEAR(path_point.distance, 0.2, 1e-12);
+  ASSERT_TRUE(path_point.position.isApprox(Point(2., 0.5)));
+
+  // Points beyond the ends of the path.
+  path_point = trajectory.FindNearestPathPoint(Point(-3., -4.));
+  ASSERT_EQ(path_point.segment, 0);
+  ASSERT_DOUBLE_EQ(path_point.arc_length, 0.);
+  ASSERT_DOUBLE_EQ(path_point.distance, 5.);
+  path_point = trajectory.FindNearestPathPoint(Point(-1., 2.));
+  ASSERT_EQ(path_point.segment, 2);
+  ASSERT_DOUBLE_EQ(path_point.fraction, 1.);
+  ASSERT_DOUBLE_EQ(path_point.arc_length, 6.);
+
+  // Equidistant segments are resolved by their index.
+  path_point = trajectory.FindNearestPathPoint(Point(1., 1.));
+  ASSERT_EQ(path_point.segment, 0);
+
+  // Degenerate paths.
+  ASSERT_DOUBLE_EQ(trajectory1_->FindNearestPathPoint(Point(3., 4.)).distance,
+                   5.);
+  Trajectory trajectory2(MatrixXd::Ones(10, 2), 2, 0);
+  ASSERT_DOUBLE_EQ(trajectory2.FindNearestPathPoint(Point(1., 3.)).distance,
+                   2.);
+}
+
+TEST_F(TrajectoryTest, FindNearestPathPointAgreement) {
+  // The grid search must agree with checking each segment, for a random walk
+  // path that crosses itself many times and for a long straight path.
+  MatrixXd data1 = MatrixXd::Zero(1000, 3);
+  for (int i = 1; i < 1000; ++i) {
+    data1.row(i).head<2>() =
+        data1.row(i - 1).head<2>() + MatrixXd::Random(1, 2);
+  }
+  MatrixXd data2 = MatrixXd::Zero(1000, 3);
+  for (int i = 0; i < 1000; ++i) {
+    data2(i, 0) = 0.1 * i * i;
+  }
+
+  for (const MatrixXd& data : {data1, data2}) {
+    Trajectory trajectory(data, 3, 0);
+    for (int i = 0; i < 50; ++i) {
+      const Point point = 50. * Point::Random();
+      const PathPoint path_point = trajectory.FindNearestPathPoint(point);
+      const PathPoint windowed_path_point =
+          trajectory.FindNearestPathPoint(point, 500, 1000);
+
+      ASSERT_EQ(path_point.segment, windowed_path_point.segment);
+      ASSERT_DOUBLE_EQ(path_point.distance, windowed_path_point.distance);
+      ASSERT_NEAR((point - path_point.position).norm(), path_point.distance,
+                  1e-12);
+    }
+  }
+}
+
+TEST_F(TrajectoryTest, WindowedFindNearestPathPoint) {
+  // Figure of eight like path that crosses itself at (1, 1).
+  MatrixXd data(5, 2);
+  data << 0., 0., 2., 2., 2., 0., 0., 2., 0., 0.;
+  Trajectory trajectory(data, 2, 0);
+
+  // Close to the crossing, the global query jumps to the other branch while
+  // the windowed one stays on the branch that is being tracked.
+  const Point point(1.1, 0.9);
+  ASSERT_EQ(trajectory.FindNearestPathPoint(point).segment, 2);
+  ASSERT_EQ(trajectory.FindNearestPathPoint(point, 0, 0).segment, 0);
+  ASSERT_EQ(trajectory.FindNearestPathPoint(point, 1, 0).segment, 1);
+  ASSERT_EQ(trajectory.FindNearestPathPoint(point, 0, 2).segment, 2);
+}
+
+TEST_F(TrajectoryTest, ConcurrentQueries) {
+  // Concurrent queries on a trajectory whose path index hasn't been built yet
+  // must give the same results as serial ones.
+  MatrixXd data = MatrixXd::Zero(1000, 3);
+  for (int i = 1; i < 1000; ++i) {
+    data.row(i).head<2>() = data.row(i - 1).head<2>() + MatrixXd::Random(1, 2);
+  }
+  vector<double> timestamps(1000);
+  for (int i = 0; i < 1000; ++i) {
+    timestamps.at(i) = i;
+  }
+  vector<Point> points;
+  for (int i = 0; i < 200; ++i) {
+    points.push_back(50. * Point::Random());
+  }
+
+  Trajectory trajectory(data, 2, 1);
+  trajectory.set_timestamps(timestamps);
+  const Trajectory serial_trajectory = trajectory;
+
+  const int num_threads = 4;
+  vector<vector<PathPoint>> path_points(num_threads);
+  vector<MatrixXd> samples(num_threads);
+  vector<thread> threads;
+  for (int i = 0; i < num_threads; ++i) {
+    threads.emplace_back([&, i]() {
+      for (const Point& point : points) {
+        path_points.at(i).push_back(trajectory.FindNearestPathPoint(point));
+      }
+      samples.at(i) = trajectory.SampleBatch(timestamps);
+    });
+  }
+  for (auto& worker : threads) {
+    worker.join();
+  }
+
+  for (int i = 0; i < num_threads; ++i) {
+    for (unsigned int j = 0; j < points.size(); ++j) {
+      const PathPoint path_point =
+          serial_trajectory.FindNearestPathPoint(points.at(j));
+      ASSERT_EQ(path_points.at(i).at(j).segment, path_point.segment);
+      ASSERT_EQ(path_points.at(i).at(j).distance, path_point.distance);
+    }
+    ASSERT_TRUE(samples.at(i) == serial_trajectory.SampleBatch(timestamps));
+  }
+}
+
+TEST_F(TrajectoryTest, InvalidPathQueries) {
+  // No position.
+  Trajectory trajectory1(MatrixXd::Ones(10, 2), 1, 1);
+  ASSERT_THROW(trajectory1.get_arc_lengths(), std::logic_error);
+  ASSERT_THROW(trajectory1.FindNearestPathPoint(Point(0., 0.)),
+               std::logic_error);
+
+  // Empty trajectory.
+  Trajectory trajectory2(State({1., 2.}, {}));
+  trajectory2.RemoveKnotPoint();
+  ASSERT_THROW(trajectory2.get_path_length(), std::logic_error);
+  ASSERT_THROW(trajectory2.SampleAtArcLength(0.), std::logic_error);
+
+  ASSERT_THROW(trajectory4_->FindNearestPathPoint(Point(0., 0.), -1, 1),
+               std::out_of_range);
+  ASSERT_THROW(trajectory4_->FindNearestPathPoint(Point(0., 0.), 199, 1),
+               std::out_of_range);
+  ASSERT_THROW(trajectory4_->FindNearestPathPoint(Point(0., 0.), 0, -1),
+               std::invalid_argument);
 }
 
 }  // namespace
@@ -52,6 +52,36 @@ TEST_F(VelocityTest, CopyAssignment) {
   ASSERT_TRUE(velocity3.get_data().isApprox(data));
 }
 
+TEST_F(VelocityTest, MoveConstructor) {
+  static_assert(std::is_nothrow_move_constructible<Velocity>::value,
+                "Velocity must be nothrow move constructible.");
+
+  VectorXd data = VectorXd::Random(4);
+  Velocity velocity1(data);
+  Velocity velocity2(std::move(velocity1));
+
+  ASSERT_TRUE(velocity2.get_data().isApprox(data));
+  // The moved from velocity is left empty.
+  ASSERT_TRUE(velocity1.IsEmpty());
+}
+
+TEST_F(VelocityTest, MoveAssignment) {
+  static_assert(std::is_nothrow_move_assignable<Velocity>::value,
+                "Velocity must be nothrow move assignable.");
+
+  VectorXd data = VectorXd::Random(4);
+  Velocity velocity1(data);
+  Velocity velocity2(3);
+  velocity2 = std::move(velocity1);
+
+  ASSERT_TRUE(velocity2.get_data().isApprox(data));
+  ASSERT_TRUE(velocity1.IsEmpty());
+
+  // The moved from velocity can be assigned to again.
+  velocity1 = Velocity(2);
+  ASSERT_TRUE(velocity1.get_data().isApprox(VectorXd::Zero(2)));
+}
+
 TEST_F(VelocityTest, InvalidConstruction) {
   ASSERT_THROW(Velocity(-1), std::invalid_argument);
 }
@@ -109,6 +139,19 @@ TEST_F(VelocityTest, GetData) {
   ASSERT_TRUE(velocity.get_data().isApprox(data));
 }
 
+TEST_F(VelocityTest, GetDataRef) {
+  VectorXd data = VectorXd::Random(3);
+  Velocity velocity(3);
+
+  velocity.get_data_ref() = data;
+  ASSERT_TRUE(velocity.get_data().isApprox(data));
+
+  velocity.get_data_ref()(1) = 5.;
+  ASSERT_EQ(velocity[1], 5.);
+
+  ASSERT_THROW(Velocity(0).get_data_ref(), std::logic_error);
+}
+
 TEST_F(VelocityTest, GetVelocityAt) {
   for (int i = 0; i < velocity1_->get_size(); ++i) {
     ASSERT_EQ((*velocity1_)[i], 0);
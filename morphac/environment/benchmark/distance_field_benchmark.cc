@@ -0,0 +1,104 @@
+#include "benchmark/benchmark.h"
+
+#include "environment/include/distance_field.h"
+
+namespace {
+
+using morphac::common::aliases::MapData;
+using morphac::common::aliases::Point;
+using morphac::common::aliases::Points;
+using morphac::constants::MapConstants;
+using morphac::environment::DistanceField;
+using morphac::environment::Map;
+using morphac::math::geometry::CircleShape;
+
+constexpr double kResolution = 0.5;
+
+// Square map with roughly one percent of the pixels being obstacles. The
+// number of pixels along each side is given by the benchmark argument.
+Map CreateMap(const benchmark::State& benchmark_state) {
+  const MapData data =
+      MapData::Random(benchmark_state.range(0), benchmark_state.range(0))
+          .unaryExpr([](const int value) {
+            return value % 100 == 0 ? MapConstants::OBSTACLE
+                                    : MapConstants::EMPTY;
+          });
+  return Map(data, kResolution);
+}
+
+// The second benchmark argument is the number of threads.
+void BM_DistanceFieldConstruction(benchmark::State& benchmark_state) {
+  const Map map = CreateMap(benchmark_state);
+
+  for (auto _ : benchmark_state) {
+    DistanceField distance_field(map, benchmark_state.range(1));
+    benchmark::DoNotOptimize(distance_field.get_data().data());
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() *
+                                    map.get_data().size());
+}
+
+// A circular obstacle of a meter in radius that moves back and forth by a
+// pixel, so that only a small part of the map changes between the updates.
+void BM_DistanceFieldUpdate(benchmark::State& benchmark_state) {
+  const Map map = CreateMap(benchmark_state);
+  const Point center = 0.5 * Point{map.get_width(), map.get_height()};
+  Map start_map(map), end_map(map);
+  start_map.AddCircularObstacle(CircleShape{1., center});
+  end_map.AddCircularObstacle(CircleShape{1., center + Point{kResolution, 0.}});
+  // The dirty regions of the maps are the pixels that differ between them.
+  start_map.ClearDirtyRegion();
+  const Map moved_map = start_map.Evolve(end_map.get_data());
+  end_map.ClearDirtyRegion();
+  const Map returned_map = end_map.Evolve(start_map.get_data());
+
+  DistanceField distance_field(start_map);
+  for (auto _ : benchmark_state) {
+    distance_field.Update(moved_map);
+    distance_field.Update(returned_map);
+    benchmark::DoNotOptimize(distance_field.get_data().data());
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() * 2);
+}
+
+void BM_DistanceFieldComputeDistances(benchmark::State& benchmark_state) {
+  const Map map = CreateMap(benchmark_state);
+  const DistanceField distance_field(map);
+  const Points points =
+      0.5 * map.get_width() * (Points::Random(10000, 2).array() + 1.);
+
+  for (auto _ : benchmark_state) {
+    benchmark::DoNotOptimize(distance_field.ComputeDistances(points));
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() *
+                                    points.rows());
+}
+
+void BM_DistanceFieldComputeGradients(benchmark::State& benchmark_state) {
+  const Map map = CreateMap(benchmark_state);
+  const DistanceField distance_field(map);
+  const Points points =
+      0.5 * map.get_width() * (Points::Random(10000, 2).array() + 1.);
+
+  for (auto _ : benchmark_state) {
+    benchmark::DoNotOptimize(distance_field.ComputeGradients(points));
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() *
+                                    points.rows());
+}
+
+BENCHMARK(BM_DistanceFieldConstruction)
+    ->ArgsProduct({{256, 1024, 4096}, {1, 4}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_DistanceFieldUpdate)
+    ->Arg(256)
+    ->Arg(1024)
+    ->Arg(4096)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DistanceFieldComputeDistances)->Arg(1024);
+BENCHMARK(BM_DistanceFieldComputeGradients)->Arg(1024);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,156 @@
+#include <cmath>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "environment/include/map.h"
+
+namespace {
+
+using std::cos;
+using std::fmod;
+using std::sin;
+using std::vector;
+
+using morphac::common::aliases::MapData;
+using morphac::common::aliases::Point;
+using morphac::common::aliases::Points;
+using morphac::environment::Map;
+using morphac::math::geometry::CircleShape;
+using morphac::math::geometry::RectangleShape;
+using morphac::math::geometry::RoundedRectangleShape;
+
+// Exactly representable, so that the map dimensions are always valid.
+constexpr double kResolution = 0.5;
+
+// Square maps, with the number of pixels along each side given by the
+// benchmark argument.
+void BM_MapConstruction(benchmark::State& benchmark_state) {
+  const double size = benchmark_state.range(0) * kResolution;
+
+  for (auto _ : benchmark_state) {
+    Map map(size, size, kResolution);
+    benchmark::DoNotOptimize(map);
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() *
+                                    benchmark_state.range(0) *
+                                    benchmark_state.range(0));
+}
+
+void BM_MapConstructionFromData(benchmark::State& benchmark_state) {
+  const MapData data =
+      MapData::Random(benchmark_state.range(0), benchmark_state.range(0));
+
+  for (auto _ : benchmark_state) {
+    Map map(data, kResolution);
+    benchmark::DoNotOptimize(map);
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() *
+                                    data.size());
+}
+
+// Side of the (square) map that the obstacles are added to, along with the
+// obstacle sizes. This is roughly a warehouse, with obstacles the size of
+// shelves and pillars.
+constexpr double kObstacleMapSize = 1000.;
+constexpr double kObstacleSize = 4.;
+
+// Obstacle centers scattered over the map (A low discrepancy sequence), for
+// the number of obstacles given by the benchmark argument.
+vector<Point> CreateObstacleCenters(const benchmark::State& benchmark_state) {
+  vector<Point> centers;
+  for (int i = 0; i < benchmark_state.range(0); ++i) {
+    centers.push_back(kObstacleMapSize *
+                      Point{fmod(i * 0.6180339887, 1.),
+                            fmod(i * 0.7548776662, 1.)});
+  }
+  return centers;
+}
+
+// The map is created outside the timed region, so that only the
+// rasterization is measured.
+template <typename Shape>
+void BenchmarkObstacles(benchmark::State& benchmark_state,
+                        const vector<Shape>& shapes,
+                        void (Map::*add_obstacles)(const vector<Shape>&)) {
+  for (auto _ : benchmark_state) {
+    benchmark_state.PauseTiming();
+    Map map(kObstacleMapSize, kObstacleMapSize, kResolution);
+    benchmark_state.ResumeTiming();
+
+    (map.*add_obstacles)(shapes);
+    benchmark::DoNotOptimize(map.get_data_ref().data());
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() *
+                                    shapes.size());
+}
+
+void BM_MapAddCircularObstacles(benchmark::State& benchmark_state) {
+  vector<CircleShape> circle_shapes;
+  for (const auto& center : CreateObstacleCenters(benchmark_state)) {
+    circle_shapes.push_back(CircleShape{kObstacleSize / 2, center});
+  }
+  BenchmarkObstacles(benchmark_state, circle_shapes,
+                     &Map::AddCircularObstacles);
+}
+
+void BM_MapAddRectangularObstacles(benchmark::State& benchmark_state) {
+  vector<RectangleShape> rectangle_shapes;
+  for (const auto& center : CreateObstacleCenters(benchmark_state)) {
+    rectangle_shapes.push_back(
+        RectangleShape{kObstacleSize, kObstacleSize / 2, center(0), center});
+  }
+  BenchmarkObstacles(benchmark_state, rectangle_shapes,
+                     &Map::AddRectangularObstacles);
+}
+
+void BM_MapAddRoundedRectangularObstacles(benchmark::State& benchmark_state) {
+  vector<RoundedRectangleShape> rounded_rectangle_shapes;
+  for (const auto& center : CreateObstacleCenters(benchmark_state)) {
+    rounded_rectangle_shapes.push_back(RoundedRectangleShape{
+        kObstacleSize, kObstacleSize / 2, center(0), kObstacleSize / 8,
+        center});
+  }
+  BenchmarkObstacles(benchmark_state, rounded_rectangle_shapes,
+                     &Map::AddRoundedRectangularObstacles);
+}
+
+// Arbitrary (non-convex) polygons, with the given number of vertices.
+void BM_MapAddPolygonalObstacles(benchmark::State& benchmark_state) {
+  const int num_vertices = benchmark_state.range(1);
+  vector<Points> polygons;
+  for (const auto& center : CreateObstacleCenters(benchmark_state)) {
+    Points polygon(num_vertices, 2);
+    for (int i = 0; i < num_vertices; ++i) {
+      // Star shaped, alternating between two radii.
+      const double radius = (i % 2 == 0 ? 0.5 : 0.25) * kObstacleSize;
+      const double angle = 2 * M_PI * i / num_vertices;
+      polygon.row(i) = center.transpose() +
+                       radius * Point{cos(angle), sin(angle)}.transpose();
+    }
+    polygons.push_back(polygon);
+  }
+  BenchmarkObstacles(benchmark_state, polygons, &Map::AddPolygonalObstacles);
+}
+
+BENCHMARK(BM_MapConstruction)->RangeMultiplier(4)->Range(16, 4096);
+BENCHMARK(BM_MapConstructionFromData)->RangeMultiplier(4)->Range(16, 4096);
+BENCHMARK(BM_MapAddCircularObstacles)
+    ->RangeMultiplier(10)
+    ->Range(100, 100000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MapAddRectangularObstacles)
+    ->RangeMultiplier(10)
+    ->Range(100, 100000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MapAddRoundedRectangularObstacles)
+    ->RangeMultiplier(10)
+    ->Range(100, 100000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MapAddPolygonalObstacles)
+    ->ArgsProduct({{100, 1000, 10000, 100000}, {8, 32}})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,103 @@
+#include "benchmark/benchmark.h"
+
+#include "environment/include/occupancy_grid.h"
+
+namespace {
+
+using morphac::common::aliases::MapData;
+using morphac::constants::MapConstants;
+using morphac::environment::MapRegion;
+using morphac::environment::OccupancyGrid;
+
+constexpr double kResolution = 0.5;
+// Side of the (square) maps, in pixels.
+constexpr int kMapSize = 4096;
+
+// Map with roughly one percent of the pixels being obstacles.
+MapData CreateMapData() {
+  return MapData::Random(kMapSize, kMapSize).unaryExpr([](const int value) {
+    return value % 100 == 0 ? MapConstants::OBSTACLE : MapConstants::EMPTY;
+  });
+}
+
+// Square region at the center of the map, with the number of pixels along
+// each side given by the benchmark argument.
+MapRegion CreateRegion(const benchmark::State& benchmark_state) {
+  const int start = (kMapSize - benchmark_state.range(0)) / 2;
+  const int end = start + benchmark_state.range(0);
+  return MapRegion{start, start, end, end};
+}
+
+void BM_OccupancyGridConstruction(benchmark::State& benchmark_state) {
+  const MapData data = CreateMapData();
+
+  for (auto _ : benchmark_state) {
+    OccupancyGrid occupancy_grid(data, kResolution);
+    benchmark::DoNotOptimize(occupancy_grid);
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() *
+                                    data.size());
+}
+
+void BM_OccupancyGridToMapData(benchmark::State& benchmark_state) {
+  const OccupancyGrid occupancy_grid(CreateMapData(), kResolution);
+
+  for (auto _ : benchmark_state) {
+    benchmark::DoNotOptimize(occupancy_grid.ToMapData());
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() * kMapSize *
+                                    kMapSize);
+}
+
+void BM_OccupancyGridCountOccupied(benchmark::State& benchmark_state) {
+  const OccupancyGrid occupancy_grid(CreateMapData(), kResolution);
+  const MapRegion region = CreateRegion(benchmark_state);
+
+  for (auto _ : benchmark_state) {
+    benchmark::DoNotOptimize(occupancy_grid.CountOccupied(region));
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() *
+                                    benchmark_state.range(0) *
+                                    benchmark_state.range(0));
+}
+
+// The same query on the int representation, for comparison.
+void BM_MapDataCountOccupied(benchmark::State& benchmark_state) {
+  const MapData data = CreateMapData();
+  const MapRegion region = CreateRegion(benchmark_state);
+
+  for (auto _ : benchmark_state) {
+    benchmark::DoNotOptimize(
+        (data.block(region.start_row, region.start_col,
+                    region.end_row - region.start_row,
+                    region.end_col - region.start_col)
+             .array() == MapConstants::OBSTACLE)
+            .count());
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() *
+                                    benchmark_state.range(0) *
+                                    benchmark_state.range(0));
+}
+
+void BM_OccupancyGridFillRegion(benchmark::State& benchmark_state) {
+  OccupancyGrid occupancy_grid(CreateMapData(), kResolution);
+  const MapRegion region = CreateRegion(benchmark_state);
+
+  for (auto _ : benchmark_state) {
+    occupancy_grid.FillRegion(region, true);
+    benchmark::ClobberMemory();
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() *
+                                    benchmark_state.range(0) *
+                                    benchmark_state.range(0));
+}
+
+BENCHMARK(BM_OccupancyGridConstruction)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_OccupancyGridToMapData)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_OccupancyGridCountOccupied)->Arg(100)->Arg(1000)->Arg(4000);
+BENCHMARK(BM_MapDataCountOccupied)->Arg(100)->Arg(1000)->Arg(4000);
+BENCHMARK(BM_OccupancyGridFillRegion)->Arg(100)->Arg(1000)->Arg(4000);
+
+}  // namespace
+
+BENCHMARK_MAIN();
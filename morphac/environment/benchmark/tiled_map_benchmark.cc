@@ -0,0 +1,84 @@
+#include "benchmark/benchmark.h"
+
+#include "environment/include/tiled_map.h"
+
+namespace {
+
+using morphac::common::aliases::MapData;
+using morphac::constants::MapConstants;
+using morphac::environment::MapRegion;
+using morphac::environment::TiledMap;
+
+// Exactly representable, so that the map dimensions are always valid.
+constexpr double kResolution = 0.5;
+// Side of the region that the region benchmarks read and write, in pixels.
+constexpr int kRegionSize = 1024;
+
+// Square maps, with the number of pixels along each side given by the
+// benchmark argument. Only the table of tiles is allocated.
+void BM_TiledMapConstruction(benchmark::State& benchmark_state) {
+  const double size = benchmark_state.range(0) * kResolution;
+
+  for (auto _ : benchmark_state) {
+    TiledMap tiled_map(size, size, kResolution);
+    benchmark::DoNotOptimize(tiled_map.get_num_tiles());
+  }
+}
+
+// Reads a pixel at a time, sweeping over a region with allocated tiles.
+void BM_TiledMapGetPixel(benchmark::State& benchmark_state) {
+  TiledMap tiled_map(8192 * kResolution, 8192 * kResolution, kResolution);
+  tiled_map.FillRegion(MapRegion{0, 0, kRegionSize, kRegionSize},
+                       MapConstants::OBSTACLE);
+
+  for (auto _ : benchmark_state) {
+    int sum = 0;
+    for (int row = 0; row < kRegionSize; ++row) {
+      for (int col = 0; col < kRegionSize; ++col) {
+        sum += tiled_map.GetPixel(row, col);
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() *
+                                    kRegionSize * kRegionSize);
+}
+
+void BM_TiledMapGetRegion(benchmark::State& benchmark_state) {
+  TiledMap tiled_map(8192 * kResolution, 8192 * kResolution, kResolution);
+  tiled_map.FillRegion(MapRegion{0, 0, kRegionSize, kRegionSize},
+                       MapConstants::OBSTACLE);
+  const MapRegion region{100, 100, 100 + kRegionSize, 100 + kRegionSize};
+
+  for (auto _ : benchmark_state) {
+    benchmark::DoNotOptimize(tiled_map.GetRegion(region));
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() *
+                                    kRegionSize * kRegionSize);
+}
+
+void BM_TiledMapSetRegion(benchmark::State& benchmark_state) {
+  TiledMap tiled_map(8192 * kResolution, 8192 * kResolution, kResolution);
+  const MapData data =
+      MapData::Constant(kRegionSize, kRegionSize, MapConstants::OBSTACLE);
+
+  for (auto _ : benchmark_state) {
+    tiled_map.SetRegion(100, 100, data);
+    benchmark::ClobberMemory();
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() *
+                                    kRegionSize * kRegionSize);
+}
+
+BENCHMARK(BM_TiledMapConstruction)
+    ->Arg(1024)
+    ->Arg(8192)
+    ->Arg(100000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TiledMapGetPixel)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TiledMapGetRegion)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TiledMapSetRegion)->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+
+BENCHMARK_MAIN();
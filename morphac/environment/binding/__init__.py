@@ -1,6 +1,22 @@
-from ._binding_environment_python import Map
+from ._binding_environment_python import (
+    DistanceField,
+    Map,
+    MapRegion,
+    OccupancyGrid,
+    TiledMap,
+)
 
 from morphac.environment._map import (
     evolve_map_with_circular_obstacle,
     evolve_map_with_polygonal_obstacle,
 )
+
+# Dependencies
+# -------------------------------------------------
+
+from morphac.math.geometry._binding_geometry_python import (
+    CircleShape as _CircleShape,
+    RectangleShape as _RectangleShape,
+    RoundedRectangleShape as _RoundedRectangleShape,
+    TriangleShape as _TriangleShape,
+)
@@ -1,4 +1,7 @@
+#include "environment/binding/include/distance_field_binding.h"
 #include "environment/binding/include/map_binding.h"
+#include "environment/binding/include/occupancy_grid_binding.h"
+#include "environment/binding/include/tiled_map_binding.h"
 #include "pybind11/eigen.h"
 #include "pybind11/pybind11.h"
 
@@ -8,7 +11,12 @@ namespace binding {
 
 namespace py = pybind11;
 
-PYBIND11_MODULE(_binding_environment_python, m) { define_map_binding(m); }
+PYBIND11_MODULE(_binding_environment_python, m) {
+  define_map_binding(m);
+  define_distance_field_binding(m);
+  define_occupancy_grid_binding(m);
+  define_tiled_map_binding(m);
+}
 
 }  // namespace binding
 }  // namespace environment
@@ -0,0 +1,18 @@
+#ifndef DISTANCE_FIELD_BINDING_H
+#define DISTANCE_FIELD_BINDING_H
+
+#include "environment/include/distance_field.h"
+#include "pybind11/eigen.h"
+#include "pybind11/pybind11.h"
+
+namespace morphac {
+namespace environment {
+namespace binding {
+
+void define_distance_field_binding(pybind11::module& m);
+
+}  // namespace binding
+}  // namespace environment
+}  // namespace morphac
+
+#endif
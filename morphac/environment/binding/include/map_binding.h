@@ -4,6 +4,7 @@
 #include "environment/include/map.h"
 #include "pybind11/eigen.h"
 #include "pybind11/pybind11.h"
+#include "pybind11/stl.h"
 
 namespace morphac {
 namespace environment {
@@ -0,0 +1,19 @@
+#ifndef OCCUPANCY_GRID_BINDING_H
+#define OCCUPANCY_GRID_BINDING_H
+
+#include "common/error_handling/include/error_macros.h"
+#include "environment/include/occupancy_grid.h"
+#include "pybind11/eigen.h"
+#include "pybind11/pybind11.h"
+
+namespace morphac {
+namespace environment {
+namespace binding {
+
+void define_occupancy_grid_binding(pybind11::module& m);
+
+}  // namespace binding
+}  // namespace environment
+}  // namespace morphac
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef TILED_MAP_BINDING_H
+#define TILED_MAP_BINDING_H
+
+#include "common/error_handling/include/error_macros.h"
+#include "environment/include/tiled_map.h"
+#include "pybind11/eigen.h"
+#include "pybind11/pybind11.h"
+
+namespace morphac {
+namespace environment {
+namespace binding {
+
+void define_tiled_map_binding(pybind11::module& m);
+
+}  // namespace binding
+}  // namespace environment
+}  // namespace morphac
+
+#endif
@@ -0,0 +1,40 @@
+#include "environment/binding/include/distance_field_binding.h"
+
+namespace morphac {
+namespace environment {
+namespace binding {
+
+namespace py = pybind11;
+
+using morphac::environment::DistanceField;
+using morphac::environment::Map;
+
+void define_distance_field_binding(py::module& m) {
+  py::class_<DistanceField> distance_field(m, "DistanceField");
+
+  // The GIL is released while the field is computed.
+  distance_field.def(py::init<const Map&, const int>(), py::arg("map"),
+                     py::arg("num_threads") = 1,
+                     py::call_guard<py::gil_scoped_release>());
+  distance_field.def_property_readonly("resolution",
+                                       &DistanceField::get_resolution);
+  // Read only view of the data, without a copy.
+  distance_field.def_property_readonly(
+      "data",
+      py::cpp_function(&DistanceField::get_data,
+                       py::return_value_policy::reference_internal));
+  distance_field.def("update", &DistanceField::Update, py::arg("map"),
+                     py::call_guard<py::gil_scoped_release>());
+  distance_field.def("compute_distance", &DistanceField::ComputeDistance,
+                     py::arg("point"));
+  distance_field.def("compute_gradient", &DistanceField::ComputeGradient,
+                     py::arg("point"));
+  distance_field.def("compute_distances", &DistanceField::ComputeDistances,
+                     py::arg("points"));
+  distance_field.def("compute_gradients", &DistanceField::ComputeGradients,
+                     py::arg("points"));
+}
+
+}  // namespace binding
+}  // namespace environment
+}  // namespace morphac
@@ -6,22 +6,75 @@ namespace binding {
 
 namespace py = pybind11;
 
+using std::vector;
+
 using morphac::common::aliases::MapData;
+using morphac::common::aliases::Points;
 using morphac::environment::Map;
+using morphac::environment::MapRegion;
+using morphac::math::geometry::CircleShape;
+using morphac::math::geometry::RectangleShape;
+using morphac::math::geometry::RoundedRectangleShape;
+using morphac::math::geometry::TriangleShape;
 
 void define_map_binding(py::module& m) {
+  py::class_<MapRegion> map_region(m, "MapRegion");
+
+  map_region.def(py::init<const int, const int, const int, const int>(),
+                 py::arg("start_row"), py::arg("start_col"),
+                 py::arg("end_row"), py::arg("end_col"));
+  map_region.def_readonly("start_row", &MapRegion::start_row);
+  map_region.def_readonly("start_col", &MapRegion::start_col);
+  map_region.def_readonly("end_row", &MapRegion::end_row);
+  map_region.def_readonly("end_col", &MapRegion::end_col);
+  map_region.def("is_empty", &MapRegion::IsEmpty);
+
   py::class_<Map> map(m, "Map");
 
   map.def(py::init<const double, const double, const double>(),
           py::arg("width"), py::arg("height"), py::arg("resolution"));
   map.def(py::init<const MapData&, const double>(), py::arg("data"),
           py::arg("resolution"));
+  map.def(py::init<const Map&>(), py::arg("map"));
   map.def_property_readonly("width", &Map::get_width);
   map.def_property_readonly("height", &Map::get_height);
   map.def_property_readonly("resolution", &Map::get_resolution);
+  // Accessing the data marks the whole map dirty, as the returned array may be
+  // modified in place. set_region only marks the region it writes dirty.
   map.def_property("data", &Map::get_data_ref, &Map::set_data,
-                   py::return_value_policy::reference);
+                   py::return_value_policy::reference_internal);
+  map.def("set_region", &Map::SetRegion, py::arg("start_row"),
+          py::arg("start_col"), py::arg("data"));
   map.def("evolve", &Map::Evolve, py::arg("data"));
+  map.def_property_readonly("dirty_region", &Map::get_dirty_region);
+  map.def("clear_dirty_region", &Map::ClearDirtyRegion);
+  // The obstacles are rasterized in place, directly into the map data.
+  map.def("add_circular_obstacle", &Map::AddCircularObstacle,
+          py::arg("circle_shape"));
+  map.def("add_rectangular_obstacle", &Map::AddRectangularObstacle,
+          py::arg("rectangle_shape"));
+  map.def("add_rounded_rectangular_obstacle",
+          &Map::AddRoundedRectangularObstacle,
+          py::arg("rounded_rectangle_shape"));
+  map.def("add_triangular_obstacle", &Map::AddTriangularObstacle,
+          py::arg("triangle_shape"));
+  map.def("add_polygonal_obstacle", &Map::AddPolygonalObstacle,
+          py::arg("polygon"));
+  // The batched versions release the GIL once the shapes are converted.
+  map.def("add_circular_obstacles", &Map::AddCircularObstacles,
+          py::arg("circle_shapes"), py::call_guard<py::gil_scoped_release>());
+  map.def("add_rectangular_obstacles", &Map::AddRectangularObstacles,
+          py::arg("rectangle_shapes"),
+          py::call_guard<py::gil_scoped_release>());
+  map.def("add_rounded_rectangular_obstacles",
+          &Map::AddRoundedRectangularObstacles,
+          py::arg("rounded_rectangle_shapes"),
+          py::call_guard<py::gil_scoped_release>());
+  map.def("add_triangular_obstacles", &Map::AddTriangularObstacles,
+          py::arg("triangle_shapes"),
+          py::call_guard<py::gil_scoped_release>());
+  map.def("add_polygonal_obstacles", &Map::AddPolygonalObstacles,
+          py::arg("polygons"), py::call_guard<py::gil_scoped_release>());
 }
 
 }  // namespace binding
@@ -0,0 +1,68 @@
+#include "environment/binding/include/occupancy_grid_binding.h"
+
+namespace morphac {
+namespace environment {
+namespace binding {
+
+namespace py = pybind11;
+
+using morphac::common::aliases::MapData;
+using morphac::environment::Map;
+using morphac::environment::OccupancyGrid;
+
+namespace {
+
+// The occupancy grid only validates the pixel indices on its hot paths, so
+// they are validated here for everything coming in from python.
+void RequirePixel(const OccupancyGrid& occupancy_grid, const int row,
+                  const int col) {
+  MORPH_REQUIRE(row >= 0 && row < occupancy_grid.get_rows() && col >= 0 &&
+                    col < occupancy_grid.get_cols(),
+                std::out_of_range, "Pixel index out of bounds.");
+}
+
+}  // namespace
+
+void define_occupancy_grid_binding(py::module& m) {
+  py::class_<OccupancyGrid> occupancy_grid(m, "OccupancyGrid");
+
+  occupancy_grid.def(py::init<const double, const double, const double>(),
+                     py::arg("width"), py::arg("height"),
+                     py::arg("resolution"));
+  occupancy_grid.def(py::init<const MapData&, const double>(),
+                     py::arg("data"), py::arg("resolution"));
+  occupancy_grid.def(py::init<const Map&>(), py::arg("map"));
+  occupancy_grid.def_property_readonly("width", &OccupancyGrid::get_width);
+  occupancy_grid.def_property_readonly("height", &OccupancyGrid::get_height);
+  occupancy_grid.def_property_readonly("resolution",
+                                       &OccupancyGrid::get_resolution);
+  occupancy_grid.def_property_readonly("rows", &OccupancyGrid::get_rows);
+  occupancy_grid.def_property_readonly("cols", &OccupancyGrid::get_cols);
+  occupancy_grid.def("to_map_data", &OccupancyGrid::ToMapData);
+  occupancy_grid.def("to_map", &OccupancyGrid::ToMap);
+  occupancy_grid.def(
+      "is_occupied",
+      [](const OccupancyGrid& occupancy_grid, const int row, const int col) {
+        RequirePixel(occupancy_grid, row, col);
+        return occupancy_grid.IsOccupied(row, col);
+      },
+      py::arg("row"), py::arg("col"));
+  occupancy_grid.def(
+      "set_occupied",
+      [](OccupancyGrid& occupancy_grid, const int row, const int col,
+         const bool occupied) {
+        RequirePixel(occupancy_grid, row, col);
+        occupancy_grid.SetOccupied(row, col, occupied);
+      },
+      py::arg("row"), py::arg("col"), py::arg("occupied"));
+  occupancy_grid.def("count_occupied", &OccupancyGrid::CountOccupied,
+                     py::arg("region"));
+  occupancy_grid.def("is_region_free", &OccupancyGrid::IsRegionFree,
+                     py::arg("region"));
+  occupancy_grid.def("fill_region", &OccupancyGrid::FillRegion,
+                     py::arg("region"), py::arg("occupied"));
+}
+
+}  // namespace binding
+}  // namespace environment
+}  // namespace morphac
@@ -0,0 +1,69 @@
+#include "environment/binding/include/tiled_map_binding.h"
+
+namespace morphac {
+namespace environment {
+namespace binding {
+
+namespace py = pybind11;
+
+using std::string;
+
+using morphac::environment::TiledMap;
+
+namespace {
+
+// The tiled map only validates the pixel indices on its hot paths, so they
+// are validated here for everything coming in from python.
+void RequirePixel(const TiledMap& tiled_map, const int row, const int col) {
+  MORPH_REQUIRE(row >= 0 && row < tiled_map.get_rows() && col >= 0 &&
+                    col < tiled_map.get_cols(),
+                std::out_of_range, "Pixel index out of bounds.");
+}
+
+}  // namespace
+
+void define_tiled_map_binding(py::module& m) {
+  py::class_<TiledMap> tiled_map(m, "TiledMap");
+
+  tiled_map.def(py::init<const double, const double, const double, const int>(),
+                py::arg("width"), py::arg("height"), py::arg("resolution"),
+                py::arg("tile_size") = 256);
+  tiled_map.def(py::init<const double, const double, const double,
+                         const string&, const int, const bool>(),
+                py::arg("width"), py::arg("height"), py::arg("resolution"),
+                py::arg("file_path"), py::arg("tile_size") = 256,
+                py::arg("overwrite") = false);
+  tiled_map.def_property_readonly("width", &TiledMap::get_width);
+  tiled_map.def_property_readonly("height", &TiledMap::get_height);
+  tiled_map.def_property_readonly("resolution", &TiledMap::get_resolution);
+  tiled_map.def_property_readonly("rows", &TiledMap::get_rows);
+  tiled_map.def_property_readonly("cols", &TiledMap::get_cols);
+  tiled_map.def_property_readonly("tile_size", &TiledMap::get_tile_size);
+  tiled_map.def_property_readonly("num_tiles", &TiledMap::get_num_tiles);
+  tiled_map.def_property_readonly("num_allocated_tiles",
+                                  &TiledMap::get_num_allocated_tiles);
+  tiled_map.def(
+      "get_pixel",
+      [](const TiledMap& tiled_map, const int row, const int col) {
+        RequirePixel(tiled_map, row, col);
+        return tiled_map.GetPixel(row, col);
+      },
+      py::arg("row"), py::arg("col"));
+  tiled_map.def(
+      "set_pixel",
+      [](TiledMap& tiled_map, const int row, const int col, const int value) {
+        RequirePixel(tiled_map, row, col);
+        tiled_map.SetPixel(row, col, value);
+      },
+      py::arg("row"), py::arg("col"), py::arg("value"));
+  tiled_map.def("get_region", &TiledMap::GetRegion, py::arg("region"));
+  tiled_map.def("set_region", &TiledMap::SetRegion, py::arg("start_row"),
+                py::arg("start_col"), py::arg("data"));
+  tiled_map.def("fill_region", &TiledMap::FillRegion, py::arg("region"),
+                py::arg("value"));
+  tiled_map.def("to_map", &TiledMap::ToMap, py::arg("region"));
+}
+
+}  // namespace binding
+}  // namespace environment
+}  // namespace morphac
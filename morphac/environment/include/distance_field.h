@@ -0,0 +1,148 @@
+#ifndef DISTANCE_FIELD_H
+#define DISTANCE_FIELD_H
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "Eigen/Dense"
+#include "common/aliases/include/eigen_aliases.h"
+#include "common/error_handling/include/error_macros.h"
+#include "constants/include/environment_constants.h"
+#include "environment/include/map.h"
+#include "utils/include/thread_utils.h"
+
+namespace morphac {
+namespace environment {
+
+// Euclidean signed distance field of a Map. Each pixel stores the distance
+// (In meters) from its center to the center of the nearest pixel on the other
+// side of the obstacle boundary. The distance is positive for free pixels and
+// negative for obstacle (MapConstants::OBSTACLE) pixels.
+//
+// The field is computed exactly in linear time, with the Felzenszwalb and
+// Huttenlocher distance transform. The transform is separable, and each of its
+// column and row passes is parallelized over the given number of threads.
+//
+// The field is a snapshot of the map. When the map changes, the field is
+// brought up to date with Update, which only touches the pixels whose nearest
+// obstacle (or free) pixel changed. The incremental update is the dynamic
+// brushfire algorithm of Lau et al. Its lower waves spread from the new
+// obstacle boundaries, while its raise waves clear the pixels whose nearest
+// obstacle was removed. As the waves propagate the nearest pixels between
+// neighbors, the updated distances may (rarely) exceed the exact ones by a
+// small fraction of a pixel.
+class DistanceField {
+ public:
+  DistanceField(const Map& map, const int num_threads = 1);
+
+  // Updates the field to the current state of the map, which must have the
+  // same dimensions and resolution as the map that the field was built from.
+  // Only the dirty region of the map (See Map::get_dirty_region) is checked
+  // for changes, so the cost scales with the changed area rather than with
+  // the map size. Clearing the dirty region of the map afterwards is up to
+  // the caller. Updating with an unchanged map does nothing.
+  void Update(const Map& map);
+
+  double get_resolution() const;
+  // Signed distance of each pixel of the map.
+  const morphac::common::aliases::DistanceFieldData& get_data() const;
+
+  // The queries are in world coordinates, and are bilinearly interpolated
+  // between the pixels (See transforms.h for the pixel coordinates). Points
+  // outside the map are clamped to the map boundary.
+  // If the map has no obstacles (Or no free space), the distance is infinite
+  // everywhere and the gradient is zero.
+  double ComputeDistance(const morphac::common::aliases::Point& point) const;
+  // Gradient of the (interpolated) distance with respect to the point.
+  morphac::common::aliases::Point ComputeGradient(
+      const morphac::common::aliases::Point& point) const;
+
+  Eigen::VectorXd ComputeDistances(
+      const morphac::common::aliases::Points& points) const;
+  morphac::common::aliases::Points ComputeGradients(
+      const morphac::common::aliases::Points& points) const;
+
+ private:
+  // Nearest site of each pixel (As a row major pixel index, or -1 if there are
+  // no sites) for one of the two transforms, along with the state of its
+  // incremental update. The sites are the pixels whose occupancy is
+  // site_occupancy, i.e. the obstacle pixels or the free pixels.
+  struct NearestSites {
+    const bool site_occupancy;
+    std::vector<int> sites;
+    // Whether a pixel is part of a raise wave.
+    std::vector<bool> to_raise;
+  };
+
+  // Pixels of an update wave, ordered by their squared distance.
+  using WaveQueue =
+      std::priority_queue<std::pair<double, int>,
+                          std::vector<std::pair<double, int>>,
+                          std::greater<std::pair<double, int>>>;
+
+  // Nearest pixel (See NearestSites) to each pixel for which
+  // is_site(row, col) is true.
+  template <typename IsSite>
+  std::vector<int> ComputeNearestSites(
+      const IsSite& is_site, morphac::utils::ThreadPool& thread_pool) const;
+
+  // One dimensional squared distance transform of the sampled function f,
+  // given by the sample that each sample is nearest to. The remaining
+  // arguments are scratch buffers of the size of f (Plus one for the
+  // boundaries).
+  static void ComputeNearestSamples(const std::vector<double>& f,
+                                    std::vector<int>& nearest_samples,
+                                    std::vector<int>& parabola_vertices,
+                                    std::vector<double>& boundaries);
+
+  // Squared distance (In pixels) between two pixels, which is infinite if the
+  // site is -1.
+  double ComputeSquaredDistance(const int pixel, const int site) const;
+  // Signed distance of the pixel, from its nearest sites.
+  double ComputeSignedDistance(const int pixel) const;
+  bool IsValidSite(const NearestSites& nearest_sites, const int site) const;
+
+  // The pixel turned into a site (Or stopped being one). Starts the lower (Or
+  // raise) wave from it.
+  void SetSite(const int pixel, NearestSites& nearest_sites, WaveQueue& queue,
+               std::vector<int>& updated_pixels);
+  void RemoveSite(const int pixel, NearestSites& nearest_sites,
+                  WaveQueue& queue, std::vector<int>& updated_pixels);
+  // Propagates the waves until the queue is empty. The pixels whose nearest
+  // site changed are appended to updated_pixels.
+  void PropagateWaves(NearestSites& nearest_sites, WaveQueue& queue,
+                      std::vector<int>& updated_pixels);
+  // Clears the neighbors whose nearest site is no longer valid, and queues the
+  // others so that they lower the cleared pixels in turn.
+  void Raise(const int pixel, NearestSites& nearest_sites, WaveQueue& queue,
+             std::vector<int>& updated_pixels);
+  // Offers the nearest site of the pixel to its neighbors.
+  void Lower(const int pixel, NearestSites& nearest_sites, WaveQueue& queue,
+             std::vector<int>& updated_pixels);
+
+  // Interpolation cell of the point. The (continuous) pixel coordinates are
+  // clamped to the map, and the cell is given by its top left pixel and the
+  // offsets of the point from it.
+  void ComputeCell(const morphac::common::aliases::Point& point, int& row,
+                   int& col, double& row_offset, double& col_offset) const;
+
+  const double resolution_;
+  const int rows_;
+  const int cols_;
+  // Occupancy (Whether it is an obstacle) of each pixel, as of the last
+  // update.
+  std::vector<bool> occupancy_;
+  NearestSites obstacle_sites_;
+  NearestSites free_sites_;
+  morphac::common::aliases::DistanceFieldData data_;
+};
+
+}  // namespace environment
+}  // namespace morphac
+
+#endif
@@ -1,13 +1,34 @@
 #ifndef ENVIRONMENT_H
 #define ENVIRONMENT_H
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include "Eigen/Dense"
 #include "common/aliases/include/eigen_aliases.h"
 #include "common/error_handling/include/error_macros.h"
+#include "constants/include/environment_constants.h"
+#include "math/geometry/include/polygons.h"
+#include "math/geometry/include/shapes.h"
 
 namespace morphac {
 namespace environment {
 
+// Rectangular region of the map data, spanning the rows [start_row, end_row)
+// and the columns [start_col, end_col).
+struct MapRegion {
+  int start_row;
+  int start_col;
+  int end_row;
+  int end_col;
+
+  MapRegion(const int start_row, const int start_col, const int end_row,
+            const int end_col);
+
+  bool IsEmpty() const;
+};
+
 class Map {
  public:
   Map(const double width, const double height, const double resolution);
@@ -19,18 +40,74 @@ class Map {
   // Get data function for constant Map objects.
   const morphac::common::aliases::MapData& get_data() const;
   // Get data function for when the data needs to be changed.
-  // This is what gets exposed in the python bindings so that we can do inplace
-  // numpy operations like map.data[:10, :10] = 0
+  // As the changes made through the reference can't be tracked, the whole map
+  // is marked dirty (See get_dirty_region). Hence the reference must not be
+  // used to modify the map once the dirty region has been cleared. Changes
+  // that are made later on should use set_data or SetRegion instead.
   morphac::common::aliases::MapData& get_data_ref();
 
   void set_data(const morphac::common::aliases::MapData& data);
+  // Copies the data into the region of the map starting at the given row and
+  // column, which must lie within the map. Only the region is marked dirty.
+  void SetRegion(const int start_row, const int start_col,
+                 const morphac::common::aliases::MapData& data);
+  // The evolved map carries over the dirty region of this map, expanded by the
+  // pixels that differ between the two maps.
   Map Evolve(const morphac::common::aliases::MapData& data);
 
+  // Bounding region of the pixels that may have changed since the dirty region
+  // was last cleared. Newly constructed maps have an empty dirty region. It
+  // lets derived data (See DistanceField::Update) be updated incrementally,
+  // by only looking at the region that changed.
+  const MapRegion& get_dirty_region() const;
+  void ClearDirtyRegion();
+
+  // Obstacles are added to the map in place, by filling (with
+  // MapConstants::OBSTACLE) the pixels whose canvas coordinates (See
+  // transforms.h) lie within the shape. The shapes are rasterized exactly, one
+  // row (scanline) at a time, and the parts of a shape that lie outside the
+  // map are ignored. Polygon boundaries follow the top left fill rule, so
+  // that adjacent polygons don't overlap.
+  // The functions that take a vector of shapes add all of them in a single
+  // call, which is how maps with a large number of obstacles are meant to be
+  // built.
+  void AddCircularObstacle(
+      const morphac::math::geometry::CircleShape& circle_shape);
+  void AddCircularObstacles(
+      const std::vector<morphac::math::geometry::CircleShape>& circle_shapes);
+  void AddRectangularObstacle(
+      const morphac::math::geometry::RectangleShape& rectangle_shape);
+  void AddRectangularObstacles(
+      const std::vector<morphac::math::geometry::RectangleShape>&
+          rectangle_shapes);
+  void AddRoundedRectangularObstacle(
+      const morphac::math::geometry::RoundedRectangleShape&
+          rounded_rectangle_shape);
+  void AddRoundedRectangularObstacles(
+      const std::vector<morphac::math::geometry::RoundedRectangleShape>&
+          rounded_rectangle_shapes);
+  void AddTriangularObstacle(
+      const morphac::math::geometry::TriangleShape& triangle_shape);
+  void AddTriangularObstacles(
+      const std::vector<morphac::math::geometry::TriangleShape>&
+          triangle_shapes);
+  // The polygon is given by its vertices (In the world frame), and may be
+  // non-convex or self intersecting (The even-odd rule is used).
+  void AddPolygonalObstacle(const morphac::common::aliases::Points& polygon);
+  void AddPolygonalObstacles(
+      const std::vector<morphac::common::aliases::Points>& polygons);
+
  private:
+  // Fills the columns [start_col, end_col) of the given row, clamped to the
+  // map.
+  void FillRow(const int row, const double start_col, const double end_col);
+  void ExpandDirtyRegion(const MapRegion& region);
+
   double width_;
   double height_;
   double resolution_;
   morphac::common::aliases::MapData data_;
+  MapRegion dirty_region_;
 };
 
 }  // namespace environment
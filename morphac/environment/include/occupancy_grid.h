@@ -0,0 +1,83 @@
+#ifndef OCCUPANCY_GRID_H
+#define OCCUPANCY_GRID_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "common/aliases/include/eigen_aliases.h"
+#include "common/error_handling/include/error_macros.h"
+#include "constants/include/environment_constants.h"
+#include "environment/include/map.h"
+
+namespace morphac {
+namespace environment {
+
+// Binary occupancy of a map, packed into a single bit per pixel. It follows
+// the pixel layout of Map (Row major, with the same dimensions for the same
+// width, height and resolution), but only records whether each pixel is an
+// obstacle (MapConstants::OBSTACLE), at a 32nd of the memory. This makes maps
+// that are far too large for MapData practical.
+//
+// Each row is stored as a sequence of 64 bit words, with the column col at the
+// bit col % 64 of the word col / 64. The region queries and fills process a
+// whole word (64 pixels) at a time.
+class OccupancyGrid {
+ public:
+  OccupancyGrid(const double width, const double height,
+                const double resolution);
+  // Conversions from the int representation. The pixels that are
+  // MapConstants::OBSTACLE are occupied, while any other value is free.
+  OccupancyGrid(const morphac::common::aliases::MapData& data,
+                const double resolution);
+  explicit OccupancyGrid(const Map& map);
+
+  double get_width() const;
+  double get_height() const;
+  double get_resolution() const;
+  int get_rows() const;
+  int get_cols() const;
+
+  // Conversions to the int representation, with the occupied pixels set to
+  // MapConstants::OBSTACLE and the rest to MapConstants::EMPTY.
+  morphac::common::aliases::MapData ToMapData() const;
+  Map ToMap() const;
+
+  bool IsOccupied(const int row, const int col) const;
+  void SetOccupied(const int row, const int col, const bool occupied);
+
+  // The regions must lie within the grid. Empty regions are allowed.
+  int64_t CountOccupied(const MapRegion& region) const;
+  // Whether no pixel of the region is occupied. Unlike CountOccupied, it stops
+  // at the first occupied word.
+  bool IsRegionFree(const MapRegion& region) const;
+  void FillRegion(const MapRegion& region, const bool occupied);
+
+ private:
+  // Number of pixels packed into a word.
+  static constexpr int kWordSize = 64;
+
+  static int CountBits(const uint64_t word);
+  // Mask of the bits of a word that lie within the columns
+  // [start_col, end_col), which must overlap the word.
+  static uint64_t ComputeMask(const int word, const int start_col,
+                              const int end_col);
+  uint64_t* GetRow(const int row);
+  const uint64_t* GetRow(const int row) const;
+  void CheckRegion(const MapRegion& region) const;
+
+  double width_;
+  double height_;
+  double resolution_;
+  int rows_;
+  int cols_;
+  int words_per_row_;
+  std::vector<uint64_t> words_;
+};
+
+}  // namespace environment
+}  // namespace morphac
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef TILED_MAP_H
+#define TILED_MAP_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/aliases/include/eigen_aliases.h"
+#include "common/error_handling/include/error_macros.h"
+#include "constants/include/environment_constants.h"
+#include "environment/include/map.h"
+
+namespace morphac {
+namespace environment {
+
+// Map for very large environments, with the pixel layout of Map (The same
+// dimensions for the same width, height and resolution), whose data is split
+// into square tiles of tile_size pixels along each side.
+//
+// The tiles are allocated on the first write of a non-empty value. Reading a
+// pixel of an unallocated tile returns MapConstants::EMPTY without allocating
+// it, so the memory is proportional to the area that has been written to,
+// and constructing even a huge map is nearly instant.
+//
+// The tiles are either kept in memory, or in a memory-mapped file (Only on
+// POSIX systems), in which case the operating system pages them in and out
+// as needed and the map may exceed the available memory. The file is
+// created sparse, so it only takes up disk space for the allocated tiles. It
+// is scratch storage for the map, and is removed as soon as it is opened.
+// Its disk space is released once the map is destroyed.
+class TiledMap {
+ public:
+  TiledMap(const double width, const double height, const double resolution,
+           const int tile_size = 256);
+  // Map whose tiles are stored in a new file at file_path. An existing file
+  // is only overwritten (Losing its contents) if overwrite is set, and
+  // otherwise a std::runtime_error is thrown.
+  TiledMap(const double width, const double height, const double resolution,
+           const std::string& file_path, const int tile_size = 256,
+           const bool overwrite = false);
+
+  // Delete copy constructor.
+  TiledMap(const TiledMap& tiled_map) = delete;
+
+  // Delete copy assignment.
+  TiledMap& operator=(const TiledMap& tiled_map) = delete;
+
+  ~TiledMap();
+
+  double get_width() const;
+  double get_height() const;
+  double get_resolution() const;
+  int get_rows() const;
+  int get_cols() const;
+  int get_tile_size() const;
+  int get_num_tiles() const;
+  int get_num_allocated_tiles() const;
+
+  int GetPixel(const int row, const int col) const;
+  void SetPixel(const int row, const int col, const int value);
+
+  // Data of the region, which must lie within the map.
+  morphac::common::aliases::MapData GetRegion(const MapRegion& region) const;
+  // Writes the data to the region that starts at (start_row, start_col). The
+  // data must fit within the map. Tiles that would only receive empty values
+  // aren't allocated.
+  void SetRegion(const int start_row, const int start_col,
+                 const morphac::common::aliases::MapData& data);
+  void FillRegion(const MapRegion& region, const int value);
+
+  // Dense copy of a part of the map, for the parts of the environment that
+  // the rest of the library (See DistanceField or Playground) works with. The
+  // returned map covers the region, with the resolution of the tiled map.
+  Map ToMap(const MapRegion& region) const;
+
+ private:
+  int ComputeTile(const int row, const int col) const;
+  // Allocates the tile (Filled with MapConstants::EMPTY) if needed.
+  int* AllocateTile(const int tile);
+  void CheckRegion(const MapRegion& region) const;
+  // Calls function(tile, tile_region) for each tile that overlaps the region,
+  // with tile_region being the part of the region within the tile.
+  template <typename Function>
+  void ForEachTile(const MapRegion& region, const Function& function) const;
+
+  // Creates and maps the file that backs the tiles.
+  void MapFile(const std::string& file_path, const bool overwrite);
+
+  double width_;
+  double height_;
+  double resolution_;
+  int rows_;
+  int cols_;
+  int tile_size_;
+  int tiles_per_row_;
+  // Number of pixels in a tile.
+  int64_t tile_area_;
+  // Start of each tile's pixels (Row major within the tile), or nullptr if
+  // the tile isn't allocated.
+  std::vector<int*> tiles_;
+  int num_allocated_tiles_;
+  // Storage of the tiles that are kept in memory.
+  std::vector<std::unique_ptr<int[]>> memory_tiles_;
+  // Mapped file that stores the tiles, with tile i at the offset
+  // i * tile_area_. It is nullptr for maps kept in memory.
+  int* file_data_;
+  size_t file_size_;
+  int file_descriptor_;
+};
+
+}  // namespace environment
+}  // namespace morphac
+
+#endif
@@ -0,0 +1,96 @@
+import numpy as np
+import pytest
+
+from morphac.constants.environment_constants import MapConstants
+from morphac.environment import DistanceField, Map
+from morphac.math.geometry import CircleShape
+
+
+@pytest.fixture()
+def generate_distance_field():
+
+    # Obstacles along the first column. The distance grows linearly along x.
+    env_map = Map(width=2.0, height=1.0, resolution=0.1)
+    env_map.data[:, 0] = MapConstants.OBSTACLE
+
+    return DistanceField(env_map)
+
+
+def test_construction():
+
+    # Single obstacle pixel.
+    env_map = Map(width=5.0, height=3.0, resolution=1.0)
+    env_map.data[1, 2] = MapConstants.OBSTACLE
+
+    for num_threads in [1, 4]:
+        distance_field = DistanceField(env_map, num_threads=num_threads)
+
+        assert distance_field.resolution == 1.0
+        # Distances are positive in free space and negative within obstacles.
+        assert np.allclose(
+            distance_field.data,
+            [
+                [np.sqrt(5), np.sqrt(2), 1, np.sqrt(2), np.sqrt(5)],
+                [2, 1, -1, 1, 2],
+                [np.sqrt(5), np.sqrt(2), 1, np.sqrt(2), np.sqrt(5)],
+            ],
+        )
+
+    # Invalid number of threads.
+    with pytest.raises(ValueError):
+        DistanceField(env_map, num_threads=0)
+
+
+def test_data(generate_distance_field):
+
+    distance_field = generate_distance_field
+
+    assert distance_field.data.shape == (10, 20)
+    assert np.allclose(distance_field.data[:, 0], -0.1)
+    assert np.allclose(distance_field.data[:, 5], 0.5)
+
+    # The data is read only.
+    with pytest.raises(ValueError):
+        distance_field.data[0, 0] = 1.0
+    with pytest.raises(AttributeError):
+        distance_field.data = np.zeros((10, 20))
+
+
+def test_compute_distance(generate_distance_field):
+
+    distance_field = generate_distance_field
+
+    assert np.isclose(distance_field.compute_distance([0.55, 0.52]), 0.55)
+    assert np.allclose(distance_field.compute_gradient([0.55, 0.52]), [1.0, 0.0])
+
+    # Batched queries.
+    points = np.array([[0.55, 0.52], [1.234, 0.1], [0.3, 0.9]])
+    assert np.allclose(distance_field.compute_distances(points), [0.55, 1.234, 0.3])
+    assert np.allclose(distance_field.compute_gradients(points), [[1.0, 0.0]] * 3)
+
+
+def test_update():
+
+    env_map = Map(width=5.0, height=3.0, resolution=1.0)
+    env_map.add_circular_obstacle(CircleShape(0.1, [2.0, 2.0]))
+    distance_field = DistanceField(env_map)
+
+    # Moving the obstacle pixel. Only the changed region is updated.
+    env_map.clear_dirty_region()
+    evolved_env_map = Map(width=5.0, height=3.0, resolution=1.0)
+    evolved_env_map.add_circular_obstacle(CircleShape(0.1, [4.0, 1.0]))
+    env_map = env_map.evolve(np.array(evolved_env_map.data))
+    distance_field.update(env_map)
+
+    assert np.allclose(distance_field.data, DistanceField(env_map).data)
+    assert distance_field.data[2, 4] == -1.0
+
+    # Regions written through set_region are updated as well.
+    env_map.clear_dirty_region()
+    env_map.set_region(0, 0, np.array([[MapConstants.OBSTACLE]]))
+    distance_field.update(env_map)
+    assert np.allclose(distance_field.data, DistanceField(env_map).data)
+
+    # The dimensions must match.
+    with pytest.raises(ValueError):
+        distance_field.update(Map(width=5.0, height=4.0, resolution=1.0))
@@ -7,7 +7,12 @@ from morphac.environment import (
     evolve_map_with_circular_obstacle,
     evolve_map_with_polygonal_obstacle,
 )
-from morphac.math.geometry import CircleShape
+from morphac.math.geometry import (
+    CircleShape,
+    RectangleShape,
+    RoundedRectangleShape,
+    TriangleShape,
+)
 
 
 @pytest.fixture()
@@ -121,6 +126,10 @@ def test_data(generate_map_list):
         map1.data = np.ones((2, 2))
     with pytest.raises(ValueError):
         map2.data = np.ones((2, 3))
+    with pytest.raises(ValueError):
+        map1.set_region(15, 0, np.zeros((10, 10)))
+    with pytest.raises(ValueError):
+        map1.set_region(-1, 0, np.zeros((1, 1)))
 
 
 def test_evolve(generate_map_list):
@@ -174,3 +183,130 @@ def test_evolve_with_polygonal_obstacle():
     # Also make sure that the original map is not mutated.
     assert np.allclose(env_map.data[:25, :100], MapConstants.EMPTY * np.ones([25, 100]))
 
+
+
+def test_copy(generate_map_list):
+
+    _, map2, _, _ = generate_map_list
+
+    map_copy = Map(map2)
+
+    assert map_copy.resolution == map2.resolution
+    assert np.allclose(map_copy.data, map2.data)
+
+    # The copy doesn't share the data.
+    map_copy.data[0, 0] = 10
+    assert map2.data[0, 0] == 1
+
+
+def test_add_obstacle():
+
+    # With a resolution of 1, the pixel (row, col) is at the world coordinate
+    # (col, height - row).
+    env_map = Map(width=10.0, height=10.0, resolution=1.0)
+
+    # The boundaries of polygons are half open (The top left fill rule).
+    env_map.add_rectangular_obstacle(RectangleShape(4.0, 2.0, 0.0, [5.0, 5.0]))
+    expected_data = np.zeros([10, 10])
+    expected_data[4:6, 3:7] = MapConstants.OBSTACLE
+    assert np.allclose(env_map.data, expected_data)
+
+    # Obstacles are added in place, on top of the existing ones.
+    env_map.add_circular_obstacle(CircleShape(1.5, [0.0, 10.0]))
+    expected_data[:2, :2] = MapConstants.OBSTACLE
+    assert np.allclose(env_map.data, expected_data)
+
+    env_map.add_triangular_obstacle(TriangleShape(4.0, 4.0, 0.0, [5.0, 5.5]))
+    expected_data[3:5, 5] = MapConstants.OBSTACLE
+    expected_data[5:7, 4:7] = MapConstants.OBSTACLE
+    assert np.allclose(env_map.data, expected_data)
+
+    env_map.add_polygonal_obstacle([[7.0, 3.0], [9.0, 3.0], [9.0, 1.0], [7.0, 1.0]])
+    expected_data[7:9, 7:9] = MapConstants.OBSTACLE
+    assert np.allclose(env_map.data, expected_data)
+
+    # Polygons must have at least three vertices.
+    with pytest.raises(ValueError):
+        env_map.add_polygonal_obstacle([[0.0, 0.0], [1.0, 1.0]])
+
+
+def test_add_obstacles():
+
+    # Adding the obstacles in a batch is the same as adding them one by one.
+    circle_shapes = [CircleShape(1.0, [2.0, 3.0]), CircleShape(0.5, [7.0, 7.0])]
+    rectangle_shapes = [RectangleShape(2.0, 1.0, 0.5, [1.0, 1.0])]
+    rounded_rectangle_shapes = [RoundedRectangleShape(3.0, 2.0, 1.0, 0.5, [5.0, 5.0])]
+    triangle_shapes = [TriangleShape(2.0, 2.0, 0.3, [3.0, 8.0])]
+    polygons = [
+        [[4.0, 0.0], [6.0, 0.0], [6.0, 2.0], [5.0, 1.0]],
+        np.array([[5.0, 1.0], [7.0, 1.0], [7.0, 3.0], [6.0, 2.0]]),
+    ]
+
+    batched_env_map = Map(width=10.0, height=10.0, resolution=0.1)
+    batched_env_map.add_circular_obstacles(circle_shapes)
+    batched_env_map.add_rectangular_obstacles(rectangle_shapes)
+    batched_env_map.add_rounded_rectangular_obstacles(rounded_rectangle_shapes)
+    batched_env_map.add_triangular_obstacles(triangle_shapes)
+    batched_env_map.add_polygonal_obstacles(polygons)
+
+    env_map = Map(width=10.0, height=10.0, resolution=0.1)
+    for circle_shape in circle_shapes:
+        env_map.add_circular_obstacle(circle_shape)
+    for rectangle_shape in rectangle_shapes:
+        env_map.add_rectangular_obstacle(rectangle_shape)
+    for rounded_rectangle_shape in rounded_rectangle_shapes:
+        env_map.add_rounded_rectangular_obstacle(rounded_rectangle_shape)
+    for triangle_shape in triangle_shapes:
+        env_map.add_triangular_obstacle(triangle_shape)
+    for polygon in polygons:
+        env_map.add_polygonal_obstacle(polygon)
+
+    assert np.array_equal(batched_env_map.data, env_map.data)
+    assert np.sum(env_map.data) > 0
+
+
+def test_dirty_region():
+
+    env_map = Map(width=10.0, height=5.0, resolution=0.1)
+    assert env_map.dirty_region.is_empty()
+
+    # The 1m square spans the rows [10, 20) and the columns [30, 40).
+    env_map.add_rectangular_obstacle(RectangleShape(1.0, 1.0, 0.0, [3.5, 3.5]))
+    dirty_region = env_map.dirty_region
+    assert (
+        dirty_region.start_row,
+        dirty_region.start_col,
+        dirty_region.end_row,
+        dirty_region.end_col,
+    ) == (10, 30, 20, 40)
+
+    env_map.clear_dirty_region()
+    assert env_map.dirty_region.is_empty()
+
+    # The evolved map is dirty where the data differs.
+    data = np.array(env_map.data)
+    data[2, 7] = MapConstants.OBSTACLE
+    env_map.clear_dirty_region()
+    dirty_region = env_map.evolve(data).dirty_region
+    assert (
+        dirty_region.start_row,
+        dirty_region.start_col,
+        dirty_region.end_row,
+        dirty_region.end_col,
+    ) == (2, 7, 3, 8)
+
+    # Writing a region only marks the region dirty.
+    env_map.clear_dirty_region()
+    env_map.set_region(3, 4, MapConstants.OBSTACLE * np.ones((2, 3)))
+    dirty_region = env_map.dirty_region
+    assert (
+        dirty_region.start_row,
+        dirty_region.start_col,
+        dirty_region.end_row,
+        dirty_region.end_col,
+    ) == (3, 4, 5, 7)
+
+    # Accessing the data marks the whole map dirty, as it may be modified in place.
+    env_map.data[0, 0] = MapConstants.OBSTACLE
+    assert env_map.dirty_region.end_row == 50
+    assert env_map.dirty_region.end_col == 100
@@ -0,0 +1,79 @@
+import numpy as np
+import pytest
+
+from morphac.constants.environment_constants import MapConstants
+from morphac.environment import Map, MapRegion, OccupancyGrid
+
+
+@pytest.fixture()
+def generate_occupancy_grid():
+
+    # Random obstacles, with a number of columns that isn't a multiple of the
+    # word size.
+    np.random.seed(7)
+    data = np.where(
+        np.random.rand(50, 150) < 0.3, MapConstants.OBSTACLE, MapConstants.EMPTY
+    )
+
+    return data, OccupancyGrid(data=data, resolution=0.1)
+
+
+def test_construction(generate_occupancy_grid):
+
+    occupancy_grid = OccupancyGrid(width=10.0, height=5.0, resolution=0.1)
+
+    assert occupancy_grid.rows == 50
+    assert occupancy_grid.cols == 100
+    assert occupancy_grid.resolution == 0.1
+    assert np.isclose(occupancy_grid.width, 10.0)
+    assert np.isclose(occupancy_grid.height, 5.0)
+    assert np.all(occupancy_grid.to_map_data() == MapConstants.EMPTY)
+
+    # Invalid resolution.
+    with pytest.raises(ValueError):
+        OccupancyGrid(width=10.0, height=5.0, resolution=0.3)
+
+
+def test_conversion(generate_occupancy_grid):
+
+    data, occupancy_grid = generate_occupancy_grid
+
+    assert np.array_equal(occupancy_grid.to_map_data(), data)
+    assert np.array_equal(occupancy_grid.to_map().data, data)
+    assert np.array_equal(
+        OccupancyGrid(Map(data=data, resolution=0.1)).to_map_data(), data
+    )
+
+
+def test_occupancy(generate_occupancy_grid):
+
+    data, occupancy_grid = generate_occupancy_grid
+
+    assert occupancy_grid.is_occupied(3, 64) == (data[3, 64] == MapConstants.OBSTACLE)
+
+    occupancy_grid.set_occupied(3, 64, True)
+    assert occupancy_grid.is_occupied(3, 64)
+    occupancy_grid.set_occupied(3, 64, False)
+    assert not occupancy_grid.is_occupied(3, 64)
+
+    with pytest.raises(IndexError):
+        occupancy_grid.is_occupied(50, 0)
+
+
+def test_region_queries(generate_occupancy_grid):
+
+    data, occupancy_grid = generate_occupancy_grid
+
+    region = MapRegion(start_row=3, start_col=60, end_row=20, end_col=131)
+    expected_count = np.sum(data[3:20, 60:131] == MapConstants.OBSTACLE)
+    assert occupancy_grid.count_occupied(region) == expected_count
+    assert not occupancy_grid.is_region_free(region)
+
+    occupancy_grid.fill_region(region, False)
+    assert occupancy_grid.is_region_free(region)
+    assert occupancy_grid.count_occupied(MapRegion(0, 0, 50, 150)) == (
+        np.sum(data == MapConstants.OBSTACLE) - expected_count
+    )
+
+    with pytest.raises(IndexError):
+        occupancy_grid.count_occupied(MapRegion(0, 0, 51, 150))
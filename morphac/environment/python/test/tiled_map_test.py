@@ -0,0 +1,89 @@
+import os
+
+import numpy as np
+import pytest
+
+from morphac.constants.environment_constants import MapConstants
+from morphac.environment import MapRegion, TiledMap
+
+
+@pytest.fixture()
+def generate_tiled_map():
+
+    # 50 x 70 pixels, in 16 x 16 tiles.
+    return TiledMap(width=7.0, height=5.0, resolution=0.1, tile_size=16)
+
+
+def test_construction(generate_tiled_map):
+
+    tiled_map = generate_tiled_map
+
+    assert tiled_map.rows == 50
+    assert tiled_map.cols == 70
+    assert tiled_map.tile_size == 16
+    assert tiled_map.num_tiles == 20
+    assert tiled_map.num_allocated_tiles == 0
+
+    # Huge maps don't allocate any tiles.
+    huge_tiled_map = TiledMap(width=2000.0, height=2000.0, resolution=0.02)
+    assert huge_tiled_map.rows == 100000
+    assert huge_tiled_map.get_pixel(54321, 98765) == MapConstants.EMPTY
+    assert huge_tiled_map.num_allocated_tiles == 0
+
+    with pytest.raises(ValueError):
+        TiledMap(width=7.0, height=5.0, resolution=0.1, tile_size=0)
+
+
+def test_pixels(generate_tiled_map):
+
+    tiled_map = generate_tiled_map
+
+    tiled_map.set_pixel(20, 30, MapConstants.OBSTACLE)
+    assert tiled_map.get_pixel(20, 30) == MapConstants.OBSTACLE
+    assert tiled_map.get_pixel(20, 31) == MapConstants.EMPTY
+    assert tiled_map.num_allocated_tiles == 1
+
+    with pytest.raises(IndexError):
+        tiled_map.get_pixel(50, 0)
+
+
+def test_regions(generate_tiled_map):
+
+    tiled_map = generate_tiled_map
+
+    data = np.random.randint(0, 5, size=(30, 40))
+    tiled_map.set_region(10, 20, data)
+    assert np.array_equal(tiled_map.get_region(MapRegion(10, 20, 40, 60)), data)
+    assert np.all(tiled_map.get_region(MapRegion(0, 0, 10, 70)) == MapConstants.EMPTY)
+
+    tiled_map.fill_region(MapRegion(0, 0, 5, 5), MapConstants.OBSTACLE)
+    env_map = tiled_map.to_map(MapRegion(0, 0, 10, 10))
+    assert env_map.resolution == 0.1
+    assert np.sum(env_map.data) == 25 * MapConstants.OBSTACLE
+
+
+def test_file_backed(tmp_path):
+
+    file_path = os.path.join(str(tmp_path), "tiled_map.bin")
+    tiled_map = TiledMap(
+        width=7.0, height=5.0, resolution=0.1, file_path=file_path, tile_size=16
+    )
+
+    tiled_map.fill_region(MapRegion(10, 10, 20, 20), MapConstants.OBSTACLE)
+    assert tiled_map.get_pixel(15, 15) == MapConstants.OBSTACLE
+    assert tiled_map.get_pixel(0, 0) == MapConstants.EMPTY
+
+    # The file is removed once it is mapped.
+    assert not os.path.exists(file_path)
+
+    # An existing file is only overwritten if it is asked for.
+    del tiled_map
+    with open(file_path, "w") as map_file:
+        map_file.write("map")
+    with pytest.raises(RuntimeError):
+        TiledMap(width=7.0, height=5.0, resolution=0.1, file_path=file_path)
+    overwritten_tiled_map = TiledMap(
+        width=7.0, height=5.0, resolution=0.1, file_path=file_path, overwrite=True
+    )
+    assert overwritten_tiled_map.get_pixel(15, 15) == MapConstants.EMPTY
+    assert not os.path.exists(file_path)
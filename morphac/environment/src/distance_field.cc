@@ -0,0 +1,410 @@
+#include "environment/include/distance_field.h"
+
+namespace morphac {
+namespace environment {
+
+using std::floor;
+using std::isinf;
+using std::max;
+using std::min;
+using std::sqrt;
+using std::vector;
+
+using Eigen::VectorXd;
+
+using morphac::common::aliases::DistanceFieldData;
+using morphac::common::aliases::MapData;
+using morphac::common::aliases::Point;
+using morphac::common::aliases::Points;
+using morphac::constants::MapConstants;
+using morphac::environment::Map;
+using morphac::environment::MapRegion;
+using morphac::utils::ThreadPool;
+
+// Squared distance of the columns that have no site. It is finite (Unlike
+// infinity) so that the parabola intersections remain well defined, while
+// being much larger than any squared distance within a map.
+constexpr double kUnreachable = 1e20;
+// Number of columns that are swept together in the column pass.
+constexpr int kColumnBlockSize = 64;
+
+DistanceField::DistanceField(const Map& map, const int num_threads)
+    : resolution_(map.get_resolution()),
+      rows_(map.get_data().rows()),
+      cols_(map.get_data().cols()),
+      occupancy_(rows_ * cols_),
+      obstacle_sites_{true, {}, vector<bool>(rows_ * cols_)},
+      free_sites_{false, {}, vector<bool>(rows_ * cols_)} {
+  MORPH_REQUIRE(num_threads > 0, std::invalid_argument,
+                "Number of threads must be positive.");
+  ThreadPool thread_pool(num_threads);
+  const MapData& map_data = map.get_data();
+
+  for (int row = 0; row < rows_; ++row) {
+    for (int col = 0; col < cols_; ++col) {
+      occupancy_[row * cols_ + col] =
+          map_data(row, col) == MapConstants::OBSTACLE;
+    }
+  }
+
+  // Nearest obstacle pixel and nearest free pixel. Each pixel is its own
+  // nearest site in exactly one of them.
+  obstacle_sites_.sites = ComputeNearestSites(
+      [&](const int row, const int col) {
+        return map_data(row, col) == MapConstants::OBSTACLE;
+      },
+      thread_pool);
+  free_sites_.sites = ComputeNearestSites(
+      [&](const int row, const int col) {
+        return map_data(row, col) != MapConstants::OBSTACLE;
+      },
+      thread_pool);
+
+  data_ = DistanceFieldData(rows_, cols_);
+  thread_pool.ParallelFor(rows_, [&](const int row) {
+    for (int col = 0; col < cols_; ++col) {
+      data_(row, col) = ComputeSignedDistance(row * cols_ + col);
+    }
+  });
+}
+
+double DistanceField::get_resolution() const { return resolution_; }
+
+const DistanceFieldData& DistanceField::get_data() const { return data_; }
+
+void DistanceField::Update(const Map& map) {
+  const MapData& map_data = map.get_data();
+  MORPH_REQUIRE(map_data.rows() == rows_ && map_data.cols() == cols_,
+                std::invalid_argument, "Map dimensions do not match.");
+  MORPH_REQUIRE(map.get_resolution() == resolution_, std::invalid_argument,
+                "Map resolution does not match.");
+
+  // The pixels that changed occupancy start the waves of both transforms.
+  // A new obstacle pixel is a new site of the obstacle transform, and no
+  // longer a site of the free transform (And vice versa).
+  WaveQueue obstacle_queue, free_queue;
+  vector<int> updated_pixels;
+  const MapRegion& dirty_region = map.get_dirty_region();
+  for (int row = dirty_region.start_row; row < dirty_region.end_row; ++row) {
+    for (int col = dirty_region.start_col; col < dirty_region.end_col; ++col) {
+      const int pixel = row * cols_ + col;
+      const bool occupancy = map_data(row, col) == MapConstants::OBSTACLE;
+      if (occupancy == occupancy_[pixel]) {
+        continue;
+      }
+      occupancy_[pixel] = occupancy;
+      if (occupancy) {
+        SetSite(pixel, obstacle_sites_, obstacle_queue, updated_pixels);
+        RemoveSite(pixel, free_sites_, free_queue, updated_pixels);
+      } else {
+        RemoveSite(pixel, obstacle_sites_, obstacle_queue, updated_pixels);
+        SetSite(pixel, free_sites_, free_queue, updated_pixels);
+      }
+    }
+  }
+
+  PropagateWaves(obstacle_sites_, obstacle_queue, updated_pixels);
+  PropagateWaves(free_sites_, free_queue, updated_pixels);
+
+  // A pixel may have been updated several times, in which case it is simply
+  // recomputed again.
+  for (const int pixel : updated_pixels) {
+    data_(pixel / cols_, pixel % cols_) = ComputeSignedDistance(pixel);
+  }
+}
+
+template <typename IsSite>
+vector<int> DistanceField::ComputeNearestSites(
+    const IsSite& is_site, ThreadPool& thread_pool) const {
+  // Row of the nearest site in the same column, or -1 if there is none.
+  vector<int> nearest_rows(rows_ * cols_);
+
+  // The transform is separable. The column pass finds the nearest site in the
+  // same column, and the row pass combines them along the rows. The lines of
+  // each pass are independent of each other.
+  // As the sites are binary, the column pass is a downward and an upward
+  // sweep. The sweeps process blocks of columns at a time, so that the memory
+  // is accessed along the (row major) rows.
+  const int num_column_blocks =
+      (cols_ + kColumnBlockSize - 1) / kColumnBlockSize;
+  thread_pool.ParallelFor(num_column_blocks, [&](const int column_block) {
+    const int start_col = column_block * kColumnBlockSize;
+    const int end_col = min(start_col + kColumnBlockSize, cols_);
+    for (int row = 0; row < rows_; ++row) {
+      for (int col = start_col; col < end_col; ++col) {
+        const int pixel = row * cols_ + col;
+        if (is_site(row, col)) {
+          nearest_rows[pixel] = row;
+        } else {
+          nearest_rows[pixel] = row == 0 ? -1 : nearest_rows[pixel - cols_];
+        }
+      }
+    }
+    // The nearest site above a pixel is known after the downward sweep, so
+    // the upward sweep only compares it with the nearest site below it.
+    for (int row = rows_ - 2; row >= 0; --row) {
+      for (int col = start_col; col < end_col; ++col) {
+        const int pixel = row * cols_ + col;
+        const int above = nearest_rows[pixel];
+        const int below = nearest_rows[pixel + cols_];
+        if (below >= 0 && (above < 0 || below - row < row - above)) {
+          nearest_rows[pixel] = below;
+        }
+      }
+    }
+  });
+
+  vector<int> nearest_sites(rows_ * cols_);
+  thread_pool.ParallelFor(rows_, [&](const int row) {
+    vector<double> f(cols_), boundaries(cols_ + 1);
+    vector<int> nearest_cols(cols_), parabola_vertices(cols_);
+    for (int col = 0; col < cols_; ++col) {
+      const int nearest_row = nearest_rows[row * cols_ + col];
+      f[col] = nearest_row < 0 ? kUnreachable
+                               : static_cast<double>(row - nearest_row) *
+                                     (row - nearest_row);
+    }
+    ComputeNearestSamples(f, nearest_cols, parabola_vertices, boundaries);
+    for (int col = 0; col < cols_; ++col) {
+      const int nearest_col = nearest_cols[col];
+      const int nearest_row = nearest_rows[row * cols_ + nearest_col];
+      nearest_sites[row * cols_ + col] =
+          nearest_row < 0 ? -1 : nearest_row * cols_ + nearest_col;
+    }
+  });
+
+  return nearest_sites;
+}
+
+void DistanceField::ComputeNearestSamples(const vector<double>& f,
+                                          vector<int>& nearest_samples,
+                                          vector<int>& parabola_vertices,
+                                          vector<double>& boundaries) {
+  // The squared distance is the lower envelope of the parabolas
+  // (q - p)^2 + f(p), rooted at each sample p. The parabolas that form the
+  // envelope are found in a single sweep, along with the boundaries between
+  // them.
+  const int size = f.size();
+  int num_parabolas = 0;
+  parabola_vertices[0] = 0;
+  boundaries[0] = -std::numeric_limits<double>::infinity();
+  boundaries[1] = std::numeric_limits<double>::infinity();
+
+  for (int q = 1; q < size; ++q) {
+    // Intersection of the parabola at q with the rightmost parabola of the
+    // envelope. The envelope parabolas that are hidden by the new one are
+    // removed. The first boundary is at negative infinity, so the first
+    // parabola is never removed.
+    double intersection;
+    while (true) {
+      const int p = parabola_vertices[num_parabolas];
+      intersection = ((f[q] + static_cast<double>(q) * q) -
+                      (f[p] + static_cast<double>(p) * p)) /
+                     (2. * (q - p));
+      if (intersection > boundaries[num_parabolas]) {
+        break;
+      }
+      --num_parabolas;
+    }
+    ++num_parabolas;
+    parabola_vertices[num_parabolas] = q;
+    boundaries[num_parabolas] = intersection;
+    boundaries[num_parabolas + 1] = std::numeric_limits<double>::infinity();
+  }
+
+  // Evaluating the envelope.
+  int parabola = 0;
+  for (int q = 0; q < size; ++q) {
+    while (boundaries[parabola + 1] < q) {
+      ++parabola;
+    }
+    nearest_samples[q] = parabola_vertices[parabola];
+  }
+}
+
+double DistanceField::ComputeSquaredDistance(const int pixel,
+                                             const int site) const {
+  if (site < 0) {
+    return std::numeric_limits<double>::infinity();
+  }
+  const double row_offset = pixel / cols_ - site / cols_;
+  const double col_offset = pixel % cols_ - site % cols_;
+  return row_offset * row_offset + col_offset * col_offset;
+}
+
+double DistanceField::ComputeSignedDistance(const int pixel) const {
+  const int obstacle_site = obstacle_sites_.sites[pixel];
+  const int free_site = free_sites_.sites[pixel];
+  if (obstacle_site < 0) {
+    // There are no obstacles.
+    return std::numeric_limits<double>::infinity();
+  }
+  if (free_site < 0) {
+    // There is no free space.
+    return -std::numeric_limits<double>::infinity();
+  }
+  return resolution_ * (sqrt(ComputeSquaredDistance(pixel, obstacle_site)) -
+                        sqrt(ComputeSquaredDistance(pixel, free_site)));
+}
+
+bool DistanceField::IsValidSite(const NearestSites& nearest_sites,
+                                const int site) const {
+  return site >= 0 && occupancy_[site] == nearest_sites.site_occupancy;
+}
+
+void DistanceField::SetSite(const int pixel, NearestSites& nearest_sites,
+                            WaveQueue& queue, vector<int>& updated_pixels) {
+  nearest_sites.sites[pixel] = pixel;
+  queue.emplace(0., pixel);
+  updated_pixels.push_back(pixel);
+}
+
+void DistanceField::RemoveSite(const int pixel, NearestSites& nearest_sites,
+                               WaveQueue& queue, vector<int>& updated_pixels) {
+  nearest_sites.sites[pixel] = -1;
+  nearest_sites.to_raise[pixel] = true;
+  queue.emplace(0., pixel);
+  updated_pixels.push_back(pixel);
+}
+
+void DistanceField::PropagateWaves(NearestSites& nearest_sites,
+                                   WaveQueue& queue,
+                                   vector<int>& updated_pixels) {
+  // The pixels are processed in the order of their (old) squared distances,
+  // so that the waves spread outwards like a brushfire. A pixel may be queued
+  // more than once, which is harmless as processing it again changes nothing.
+  while (!queue.empty()) {
+    const int pixel = queue.top().second;
+    queue.pop();
+    if (nearest_sites.to_raise[pixel]) {
+      Raise(pixel, nearest_sites, queue, updated_pixels);
+    } else if (IsValidSite(nearest_sites, nearest_sites.sites[pixel])) {
+      Lower(pixel, nearest_sites, queue, updated_pixels);
+    }
+  }
+}
+
+void DistanceField::Raise(const int pixel, NearestSites& nearest_sites,
+                          WaveQueue& queue, vector<int>& updated_pixels) {
+  const int row = pixel / cols_;
+  const int col = pixel % cols_;
+  for (int neighbor_row = max(row - 1, 0);
+       neighbor_row <= min(row + 1, rows_ - 1); ++neighbor_row) {
+    for (int neighbor_col = max(col - 1, 0);
+         neighbor_col <= min(col + 1, cols_ - 1); ++neighbor_col) {
+      const int neighbor = neighbor_row * cols_ + neighbor_col;
+      const int site = nearest_sites.sites[neighbor];
+      if (site < 0 || nearest_sites.to_raise[neighbor]) {
+        continue;
+      }
+      const double squared_distance = ComputeSquaredDistance(neighbor, site);
+      if (!IsValidSite(nearest_sites, site)) {
+        nearest_sites.sites[neighbor] = -1;
+        nearest_sites.to_raise[neighbor] = true;
+        updated_pixels.push_back(neighbor);
+      }
+      queue.emplace(squared_distance, neighbor);
+    }
+  }
+  nearest_sites.to_raise[pixel] = false;
+}
+
+void DistanceField::Lower(const int pixel, NearestSites& nearest_sites,
+                          WaveQueue& queue, vector<int>& updated_pixels) {
+  const int site = nearest_sites.sites[pixel];
+  const int row = pixel / cols_;
+  const int col = pixel % cols_;
+  for (int neighbor_row = max(row - 1, 0);
+       neighbor_row <= min(row + 1, rows_ - 1); ++neighbor_row) {
+    for (int neighbor_col = max(col - 1, 0);
+         neighbor_col <= min(col + 1, cols_ - 1); ++neighbor_col) {
+      const int neighbor = neighbor_row * cols_ + neighbor_col;
+      if (nearest_sites.to_raise[neighbor]) {
+        continue;
+      }
+      const double squared_distance = ComputeSquaredDistance(neighbor, site);
+      if (squared_distance <
+          ComputeSquaredDistance(neighbor, nearest_sites.sites[neighbor])) {
+        nearest_sites.sites[neighbor] = site;
+        queue.emplace(squared_distance, neighbor);
+        updated_pixels.push_back(neighbor);
+      }
+    }
+  }
+}
+
+void DistanceField::ComputeCell(const Point& point, int& row, int& col,
+                                double& row_offset, double& col_offset) const {
+  // Continuous pixel coordinates of the point, clamped to the map.
+  const double continuous_row =
+      min(max(rows_ - point(1) / resolution_, 0.), rows_ - 1.);
+  const double continuous_col =
+      min(max(point(0) / resolution_, 0.), cols_ - 1.);
+
+  // The cell of the last row (or column) is the one before it, unless the
+  // map is a single pixel wide.
+  row = min(static_cast<int>(floor(continuous_row)), max(rows_ - 2, 0));
+  col = min(static_cast<int>(floor(continuous_col)), max(cols_ - 2, 0));
+  row_offset = continuous_row - row;
+  col_offset = continuous_col - col;
+}
+
+double DistanceField::ComputeDistance(const Point& point) const {
+  int row, col;
+  double row_offset, col_offset;
+  ComputeCell(point, row, col, row_offset, col_offset);
+  if (isinf(data_(row, col))) {
+    // The distance is infinite everywhere.
+    return data_(row, col);
+  }
+
+  const int next_row = min(row + 1, rows_ - 1);
+  const int next_col = min(col + 1, cols_ - 1);
+  const double top = (1 - col_offset) * data_(row, col) +
+                     col_offset * data_(row, next_col);
+  const double bottom = (1 - col_offset) * data_(next_row, col) +
+                        col_offset * data_(next_row, next_col);
+  return (1 - row_offset) * top + row_offset * bottom;
+}
+
+Point DistanceField::ComputeGradient(const Point& point) const {
+  int row, col;
+  double row_offset, col_offset;
+  ComputeCell(point, row, col, row_offset, col_offset);
+  if (isinf(data_(row, col))) {
+    return Point::Zero();
+  }
+
+  const int next_row = min(row + 1, rows_ - 1);
+  const int next_col = min(col + 1, cols_ - 1);
+  // Derivatives of the bilinear interpolation along the columns and rows.
+  const double col_derivative =
+      (1 - row_offset) * (data_(row, next_col) - data_(row, col)) +
+      row_offset * (data_(next_row, next_col) - data_(next_row, col));
+  const double row_derivative =
+      (1 - col_offset) * (data_(next_row, col) - data_(row, col)) +
+      col_offset * (data_(next_row, next_col) - data_(row, next_col));
+
+  // The x axis is along the columns, while the y axis is opposite to the
+  // rows.
+  return Point{col_derivative, -row_derivative} / resolution_;
+}
+
+VectorXd DistanceField::ComputeDistances(const Points& points) const {
+  VectorXd distances(points.rows());
+  for (int i = 0; i < points.rows(); ++i) {
+    distances(i) = ComputeDistance(points.row(i).transpose());
+  }
+  return distances;
+}
+
+Points DistanceField::ComputeGradients(const Points& points) const {
+  Points gradients(points.rows(), 2);
+  for (int i = 0; i < points.rows(); ++i) {
+    gradients.row(i) = ComputeGradient(points.row(i).transpose()).transpose();
+  }
+  return gradients;
+}
+
+}  // namespace environment
+}  // namespace morphac
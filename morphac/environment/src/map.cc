@@ -3,11 +3,44 @@
 namespace morphac {
 namespace environment {
 
+using std::ceil;
+using std::floor;
+using std::max;
+using std::min;
+using std::sort;
+using std::sqrt;
+using std::vector;
+
+using Eigen::VectorXd;
+
 using morphac::common::aliases::MapData;
+using morphac::common::aliases::Point;
+using morphac::common::aliases::Points;
+using morphac::constants::MapConstants;
 using morphac::environment::Map;
+using morphac::math::geometry::CircleShape;
+using morphac::math::geometry::CreateRectangularPolygon;
+using morphac::math::geometry::CreateTriangularPolygon;
+using morphac::math::geometry::RectangleShape;
+using morphac::math::geometry::RoundedRectangleShape;
+using morphac::math::geometry::TriangleShape;
+
+MapRegion::MapRegion(const int start_row, const int start_col,
+                     const int end_row, const int end_col)
+    : start_row(start_row),
+      start_col(start_col),
+      end_row(end_row),
+      end_col(end_col) {}
+
+bool MapRegion::IsEmpty() const {
+  return start_row >= end_row || start_col >= end_col;
+}
 
 Map::Map(const double width, const double height, const double resolution)
-    : width_(width), height_(height), resolution_(resolution) {
+    : width_(width),
+      height_(height),
+      resolution_(resolution),
+      dirty_region_{0, 0, 0, 0} {
   MORPH_REQUIRE(width_ > 0, std::invalid_argument, "Non-positive map width.");
   MORPH_REQUIRE(height_ > 0, std::invalid_argument, "Non-positive map height.");
   MORPH_REQUIRE(resolution_ > 0, std::invalid_argument,
@@ -35,7 +68,8 @@ Map::Map(const double width, const double height, const double resolution)
 Map::Map(const MapData& data, const double resolution)
     : width_(data.cols() * resolution),
       height_(data.rows() * resolution),
-      resolution_(resolution) {
+      resolution_(resolution),
+      dirty_region_{0, 0, 0, 0} {
   MORPH_REQUIRE(data.cols() > 0, std::invalid_argument,
                 "Non-positive data width.");
   MORPH_REQUIRE(data.rows() > 0, std::invalid_argument,
@@ -69,7 +103,11 @@ double Map::get_resolution() const { return resolution_; }
 
 const MapData& Map::get_data() const { return data_; }
 
-MapData& Map::get_data_ref() { return data_; }
+MapData& Map::get_data_ref() {
+  ExpandDirtyRegion(MapRegion{0, 0, static_cast<int>(data_.rows()),
+                              static_cast<int>(data_.cols())});
+  return data_;
+}
 
 void Map::set_data(const MapData& data) {
   // The data needs to have the same dimensions
@@ -78,6 +116,20 @@ void Map::set_data(const MapData& data) {
   MORPH_REQUIRE((data.cols() * this->resolution_) == this->width_,
                 std::invalid_argument, "Data width does not match.");
   data_ = data;
+  ExpandDirtyRegion(MapRegion{0, 0, static_cast<int>(data_.rows()),
+                              static_cast<int>(data_.cols())});
+}
+
+void Map::SetRegion(const int start_row, const int start_col,
+                    const MapData& data) {
+  MORPH_REQUIRE(start_row >= 0 && start_col >= 0 &&
+                    start_row + data.rows() <= data_.rows() &&
+                    start_col + data.cols() <= data_.cols(),
+                std::invalid_argument, "Region does not lie within the map.");
+  data_.block(start_row, start_col, data.rows(), data.cols()) = data;
+  ExpandDirtyRegion(MapRegion{start_row, start_col,
+                              start_row + static_cast<int>(data.rows()),
+                              start_col + static_cast<int>(data.cols())});
 }
 
 Map Map::Evolve(const MapData& data) {
@@ -85,7 +137,193 @@ Map Map::Evolve(const MapData& data) {
                 "Data height does not match.")
   MORPH_REQUIRE(this->data_.cols() == data.cols(), std::invalid_argument,
                 "Data width does not match.")
-  return Map(data, this->resolution_);
+  Map evolved_map(data, this->resolution_);
+  evolved_map.dirty_region_ = this->dirty_region_;
+
+  // Only the first and last differing pixels of each row are needed for the
+  // bounding region.
+  for (int row = 0; row < data.rows(); ++row) {
+    int start_col = 0;
+    while (start_col < data.cols() &&
+           data(row, start_col) == this->data_(row, start_col)) {
+      ++start_col;
+    }
+    if (start_col == data.cols()) {
+      continue;
+    }
+    int end_col = data.cols();
+    while (data(row, end_col - 1) == this->data_(row, end_col - 1)) {
+      --end_col;
+    }
+    evolved_map.ExpandDirtyRegion(
+        MapRegion{row, start_col, row + 1, end_col});
+  }
+
+  return evolved_map;
+}
+
+const MapRegion& Map::get_dirty_region() const { return dirty_region_; }
+
+void Map::ClearDirtyRegion() { dirty_region_ = MapRegion{0, 0, 0, 0}; }
+
+void Map::ExpandDirtyRegion(const MapRegion& region) {
+  if (region.IsEmpty()) {
+    return;
+  }
+  if (dirty_region_.IsEmpty()) {
+    dirty_region_ = region;
+    return;
+  }
+  dirty_region_.start_row = min(dirty_region_.start_row, region.start_row);
+  dirty_region_.start_col = min(dirty_region_.start_col, region.start_col);
+  dirty_region_.end_row = max(dirty_region_.end_row, region.end_row);
+  dirty_region_.end_col = max(dirty_region_.end_col, region.end_col);
+}
+
+void Map::FillRow(const int row, const double start_col,
+                  const double end_col) {
+  // The bounds are clamped before being cast, as shapes may extend far beyond
+  // the map.
+  const double start = max(0., start_col);
+  const double end = min(static_cast<double>(data_.cols()), end_col);
+  if (start < end) {
+    data_.row(row)
+        .segment(static_cast<int>(start), static_cast<int>(end - start))
+        .setConstant(MapConstants::OBSTACLE);
+    ExpandDirtyRegion(MapRegion{row, static_cast<int>(start), row + 1,
+                                static_cast<int>(end)});
+  }
+}
+
+void Map::AddCircularObstacle(const CircleShape& circle_shape) {
+  // Circle in (continuous) canvas coordinates.
+  const double center_row =
+      data_.rows() - circle_shape.center(1) / resolution_;
+  const double center_col = circle_shape.center(0) / resolution_;
+  const double radius = circle_shape.radius / resolution_;
+
+  const double start_row = max(0., ceil(center_row - radius));
+  const double end_row = min(data_.rows() - 1., floor(center_row + radius));
+  if (start_row > end_row) {
+    // The circle lies outside the map.
+    return;
+  }
+
+  for (int row = start_row; row <= end_row; ++row) {
+    // Half of the chord of the circle along the row.
+    const double row_offset = row - center_row;
+    const double half_width =
+        sqrt(max(0., radius * radius - row_offset * row_offset));
+    FillRow(row, ceil(center_col - half_width),
+            floor(center_col + half_width) + 1);
+  }
+}
+
+void Map::AddCircularObstacles(const vector<CircleShape>& circle_shapes) {
+  for (const auto& circle_shape : circle_shapes) {
+    AddCircularObstacle(circle_shape);
+  }
+}
+
+void Map::AddRectangularObstacle(const RectangleShape& rectangle_shape) {
+  AddPolygonalObstacle(CreateRectangularPolygon(rectangle_shape));
+}
+
+void Map::AddRectangularObstacles(
+    const vector<RectangleShape>& rectangle_shapes) {
+  for (const auto& rectangle_shape : rectangle_shapes) {
+    AddRectangularObstacle(rectangle_shape);
+  }
+}
+
+void Map::AddRoundedRectangularObstacle(
+    const RoundedRectangleShape& rounded_rectangle_shape) {
+  // The rounded rectangle is the union of two (cross shaped) rectangles and
+  // the four circles that form the corners. Rasterizing them individually is
+  // exact, unlike rasterizing a polygonal approximation of the arcs.
+  const double size_x = rounded_rectangle_shape.size_x;
+  const double size_y = rounded_rectangle_shape.size_y;
+  const double angle = rounded_rectangle_shape.angle;
+  const double radius = rounded_rectangle_shape.radius;
+  const Point& center = rounded_rectangle_shape.center;
+
+  AddRectangularObstacle(
+      RectangleShape{size_x, size_y - 2 * radius, angle, center});
+  AddRectangularObstacle(
+      RectangleShape{size_x - 2 * radius, size_y, angle, center});
+
+  const Points corners = CreateRectangularPolygon(RectangleShape{
+      size_x - 2 * radius, size_y - 2 * radius, angle, center});
+  for (int i = 0; i < corners.rows(); ++i) {
+    AddCircularObstacle(CircleShape{radius, corners.row(i).transpose()});
+  }
+}
+
+void Map::AddRoundedRectangularObstacles(
+    const vector<RoundedRectangleShape>& rounded_rectangle_shapes) {
+  for (const auto& rounded_rectangle_shape : rounded_rectangle_shapes) {
+    AddRoundedRectangularObstacle(rounded_rectangle_shape);
+  }
+}
+
+void Map::AddTriangularObstacle(const TriangleShape& triangle_shape) {
+  AddPolygonalObstacle(CreateTriangularPolygon(triangle_shape));
+}
+
+void Map::AddTriangularObstacles(
+    const vector<TriangleShape>& triangle_shapes) {
+  for (const auto& triangle_shape : triangle_shapes) {
+    AddTriangularObstacle(triangle_shape);
+  }
+}
+
+void Map::AddPolygonalObstacle(const Points& polygon) {
+  MORPH_REQUIRE(polygon.rows() >= 3, std::invalid_argument,
+                "Polygon must have at least three vertices.");
+  const int num_vertices = polygon.rows();
+
+  // Vertices in (continuous) canvas coordinates. Unlike WorldToCanvas, they
+  // aren't rounded to pixels, so that the rasterization is exact.
+  const VectorXd vertex_rows =
+      (data_.rows() - polygon.col(1).array() / resolution_).matrix();
+  const VectorXd vertex_cols = polygon.col(0) / resolution_;
+
+  const double start_row = max(0., ceil(vertex_rows.minCoeff()));
+  const double end_row = min(data_.rows() - 1., floor(vertex_rows.maxCoeff()));
+  if (start_row > end_row) {
+    // The polygon lies outside the map.
+    return;
+  }
+
+  // Columns at which the polygon edges cross the current row.
+  vector<double> crossings;
+  for (int row = start_row; row <= end_row; ++row) {
+    crossings.clear();
+    for (int i = 0, j = num_vertices - 1; i < num_vertices; j = i++) {
+      // The edges include their end with the smaller row but not the other
+      // one, so that a vertex on the row is only counted once. This also
+      // skips the edges along the row.
+      if ((vertex_rows(i) <= row) != (vertex_rows(j) <= row)) {
+        crossings.push_back(vertex_cols(j) +
+                            (row - vertex_rows(j)) *
+                                (vertex_cols(i) - vertex_cols(j)) /
+                                (vertex_rows(i) - vertex_rows(j)));
+      }
+    }
+    sort(crossings.begin(), crossings.end());
+
+    // Even-odd rule. The polygon interior lies between consecutive pairs of
+    // crossings.
+    for (unsigned int k = 0; k + 1 < crossings.size(); k += 2) {
+      FillRow(row, ceil(crossings[k]), ceil(crossings[k + 1]));
+    }
+  }
+}
+
+void Map::AddPolygonalObstacles(const vector<Points>& polygons) {
+  for (const auto& polygon : polygons) {
+    AddPolygonalObstacle(polygon);
+  }
 }
 
 }  // namespace environment
@@ -0,0 +1,220 @@
+#include "environment/include/occupancy_grid.h"
+
+namespace morphac {
+namespace environment {
+
+using morphac::common::aliases::MapData;
+using morphac::constants::MapConstants;
+using morphac::environment::Map;
+using morphac::environment::MapRegion;
+
+constexpr int OccupancyGrid::kWordSize;
+
+OccupancyGrid::OccupancyGrid(const double width, const double height,
+                             const double resolution)
+    : width_(width), height_(height), resolution_(resolution) {
+  MORPH_REQUIRE(width_ > 0, std::invalid_argument, "Non-positive map width.");
+  MORPH_REQUIRE(height_ > 0, std::invalid_argument, "Non-positive map height.");
+  MORPH_REQUIRE(resolution_ > 0, std::invalid_argument,
+                "Non-positive map resolution.");
+
+  // The dimensions are validated the same way as those of Map, so that both
+  // have the same pixels.
+  rows_ = height_ / resolution_;
+  cols_ = width_ / resolution_;
+
+  MORPH_REQUIRE(std::fabs(width_ - cols_ * resolution_) <
+                    std::numeric_limits<double>::epsilon(),
+                std::invalid_argument, "Invalid resolution.");
+  MORPH_REQUIRE(std::fabs(height_ - rows_ * resolution_) <
+                    std::numeric_limits<double>::epsilon(),
+                std::invalid_argument, "Invalid resolution.");
+
+  words_per_row_ = (cols_ + kWordSize - 1) / kWordSize;
+  words_.assign(static_cast<size_t>(rows_) * words_per_row_, 0);
+}
+
+OccupancyGrid::OccupancyGrid(const MapData& data, const double resolution)
+    : width_(data.cols() * resolution),
+      height_(data.rows() * resolution),
+      resolution_(resolution),
+      rows_(data.rows()),
+      cols_(data.cols()),
+      words_per_row_((cols_ + kWordSize - 1) / kWordSize) {
+  MORPH_REQUIRE(data.cols() > 0, std::invalid_argument,
+                "Non-positive data width.");
+  MORPH_REQUIRE(data.rows() > 0, std::invalid_argument,
+                "Non-positive data height.");
+  MORPH_REQUIRE(resolution_ > 0, std::invalid_argument,
+                "Non-positive map resolution.");
+
+  // The pixels are packed a word at a time, without branching on them.
+  words_.resize(static_cast<size_t>(rows_) * words_per_row_);
+  for (int row = 0; row < rows_; ++row) {
+    const int* pixels = data.row(row).data();
+    uint64_t* words = GetRow(row);
+    for (int word = 0; word < words_per_row_; ++word) {
+      const int start_col = word * kWordSize;
+      const int num_cols = std::min(kWordSize, cols_ - start_col);
+      uint64_t packed_word = 0;
+      for (int bit = 0; bit < num_cols; ++bit) {
+        packed_word |=
+            static_cast<uint64_t>(pixels[start_col + bit] ==
+                                  MapConstants::OBSTACLE)
+            << bit;
+      }
+      words[word] = packed_word;
+    }
+  }
+}
+
+OccupancyGrid::OccupancyGrid(const Map& map)
+    : OccupancyGrid(map.get_data(), map.get_resolution()) {}
+
+double OccupancyGrid::get_width() const { return width_; }
+
+double OccupancyGrid::get_height() const { return height_; }
+
+double OccupancyGrid::get_resolution() const { return resolution_; }
+
+int OccupancyGrid::get_rows() const { return rows_; }
+
+int OccupancyGrid::get_cols() const { return cols_; }
+
+MapData OccupancyGrid::ToMapData() const {
+  // The pixels are unpacked a word at a time, without branching on them.
+  const int obstacle_offset = MapConstants::OBSTACLE - MapConstants::EMPTY;
+  MapData data(rows_, cols_);
+  for (int row = 0; row < rows_; ++row) {
+    int* pixels = data.row(row).data();
+    const uint64_t* words = GetRow(row);
+    for (int word = 0; word < words_per_row_; ++word) {
+      const int start_col = word * kWordSize;
+      const int num_cols = std::min(kWordSize, cols_ - start_col);
+      const uint64_t packed_word = words[word];
+      for (int bit = 0; bit < num_cols; ++bit) {
+        pixels[start_col + bit] =
+            MapConstants::EMPTY +
+            obstacle_offset * static_cast<int>((packed_word >> bit) & 1);
+      }
+    }
+  }
+  return data;
+}
+
+Map OccupancyGrid::ToMap() const { return Map(ToMapData(), resolution_); }
+
+bool OccupancyGrid::IsOccupied(const int row, const int col) const {
+  MORPH_HOT_REQUIRE(row >= 0 && row < rows_ && col >= 0 && col < cols_,
+                    std::out_of_range, "Pixel index out of bounds.");
+  return (GetRow(row)[col / kWordSize] >> (col % kWordSize)) & 1;
+}
+
+void OccupancyGrid::SetOccupied(const int row, const int col,
+                                const bool occupied) {
+  MORPH_HOT_REQUIRE(row >= 0 && row < rows_ && col >= 0 && col < cols_,
+                    std::out_of_range, "Pixel index out of bounds.");
+  const uint64_t bit = uint64_t{1} << (col % kWordSize);
+  uint64_t& word = GetRow(row)[col / kWordSize];
+  word = occupied ? word | bit : word & ~bit;
+}
+
+int64_t OccupancyGrid::CountOccupied(const MapRegion& region) const {
+  CheckRegion(region);
+  if (region.IsEmpty()) {
+    return 0;
+  }
+
+  const int start_word = region.start_col / kWordSize;
+  const int end_word = (region.end_col - 1) / kWordSize;
+  int64_t count = 0;
+  for (int row = region.start_row; row < region.end_row; ++row) {
+    const uint64_t* words = GetRow(row);
+    for (int word = start_word; word <= end_word; ++word) {
+      count += CountBits(words[word] &
+                         ComputeMask(word, region.start_col, region.end_col));
+    }
+  }
+  return count;
+}
+
+bool OccupancyGrid::IsRegionFree(const MapRegion& region) const {
+  CheckRegion(region);
+  if (region.IsEmpty()) {
+    return true;
+  }
+
+  const int start_word = region.start_col / kWordSize;
+  const int end_word = (region.end_col - 1) / kWordSize;
+  for (int row = region.start_row; row < region.end_row; ++row) {
+    const uint64_t* words = GetRow(row);
+    for (int word = start_word; word <= end_word; ++word) {
+      if (words[word] & ComputeMask(word, region.start_col, region.end_col)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+void OccupancyGrid::FillRegion(const MapRegion& region, const bool occupied) {
+  CheckRegion(region);
+  if (region.IsEmpty()) {
+    return;
+  }
+
+  const int start_word = region.start_col / kWordSize;
+  const int end_word = (region.end_col - 1) / kWordSize;
+  for (int row = region.start_row; row < region.end_row; ++row) {
+    uint64_t* words = GetRow(row);
+    for (int word = start_word; word <= end_word; ++word) {
+      const uint64_t mask =
+          ComputeMask(word, region.start_col, region.end_col);
+      words[word] = occupied ? words[word] | mask : words[word] & ~mask;
+    }
+  }
+}
+
+int OccupancyGrid::CountBits(const uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+  // Compiles to a single instruction where the target has one.
+  return __builtin_popcountll(word);
+#else
+  // Parallel (SWAR) bit count.
+  uint64_t count = word - ((word >> 1) & 0x5555555555555555ULL);
+  count = (count & 0x3333333333333333ULL) +
+          ((count >> 2) & 0x3333333333333333ULL);
+  count = (count + (count >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  return (count * 0x0101010101010101ULL) >> 56;
+#endif
+}
+
+uint64_t OccupancyGrid::ComputeMask(const int word, const int start_col,
+                                    const int end_col) {
+  const int word_start_col = word * kWordSize;
+  uint64_t mask = ~uint64_t{0};
+  if (start_col > word_start_col) {
+    mask &= ~uint64_t{0} << (start_col - word_start_col);
+  }
+  if (end_col < word_start_col + kWordSize) {
+    mask &= ~uint64_t{0} >> (word_start_col + kWordSize - end_col);
+  }
+  return mask;
+}
+
+uint64_t* OccupancyGrid::GetRow(const int row) {
+  return words_.data() + static_cast<size_t>(row) * words_per_row_;
+}
+
+const uint64_t* OccupancyGrid::GetRow(const int row) const {
+  return words_.data() + static_cast<size_t>(row) * words_per_row_;
+}
+
+void OccupancyGrid::CheckRegion(const MapRegion& region) const {
+  MORPH_REQUIRE(region.start_row >= 0 && region.start_col >= 0 &&
+                    region.end_row <= rows_ && region.end_col <= cols_,
+                std::out_of_range, "Region out of bounds.");
+}
+
+}  // namespace environment
+}  // namespace morphac
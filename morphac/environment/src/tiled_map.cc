@@ -0,0 +1,269 @@
+#include "environment/include/tiled_map.h"
+
+#include <cerrno>
+
+// Memory mapping, for the file backed maps.
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace morphac {
+namespace environment {
+
+using std::copy;
+using std::fill;
+using std::max;
+using std::min;
+using std::string;
+using std::unique_ptr;
+
+using morphac::common::aliases::MapData;
+using morphac::constants::MapConstants;
+using morphac::environment::Map;
+using morphac::environment::MapRegion;
+
+TiledMap::TiledMap(const double width, const double height,
+                   const double resolution, const int tile_size)
+    : width_(width),
+      height_(height),
+      resolution_(resolution),
+      tile_size_(tile_size),
+      tile_area_(static_cast<int64_t>(tile_size) * tile_size),
+      num_allocated_tiles_(0),
+      file_data_(nullptr),
+      file_size_(0),
+      file_descriptor_(-1) {
+  MORPH_REQUIRE(width_ > 0, std::invalid_argument, "Non-positive map width.");
+  MORPH_REQUIRE(height_ > 0, std::invalid_argument, "Non-positive map height.");
+  MORPH_REQUIRE(resolution_ > 0, std::invalid_argument,
+                "Non-positive map resolution.");
+  MORPH_REQUIRE(tile_size_ > 0, std::invalid_argument,
+                "Non-positive tile size.");
+
+  // The dimensions are validated the same way as those of Map, so that both
+  // have the same pixels.
+  rows_ = height_ / resolution_;
+  cols_ = width_ / resolution_;
+
+  MORPH_REQUIRE(std::fabs(width_ - cols_ * resolution_) <
+                    std::numeric_limits<double>::epsilon(),
+                std::invalid_argument, "Invalid resolution.");
+  MORPH_REQUIRE(std::fabs(height_ - rows_ * resolution_) <
+                    std::numeric_limits<double>::epsilon(),
+                std::invalid_argument, "Invalid resolution.");
+
+  // The tiles along the bottom and right edges may extend past the map.
+  tiles_per_row_ = (cols_ + tile_size_ - 1) / tile_size_;
+  const int tiles_per_col = (rows_ + tile_size_ - 1) / tile_size_;
+  tiles_.assign(static_cast<size_t>(tiles_per_col) * tiles_per_row_, nullptr);
+}
+
+TiledMap::TiledMap(const double width, const double height,
+                   const double resolution, const string& file_path,
+                   const int tile_size, const bool overwrite)
+    : TiledMap(width, height, resolution, tile_size) {
+  MapFile(file_path, overwrite);
+}
+
+TiledMap::~TiledMap() {
+#if defined(__unix__) || defined(__APPLE__)
+  if (file_data_ != nullptr) {
+    munmap(file_data_, file_size_);
+  }
+  if (file_descriptor_ >= 0) {
+    close(file_descriptor_);
+  }
+#endif
+}
+
+double TiledMap::get_width() const { return width_; }
+
+double TiledMap::get_height() const { return height_; }
+
+double TiledMap::get_resolution() const { return resolution_; }
+
+int TiledMap::get_rows() const { return rows_; }
+
+int TiledMap::get_cols() const { return cols_; }
+
+int TiledMap::get_tile_size() const { return tile_size_; }
+
+int TiledMap::get_num_tiles() const { return tiles_.size(); }
+
+int TiledMap::get_num_allocated_tiles() const { return num_allocated_tiles_; }
+
+int TiledMap::GetPixel(const int row, const int col) const {
+  MORPH_HOT_REQUIRE(row >= 0 && row < rows_ && col >= 0 && col < cols_,
+                    std::out_of_range, "Pixel index out of bounds.");
+  const int* tile_data = tiles_[ComputeTile(row, col)];
+  if (tile_data == nullptr) {
+    return MapConstants::EMPTY;
+  }
+  return tile_data[(row % tile_size_) * tile_size_ + col % tile_size_];
+}
+
+void TiledMap::SetPixel(const int row, const int col, const int value) {
+  MORPH_HOT_REQUIRE(row >= 0 && row < rows_ && col >= 0 && col < cols_,
+                    std::out_of_range, "Pixel index out of bounds.");
+  const int tile = ComputeTile(row, col);
+  if (tiles_[tile] == nullptr && value == MapConstants::EMPTY) {
+    return;
+  }
+  AllocateTile(tile)[(row % tile_size_) * tile_size_ + col % tile_size_] =
+      value;
+}
+
+MapData TiledMap::GetRegion(const MapRegion& region) const {
+  CheckRegion(region);
+  MapData data = MapData::Constant(max(region.end_row - region.start_row, 0),
+                                   max(region.end_col - region.start_col, 0),
+                                   MapConstants::EMPTY);
+
+  ForEachTile(region, [&](const int tile, const MapRegion& tile_region) {
+    const int* tile_data = tiles_[tile];
+    if (tile_data == nullptr) {
+      return;
+    }
+    for (int row = tile_region.start_row; row < tile_region.end_row; ++row) {
+      const int* tile_row = tile_data + (row % tile_size_) * tile_size_ +
+                            tile_region.start_col % tile_size_;
+      copy(tile_row, tile_row + (tile_region.end_col - tile_region.start_col),
+           &data(row - region.start_row,
+                 tile_region.start_col - region.start_col));
+    }
+  });
+
+  return data;
+}
+
+void TiledMap::SetRegion(const int start_row, const int start_col,
+                         const MapData& data) {
+  const MapRegion region{start_row, start_col,
+                         start_row + static_cast<int>(data.rows()),
+                         start_col + static_cast<int>(data.cols())};
+  CheckRegion(region);
+
+  ForEachTile(region, [&](const int tile, const MapRegion& tile_region) {
+    const int tile_rows = tile_region.end_row - tile_region.start_row;
+    const int tile_cols = tile_region.end_col - tile_region.start_col;
+    if (tiles_[tile] == nullptr &&
+        (data.block(tile_region.start_row - start_row,
+                    tile_region.start_col - start_col, tile_rows, tile_cols)
+             .array() == MapConstants::EMPTY)
+            .all()) {
+      return;
+    }
+    int* tile_data = AllocateTile(tile);
+    for (int row = tile_region.start_row; row < tile_region.end_row; ++row) {
+      const int* data_row =
+          &data(row - start_row, tile_region.start_col - start_col);
+      copy(data_row, data_row + tile_cols,
+           tile_data + (row % tile_size_) * tile_size_ +
+               tile_region.start_col % tile_size_);
+    }
+  });
+}
+
+void TiledMap::FillRegion(const MapRegion& region, const int value) {
+  CheckRegion(region);
+
+  ForEachTile(region, [&](const int tile, const MapRegion& tile_region) {
+    if (tiles_[tile] == nullptr && value == MapConstants::EMPTY) {
+      return;
+    }
+    int* tile_data = AllocateTile(tile);
+    for (int row = tile_region.start_row; row < tile_region.end_row; ++row) {
+      int* tile_row = tile_data + (row % tile_size_) * tile_size_ +
+                      tile_region.start_col % tile_size_;
+      fill(tile_row, tile_row + (tile_region.end_col - tile_region.start_col),
+           value);
+    }
+  });
+}
+
+Map TiledMap::ToMap(const MapRegion& region) const {
+  return Map(GetRegion(region), resolution_);
+}
+
+int TiledMap::ComputeTile(const int row, const int col) const {
+  return (row / tile_size_) * tiles_per_row_ + col / tile_size_;
+}
+
+int* TiledMap::AllocateTile(const int tile) {
+  if (tiles_[tile] != nullptr) {
+    return tiles_[tile];
+  }
+
+  if (file_data_ != nullptr) {
+    tiles_[tile] = file_data_ + tile * tile_area_;
+  } else {
+    memory_tiles_.push_back(unique_ptr<int[]>(new int[tile_area_]));
+    tiles_[tile] = memory_tiles_.back().get();
+  }
+  fill(tiles_[tile], tiles_[tile] + tile_area_, MapConstants::EMPTY);
+  ++num_allocated_tiles_;
+  return tiles_[tile];
+}
+
+void TiledMap::CheckRegion(const MapRegion& region) const {
+  MORPH_REQUIRE(region.start_row >= 0 && region.start_col >= 0 &&
+                    region.end_row <= rows_ && region.end_col <= cols_,
+                std::out_of_range, "Region out of bounds.");
+}
+
+template <typename Function>
+void TiledMap::ForEachTile(const MapRegion& region,
+                           const Function& function) const {
+  if (region.IsEmpty()) {
+    return;
+  }
+  for (int tile_row = region.start_row / tile_size_;
+       tile_row <= (region.end_row - 1) / tile_size_; ++tile_row) {
+    for (int tile_col = region.start_col / tile_size_;
+         tile_col <= (region.end_col - 1) / tile_size_; ++tile_col) {
+      const MapRegion tile_region{
+          max(region.start_row, tile_row * tile_size_),
+          max(region.start_col, tile_col * tile_size_),
+          min(region.end_row, (tile_row + 1) * tile_size_),
+          min(region.end_col, (tile_col + 1) * tile_size_)};
+      function(tile_row * tiles_per_row_ + tile_col, tile_region);
+    }
+  }
+}
+
+void TiledMap::MapFile(const string& file_path, const bool overwrite) {
+#if defined(__unix__) || defined(__APPLE__)
+  // Growing the file with ftruncate leaves it sparse, so that the tiles only
+  // take up disk space once they are allocated.
+  file_size_ = tiles_.size() * tile_area_ * sizeof(int);
+  // O_EXCL makes creating the file fail if it already exists, so that an
+  // existing file is never truncated by accident.
+  file_descriptor_ = open(file_path.c_str(),
+                          O_RDWR | O_CREAT | (overwrite ? O_TRUNC : O_EXCL),
+                          0644);
+  MORPH_REQUIRE(file_descriptor_ >= 0 || errno != EEXIST, std::runtime_error,
+                "The map file already exists.");
+  MORPH_REQUIRE(file_descriptor_ >= 0, std::runtime_error,
+                "Could not open the map file.");
+  // The file is removed right away and only lives on through the descriptor
+  // (And the mapping). This way it can't be left behind, whether the map is
+  // destroyed, one of the steps below fails, or the process is killed.
+  MORPH_REQUIRE(unlink(file_path.c_str()) == 0, std::runtime_error,
+                "Could not remove the map file.");
+  MORPH_REQUIRE(ftruncate(file_descriptor_, file_size_) == 0,
+                std::runtime_error, "Could not resize the map file.");
+  void* file_data = mmap(nullptr, file_size_, PROT_READ | PROT_WRITE,
+                         MAP_SHARED, file_descriptor_, 0);
+  MORPH_REQUIRE(file_data != MAP_FAILED, std::runtime_error,
+                "Could not map the map file.");
+  file_data_ = static_cast<int*>(file_data);
+#else
+  MORPH_REQUIRE(false, std::logic_error,
+                "File backed maps require memory mapping (POSIX).");
+#endif
+}
+
+}  // namespace environment
+}  // namespace morphac
@@ -0,0 +1,292 @@
+#include "environment/include/distance_field.h"
+
+#include "Eigen/Dense"
+#include "gtest/gtest.h"
+
+namespace {
+
+using std::make_unique;
+using std::min;
+using std::numeric_limits;
+using std::sqrt;
+using std::unique_ptr;
+using std::vector;
+
+using Eigen::VectorXd;
+
+using morphac::common::aliases::DistanceFieldData;
+using morphac::common::aliases::MapData;
+using morphac::common::aliases::Point;
+using morphac::common::aliases::Points;
+using morphac::constants::MapConstants;
+using morphac::environment::DistanceField;
+using morphac::environment::Map;
+using morphac::math::geometry::CircleShape;
+
+// Signed distance field computed by brute force, by comparing every pair of
+// pixels.
+DistanceFieldData ComputeBruteForceDistanceField(const Map& map) {
+  const MapData& data = map.get_data();
+  DistanceFieldData distance_field(data.rows(), data.cols());
+  for (int row = 0; row < data.rows(); ++row) {
+    for (int col = 0; col < data.cols(); ++col) {
+      const bool is_obstacle = data(row, col) == MapConstants::OBSTACLE;
+      // Distance to the nearest pixel of the other kind.
+      double distance = numeric_limits<double>::infinity();
+      for (int other_row = 0; other_row < data.rows(); ++other_row) {
+        for (int other_col = 0; other_col < data.cols(); ++other_col) {
+          if ((data(other_row, other_col) == MapConstants::OBSTACLE) !=
+              is_obstacle) {
+            const int row_offset = row - other_row;
+            const int col_offset = col - other_col;
+            distance = min(distance, sqrt(row_offset * row_offset +
+                                          col_offset * col_offset));
+          }
+        }
+      }
+      distance_field(row, col) =
+          (is_obstacle ? -distance : distance) * map.get_resolution();
+    }
+  }
+  return distance_field;
+}
+
+class DistanceFieldTest : public ::testing::Test {
+ protected:
+  DistanceFieldTest() {
+    // Set random seed for Eigen.
+    srand(7);
+
+    // Sparse random obstacles.
+    MapData data = MapData::Random(30, 40).unaryExpr(
+        [](const int value) { return value % 10 == 0 ? 1 : 0; });
+    map_ = make_unique<Map>(data, 0.1);
+  }
+
+  void SetUp() override {}
+
+  unique_ptr<Map> map_;
+};
+
+TEST_F(DistanceFieldTest, Construction) {
+  DistanceField distance_field(*map_);
+
+  ASSERT_EQ(distance_field.get_resolution(), 0.1);
+  ASSERT_EQ(distance_field.get_data().rows(), 30);
+  ASSERT_EQ(distance_field.get_data().cols(), 40);
+}
+
+TEST_F(DistanceFieldTest, InvalidConstruction) {
+  ASSERT_THROW(DistanceField(*map_, 0), std::invalid_argument);
+}
+
+TEST_F(DistanceFieldTest, Data) {
+  // The transform is exact.
+  DistanceField distance_field(*map_);
+  ASSERT_TRUE(distance_field.get_data().isApprox(
+      ComputeBruteForceDistanceField(*map_), 1e-12));
+
+  // Single obstacle pixel.
+  Map map(5., 3., 1.);
+  map.get_data_ref()(1, 2) = MapConstants::OBSTACLE;
+  DistanceFieldData expected_data(3, 5);
+  expected_data << sqrt(5.), sqrt(2.), 1., sqrt(2.), sqrt(5.), 2., 1., -1., 1.,
+      2., sqrt(5.), sqrt(2.), 1., sqrt(2.), sqrt(5.);
+  ASSERT_TRUE(DistanceField(map).get_data().isApprox(expected_data));
+}
+
+TEST_F(DistanceFieldTest, MultiThreadedData) {
+  // The result doesn't depend on the number of threads.
+  MapData data = MapData::Random(300, 200).unaryExpr(
+      [](const int value) { return value % 50 == 0 ? 1 : 0; });
+  Map map(data, 0.05);
+
+  const DistanceFieldData expected_data = DistanceField(map, 1).get_data();
+  for (int num_threads : {2, 4, 7}) {
+    ASSERT_TRUE(DistanceField(map, num_threads).get_data() == expected_data);
+  }
+}
+
+TEST_F(DistanceFieldTest, ComputeDistance) {
+  DistanceField distance_field(*map_);
+  const DistanceFieldData& data = distance_field.get_data();
+
+  // At the pixels, the distance is the pixel value. The pixel (row, col) is at
+  // the world coordinate (0.1 * col, 0.1 * (30 - row)).
+  ASSERT_DOUBLE_EQ(distance_field.ComputeDistance(Point{0.5, 2.}), data(10, 5));
+  ASSERT_DOUBLE_EQ(distance_field.ComputeDistance(Point{3.9, 0.1}),
+                   data(29, 39));
+
+  // Bilinear interpolation between the pixels.
+  ASSERT_NEAR(distance_field.ComputeDistance(Point{0.55, 2.}),
+              (data(10, 5) + data(10, 6)) / 2, 1e-12);
+  ASSERT_NEAR(distance_field.ComputeDistance(Point{0.55, 1.95}),
+              (data(10, 5) + data(10, 6) + data(11, 5) + data(11, 6)) / 4,
+              1e-12);
+
+  // Points outside the map are clamped to the map boundary.
+  ASSERT_DOUBLE_EQ(distance_field.ComputeDistance(Point{-1., 2.}),
+                   data(10, 0));
+  ASSERT_DOUBLE_EQ(distance_field.ComputeDistance(Point{10., 10.}),
+                   data(0, 39));
+
+  // Batched queries.
+  Points points(3, 2);
+  points << 0.5, 2., 0.55, 1.95, 10., 10.;
+  const VectorXd distances = distance_field.ComputeDistances(points);
+  ASSERT_EQ(distances.size(), 3);
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_DOUBLE_EQ(distances(i),
+                     distance_field.ComputeDistance(points.row(i).transpose()));
+  }
+}
+
+TEST_F(DistanceFieldTest, ComputeGradient) {
+  // Obstacles along the first column. The distance grows linearly along x
+  // (Away from the obstacles).
+  Map map(2., 1., 0.1);
+  map.get_data_ref().col(0).setConstant(MapConstants::OBSTACLE);
+  DistanceField distance_field(map);
+
+  ASSERT_NEAR(distance_field.ComputeDistance(Point{0.55, 0.52}), 0.55, 1e-12);
+  ASSERT_TRUE(distance_field.ComputeGradient(Point{0.55, 0.52})
+                  .isApprox(Point{1., 0.}));
+  ASSERT_TRUE(distance_field.ComputeGradient(Point{1.234, 0.1})
+                  .isApprox(Point{1., 0.}));
+
+  // Obstacles along the first row (The top of the map). The distance grows
+  // along -y.
+  Map top_map(1., 2., 0.1);
+  top_map.get_data_ref().row(0).setConstant(MapConstants::OBSTACLE);
+  DistanceField top_distance_field(top_map);
+
+  ASSERT_TRUE(top_distance_field.ComputeGradient(Point{0.52, 1.23})
+                  .isApprox(Point{0., -1.}));
+
+  // The gradient matches the finite differences of the distance.
+  DistanceField random_distance_field(*map_);
+  const Point point{1.234, 2.345};
+  const double delta = 1e-6;
+  const Point finite_difference_gradient{
+      (random_distance_field.ComputeDistance(point + Point{delta, 0.}) -
+       random_distance_field.ComputeDistance(point - Point{delta, 0.})) /
+          (2 * delta),
+      (random_distance_field.ComputeDistance(point + Point{0., delta}) -
+       random_distance_field.ComputeDistance(point - Point{0., delta})) /
+          (2 * delta)};
+  ASSERT_TRUE(random_distance_field.ComputeGradient(point).isApprox(
+      finite_difference_gradient, 1e-6));
+
+  // Batched queries.
+  Points points(2, 2);
+  points << 1.234, 2.345, 0.5, 0.5;
+  const Points gradients = random_distance_field.ComputeGradients(points);
+  ASSERT_EQ(gradients.rows(), 2);
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_TRUE(gradients.row(i).transpose().isApprox(
+        random_distance_field.ComputeGradient(points.row(i).transpose())));
+  }
+}
+
+TEST_F(DistanceFieldTest, NoObstacles) {
+  // The distance is infinite everywhere, with a zero gradient.
+  DistanceField distance_field(Map(2., 1., 0.1));
+
+  ASSERT_EQ(distance_field.ComputeDistance(Point{0.5, 0.5}),
+            numeric_limits<double>::infinity());
+  ASSERT_TRUE(distance_field.ComputeGradient(Point{0.5, 0.5}).isZero());
+
+  // No free space.
+  DistanceField full_distance_field(
+      Map(MapData::Constant(10, 20, MapConstants::OBSTACLE), 0.1));
+
+  ASSERT_EQ(full_distance_field.ComputeDistance(Point{0.5, 0.5}),
+            -numeric_limits<double>::infinity());
+  ASSERT_TRUE(full_distance_field.ComputeGradient(Point{0.5, 0.5}).isZero());
+}
+
+TEST_F(DistanceFieldTest, Update) {
+  // Moving a single obstacle pixel. The update matches the full transform.
+  Map map(5., 3., 1.);
+  map.get_data_ref()(1, 2) = MapConstants::OBSTACLE;
+  map.ClearDirtyRegion();
+  DistanceField distance_field(map);
+
+  MapData data = MapData::Zero(3, 5);
+  data(2, 4) = MapConstants::OBSTACLE;
+  map = map.Evolve(data);
+  distance_field.Update(map);
+  ASSERT_TRUE(
+      distance_field.get_data().isApprox(DistanceField(map).get_data()));
+
+  // Updating again with the same map changes nothing.
+  distance_field.Update(map);
+  ASSERT_TRUE(
+      distance_field.get_data().isApprox(DistanceField(map).get_data()));
+
+  // Removing all the obstacles, and then adding them back.
+  map = map.Evolve(MapData::Zero(3, 5));
+  distance_field.Update(map);
+  ASSERT_TRUE((distance_field.get_data().array() ==
+               numeric_limits<double>::infinity())
+                  .all());
+  map = map.Evolve(MapData::Constant(3, 5, MapConstants::OBSTACLE));
+  distance_field.Update(map);
+  ASSERT_TRUE((distance_field.get_data().array() ==
+               -numeric_limits<double>::infinity())
+                  .all());
+  map = map.Evolve(data);
+  distance_field.Update(map);
+  ASSERT_TRUE(
+      distance_field.get_data().isApprox(DistanceField(map).get_data()));
+}
+
+TEST_F(DistanceFieldTest, UpdateMovingObstacles) {
+  // Circular obstacles that move around the map, along with some static
+  // noise. The incremental update may only exceed the exact distances by a
+  // small fraction of a pixel, and only at a few pixels.
+  vector<Point> centers;
+  for (int i = 0; i < 6; ++i) {
+    centers.push_back(Point::Random().cwiseAbs().cwiseProduct(Point{4., 3.}));
+  }
+  auto create_map = [&]() {
+    Map map(*map_);
+    for (const auto& center : centers) {
+      map.AddCircularObstacle(CircleShape{0.3, center});
+    }
+    return map;
+  };
+
+  Map map = create_map();
+  DistanceField distance_field(map);
+  for (int step = 0; step < 20; ++step) {
+    for (auto& center : centers) {
+      center += 0.15 * Point::Random();
+    }
+    map = map.Evolve(create_map().get_data());
+    distance_field.Update(map);
+    map.ClearDirtyRegion();
+
+    const DistanceFieldData errors =
+        distance_field.get_data() - DistanceField(map).get_data();
+    ASSERT_GE(errors.minCoeff(), -1e-12);
+    ASSERT_LT(errors.maxCoeff(), 0.1 * map.get_resolution());
+    ASSERT_LT((errors.array() > 1e-12).count(), 0.01 * errors.size());
+  }
+}
+
+TEST_F(DistanceFieldTest, InvalidUpdate) {
+  DistanceField distance_field(*map_);
+
+  ASSERT_THROW(distance_field.Update(Map(MapData::Zero(30, 41), 0.1)),
+               std::invalid_argument);
+  ASSERT_THROW(distance_field.Update(Map(MapData::Zero(30, 40), 0.2)),
+               std::invalid_argument);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -5,11 +5,24 @@
 
 namespace {
 
+using std::abs;
+using std::cos;
 using std::make_unique;
+using std::max;
+using std::sin;
 using std::unique_ptr;
+using std::vector;
 
 using morphac::common::aliases::MapData;
+using morphac::common::aliases::Point;
+using morphac::common::aliases::Points;
+using morphac::constants::MapConstants;
 using morphac::environment::Map;
+using morphac::environment::MapRegion;
+using morphac::math::geometry::CircleShape;
+using morphac::math::geometry::RectangleShape;
+using morphac::math::geometry::RoundedRectangleShape;
+using morphac::math::geometry::TriangleShape;
 
 class MapTest : public ::testing::Test {
  protected:
@@ -115,6 +128,270 @@ TEST_F(MapTest, InvalidEvolve) {
   ASSERT_THROW(map2_->Evolve(MapData::Ones(500, 499)), std::invalid_argument);
 }
 
+// The obstacle tests use maps with a resolution of 1, where the pixel (row,
+// col) is at the world coordinate (col, height - row).
+
+TEST_F(MapTest, AddCircularObstacle) {
+  Map map(10, 10, 1.);
+  map.AddCircularObstacle(CircleShape{2., Point{5., 5.}});
+
+  // All the pixels within the (closed) circle are filled.
+  MapData expected_data = MapData::Zero(10, 10);
+  for (int row = 0; row < 10; ++row) {
+    for (int col = 0; col < 10; ++col) {
+      if ((row - 5) * (row - 5) + (col - 5) * (col - 5) <= 4) {
+        expected_data(row, col) = MapConstants::OBSTACLE;
+      }
+    }
+  }
+  ASSERT_TRUE(map.get_data() == expected_data);
+  ASSERT_EQ(map.get_data().sum(), 13 * MapConstants::OBSTACLE);
+
+  // Circle that is partially outside the map.
+  map = Map(10, 10, 1.);
+  map.AddCircularObstacle(CircleShape{1.5, Point{0., 10.}});
+  expected_data = MapData::Zero(10, 10);
+  expected_data.topLeftCorner(2, 2).setConstant(MapConstants::OBSTACLE);
+  ASSERT_TRUE(map.get_data() == expected_data);
+
+  // Circles that are outside the map and that contain it.
+  map = Map(10, 10, 1.);
+  map.AddCircularObstacle(CircleShape{1., Point{100., -100.}});
+  ASSERT_TRUE(map.get_data() == MapData::Zero(10, 10));
+  map.AddCircularObstacle(CircleShape{1e12, Point{5., 5.}});
+  ASSERT_TRUE(map.get_data() ==
+              MapData::Constant(10, 10, MapConstants::OBSTACLE));
+}
+
+TEST_F(MapTest, AddRectangularObstacle) {
+  Map map(10, 10, 1.);
+  // Spans [3, 7] along x and [4, 6] along y. The boundaries are half open
+  // (The top left fill rule), hence the right and bottom ones aren't filled.
+  map.AddRectangularObstacle(RectangleShape{4., 2., 0., Point{5., 5.}});
+
+  MapData expected_data = MapData::Zero(10, 10);
+  expected_data.block(4, 3, 2, 4).setConstant(MapConstants::OBSTACLE);
+  ASSERT_TRUE(map.get_data() == expected_data);
+
+  // Adjacent rectangles don't overlap, and together they fill the same pixels
+  // as a single rectangle.
+  Map split_map(10, 10, 1.);
+  split_map.AddRectangularObstacle(RectangleShape{2., 2., 0., Point{4., 5.}});
+  split_map.AddRectangularObstacle(RectangleShape{2., 2., 0., Point{6., 5.}});
+  ASSERT_TRUE(split_map.get_data() == map.get_data());
+
+  // Rotating by pi / 2 is the same as swapping the sizes.
+  Map rotated_map(10, 10, 1.), swapped_map(10, 10, 1.);
+  rotated_map.AddRectangularObstacle(
+      RectangleShape{4., 2., M_PI / 2, Point{5.5, 5.5}});
+  swapped_map.AddRectangularObstacle(
+      RectangleShape{2., 4., 0., Point{5.5, 5.5}});
+  ASSERT_TRUE(rotated_map.get_data() == swapped_map.get_data());
+  ASSERT_EQ(rotated_map.get_data().sum(), 8 * MapConstants::OBSTACLE);
+}
+
+TEST_F(MapTest, AddRoundedRectangularObstacle) {
+  Map map(20, 20, 0.1);
+  const RoundedRectangleShape shape{8., 5., 0.3, 1.5, Point{10., 10.}};
+  map.AddRoundedRectangularObstacle(shape);
+
+  // Every filled pixel lies within the rounded rectangle, and every pixel
+  // that lies (strictly) within the rounded rectangle is filled. A point is
+  // within it if its distance to the inner rectangle (The rectangle formed by
+  // the centers of the corner circles) is at most the radius.
+  const double half_inner_size_x = shape.size_x / 2 - shape.radius;
+  const double half_inner_size_y = shape.size_y / 2 - shape.radius;
+  for (int row = 0; row < 200; ++row) {
+    for (int col = 0; col < 200; ++col) {
+      // The pixel coordinates in the frame of the rounded rectangle.
+      const double x = 0.1 * col - shape.center(0);
+      const double y = 0.1 * (200 - row) - shape.center(1);
+      const double local_x = cos(shape.angle) * x + sin(shape.angle) * y;
+      const double local_y = -sin(shape.angle) * x + cos(shape.angle) * y;
+      const double distance =
+          Point{max(abs(local_x) - half_inner_size_x, 0.),
+                max(abs(local_y) - half_inner_size_y, 0.)}
+              .norm();
+
+      if (map.get_data()(row, col) == MapConstants::OBSTACLE) {
+        ASSERT_LE(distance, shape.radius + 1e-9);
+      }
+      if (distance < shape.radius - 1e-9) {
+        ASSERT_EQ(map.get_data()(row, col), MapConstants::OBSTACLE);
+      }
+    }
+  }
+}
+
+TEST_F(MapTest, AddTriangularObstacle) {
+  Map map(10, 10, 1.);
+  // Vertices at (5, 7.5), (7, 3.5) and (3, 3.5).
+  map.AddTriangularObstacle(TriangleShape{4., 4., 0., Point{5., 5.5}});
+
+  MapData expected_data = MapData::Zero(10, 10);
+  expected_data.block(3, 5, 2, 1).setConstant(MapConstants::OBSTACLE);
+  expected_data.block(5, 4, 2, 3).setConstant(MapConstants::OBSTACLE);
+  ASSERT_TRUE(map.get_data() == expected_data);
+}
+
+TEST_F(MapTest, AddPolygonalObstacle) {
+  Map map(10, 10, 1.);
+  // Non-convex (L shaped) polygon.
+  Points polygon(6, 2);
+  polygon << 1., 9., 5., 9., 5., 7., 3., 7., 3., 5., 1., 5.;
+  map.AddPolygonalObstacle(polygon);
+
+  MapData expected_data = MapData::Zero(10, 10);
+  expected_data.block(1, 1, 2, 4).setConstant(MapConstants::OBSTACLE);
+  expected_data.block(3, 1, 2, 2).setConstant(MapConstants::OBSTACLE);
+  ASSERT_TRUE(map.get_data() == expected_data);
+
+  // Self intersecting polygon, where the overlapping region is outside the
+  // polygon (The even-odd rule). This is the rectangle traversed twice with
+  // a hole cut out.
+  map = Map(10, 10, 1.);
+  polygon = Points(10, 2);
+  polygon << 0., 10., 10., 10., 10., 0., 0., 0., 0., 10., 2., 8., 2., 2., 8.,
+      2., 8., 8., 2., 8.;
+  map.AddPolygonalObstacle(polygon);
+
+  expected_data = MapData::Constant(10, 10, MapConstants::OBSTACLE);
+  expected_data.block(2, 2, 6, 6).setConstant(MapConstants::EMPTY);
+  ASSERT_TRUE(map.get_data() == expected_data);
+
+  // Polygon that contains the map.
+  map = Map(10, 10, 1.);
+  polygon = Points(3, 2);
+  polygon << -1e12, -1e12, 1e12, -1e12, 0., 1e12;
+  map.AddPolygonalObstacle(polygon);
+  ASSERT_TRUE(map.get_data() ==
+              MapData::Constant(10, 10, MapConstants::OBSTACLE));
+}
+
+TEST_F(MapTest, AddObstaclesInPlace) {
+  // Adding obstacles only changes the pixels within them.
+  const MapData data = map2_->get_data();
+  map2_->AddRectangularObstacle(RectangleShape{1., 1., 0., Point{2., 2.}});
+
+  MapData expected_data = data;
+  expected_data.block(250, 150, 100, 100).setConstant(MapConstants::OBSTACLE);
+  ASSERT_TRUE(map2_->get_data() == expected_data);
+}
+
+TEST_F(MapTest, AddObstaclesBatched) {
+  // Adding the obstacles in a batch is the same as adding them one by one.
+  const vector<CircleShape> circle_shapes = {CircleShape{1., Point{2., 3.}},
+                                             CircleShape{0.5, Point{7., 7.}}};
+  const vector<RectangleShape> rectangle_shapes = {
+      RectangleShape{2., 1., 0.5, Point{1., 1.}},
+      RectangleShape{1., 3., -0.2, Point{8., 2.}}};
+  const vector<RoundedRectangleShape> rounded_rectangle_shapes = {
+      RoundedRectangleShape{3., 2., 1., 0.5, Point{5., 5.}}};
+  const vector<TriangleShape> triangle_shapes = {
+      TriangleShape{2., 2., 0.3, Point{3., 8.}},
+      TriangleShape{1., 2., 2., Point{9., 9.}}};
+  Points polygon(4, 2);
+  polygon << 4., 0., 6., 0., 6., 2., 5., 1.;
+  const vector<Points> polygons = {polygon, polygon.array() + 1.};
+
+  Map batched_map(10, 10, 0.1), map(10, 10, 0.1);
+  batched_map.AddCircularObstacles(circle_shapes);
+  batched_map.AddRectangularObstacles(rectangle_shapes);
+  batched_map.AddRoundedRectangularObstacles(rounded_rectangle_shapes);
+  batched_map.AddTriangularObstacles(triangle_shapes);
+  batched_map.AddPolygonalObstacles(polygons);
+
+  for (const auto& circle_shape : circle_shapes) {
+    map.AddCircularObstacle(circle_shape);
+  }
+  for (const auto& rectangle_shape : rectangle_shapes) {
+    map.AddRectangularObstacle(rectangle_shape);
+  }
+  for (const auto& rounded_rectangle_shape : rounded_rectangle_shapes) {
+    map.AddRoundedRectangularObstacle(rounded_rectangle_shape);
+  }
+  for (const auto& triangle_shape : triangle_shapes) {
+    map.AddTriangularObstacle(triangle_shape);
+  }
+  for (const auto& polygon : polygons) {
+    map.AddPolygonalObstacle(polygon);
+  }
+
+  ASSERT_TRUE(batched_map.get_data() == map.get_data());
+  ASSERT_GT(map.get_data().sum(), 0);
+}
+
+TEST_F(MapTest, InvalidAddPolygonalObstacle) {
+  // Polygons with less than three vertices.
+  ASSERT_THROW(map1_->AddPolygonalObstacle(Points::Zero(2, 2)),
+               std::invalid_argument);
+  ASSERT_THROW(map1_->AddPolygonalObstacles({Points::Ones(4, 2), Points()}),
+               std::invalid_argument);
+}
+
+TEST_F(MapTest, DirtyRegion) {
+  // Helper to compare regions.
+  auto is_region = [](const MapRegion& region, const int start_row,
+                      const int start_col, const int end_row,
+                      const int end_col) {
+    return region.start_row == start_row && region.start_col == start_col &&
+           region.end_row == end_row && region.end_col == end_col;
+  };
+
+  // New maps start clean.
+  Map map(10., 5., 0.1);
+  ASSERT_TRUE(map.get_dirty_region().IsEmpty());
+
+  // The obstacles mark their bounding region dirty. The square spans the rows
+  // [10, 20) and the columns [30, 40).
+  map.AddRectangularObstacle(RectangleShape{1., 1., 0., Point{3.5, 3.5}});
+  ASSERT_TRUE(is_region(map.get_dirty_region(), 10, 30, 20, 40));
+  // Obstacles outside the map don't change the region.
+  map.AddCircularObstacle(CircleShape{1., Point{-5., -5.}});
+  ASSERT_TRUE(is_region(map.get_dirty_region(), 10, 30, 20, 40));
+  // The region grows to include the new obstacles.
+  map.AddRectangularObstacle(RectangleShape{1., 1., 0., Point{1.5, 4.}});
+  ASSERT_TRUE(is_region(map.get_dirty_region(), 5, 10, 20, 40));
+
+  map.ClearDirtyRegion();
+  ASSERT_TRUE(map.get_dirty_region().IsEmpty());
+
+  // The evolved map is dirty where the data differs.
+  MapData data = map.get_data();
+  data(2, 7) = MapConstants::OBSTACLE;
+  data(45, 3) = MapConstants::OBSTACLE;
+  Map evolved_map = map.Evolve(data);
+  ASSERT_TRUE(is_region(evolved_map.get_dirty_region(), 2, 3, 46, 8));
+  // Evolving with the same data leaves the region empty.
+  ASSERT_TRUE(map.Evolve(map.get_data()).get_dirty_region().IsEmpty());
+  // The dirty region of the original map carries over.
+  map.AddCircularObstacle(CircleShape{0.05, Point{9., 4.}});
+  ASSERT_TRUE(is_region(map.Evolve(data).get_dirty_region(), 2, 3, 46, 91));
+
+  // Writing a region only marks the region dirty.
+  map.ClearDirtyRegion();
+  map.SetRegion(3, 4, MapData::Constant(2, 3, MapConstants::OBSTACLE));
+  ASSERT_TRUE(is_region(map.get_dirty_region(), 3, 4, 5, 7));
+  ASSERT_TRUE(map.get_data()
+                  .block(3, 4, 2, 3)
+                  .isApprox(MapData::Constant(2, 3, MapConstants::OBSTACLE)));
+  // The region must lie within the map.
+  ASSERT_THROW(map.SetRegion(49, 0, MapData::Zero(2, 2)),
+               std::invalid_argument);
+  ASSERT_THROW(map.SetRegion(0, -1, MapData::Zero(2, 2)),
+               std::invalid_argument);
+  ASSERT_TRUE(is_region(map.get_dirty_region(), 3, 4, 5, 7));
+
+  // Changes made through the data reference or set_data can't be tracked, so
+  // the whole map is marked dirty.
+  map.ClearDirtyRegion();
+  map.get_data_ref()(0, 0) = MapConstants::OBSTACLE;
+  ASSERT_TRUE(is_region(map.get_dirty_region(), 0, 0, 50, 100));
+  map.ClearDirtyRegion();
+  map.set_data(data);
+  ASSERT_TRUE(is_region(map.get_dirty_region(), 0, 0, 50, 100));
+}
+
 }  // namespace
 
 int main(int argc, char **argv) {
@@ -0,0 +1,166 @@
+#include "environment/include/occupancy_grid.h"
+
+#include "Eigen/Dense"
+#include "gtest/gtest.h"
+
+namespace {
+
+using std::make_unique;
+using std::unique_ptr;
+
+using morphac::common::aliases::MapData;
+using morphac::constants::MapConstants;
+using morphac::environment::Map;
+using morphac::environment::MapRegion;
+using morphac::environment::OccupancyGrid;
+
+// Number of obstacle pixels in the region, counted one pixel at a time.
+int CountObstacles(const MapData& data, const MapRegion& region) {
+  int count = 0;
+  for (int row = region.start_row; row < region.end_row; ++row) {
+    for (int col = region.start_col; col < region.end_col; ++col) {
+      count += data(row, col) == MapConstants::OBSTACLE;
+    }
+  }
+  return count;
+}
+
+class OccupancyGridTest : public ::testing::Test {
+ protected:
+  OccupancyGridTest() {
+    // Set random seed for Eigen.
+    srand(7);
+
+    // The number of columns isn't a multiple of the word size, so that the
+    // last word of each row is partially used.
+    data_ = MapData::Random(50, 150).unaryExpr([](const int value) {
+      return value % 3 == 0 ? MapConstants::OBSTACLE : MapConstants::EMPTY;
+    });
+    occupancy_grid_ = make_unique<OccupancyGrid>(data_, 0.1);
+  }
+
+  void SetUp() override {}
+
+  MapData data_;
+  unique_ptr<OccupancyGrid> occupancy_grid_;
+};
+
+TEST_F(OccupancyGridTest, Construction) {
+  OccupancyGrid occupancy_grid(10., 5., 0.1);
+
+  ASSERT_DOUBLE_EQ(occupancy_grid.get_width(), 10.);
+  ASSERT_DOUBLE_EQ(occupancy_grid.get_height(), 5.);
+  ASSERT_EQ(occupancy_grid.get_resolution(), 0.1);
+  ASSERT_EQ(occupancy_grid.get_rows(), 50);
+  ASSERT_EQ(occupancy_grid.get_cols(), 100);
+  ASSERT_TRUE(occupancy_grid.ToMapData().isZero());
+
+  ASSERT_DOUBLE_EQ(occupancy_grid_->get_width(), 15.);
+  ASSERT_DOUBLE_EQ(occupancy_grid_->get_height(), 5.);
+  ASSERT_EQ(occupancy_grid_->get_rows(), 50);
+  ASSERT_EQ(occupancy_grid_->get_cols(), 150);
+}
+
+TEST_F(OccupancyGridTest, InvalidConstruction) {
+  ASSERT_THROW(OccupancyGrid(0., 5., 0.1), std::invalid_argument);
+  ASSERT_THROW(OccupancyGrid(10., -5., 0.1), std::invalid_argument);
+  ASSERT_THROW(OccupancyGrid(10., 5., 0.), std::invalid_argument);
+  ASSERT_THROW(OccupancyGrid(10., 5., 0.3), std::invalid_argument);
+  ASSERT_THROW(OccupancyGrid(MapData::Zero(0, 5), 0.1), std::invalid_argument);
+  ASSERT_THROW(OccupancyGrid(MapData::Zero(5, 5), -0.1),
+               std::invalid_argument);
+}
+
+TEST_F(OccupancyGridTest, Conversion) {
+  // The conversion round trips binary data.
+  ASSERT_TRUE(occupancy_grid_->ToMapData() == data_);
+
+  Map map = occupancy_grid_->ToMap();
+  ASSERT_EQ(map.get_resolution(), 0.1);
+  ASSERT_TRUE(map.get_data() == data_);
+  ASSERT_TRUE(OccupancyGrid(map).ToMapData() == data_);
+
+  // Values other than MapConstants::OBSTACLE are free.
+  MapData data(2, 2);
+  data << MapConstants::OBSTACLE, 5, -1, MapConstants::EMPTY;
+  MapData expected_data(2, 2);
+  expected_data << MapConstants::OBSTACLE, MapConstants::EMPTY,
+      MapConstants::EMPTY, MapConstants::EMPTY;
+  ASSERT_TRUE(OccupancyGrid(data, 1.).ToMapData() == expected_data);
+}
+
+TEST_F(OccupancyGridTest, Occupancy) {
+  for (int row = 0; row < 50; ++row) {
+    for (int col = 0; col < 150; ++col) {
+      ASSERT_EQ(occupancy_grid_->IsOccupied(row, col),
+                data_(row, col) == MapConstants::OBSTACLE);
+    }
+  }
+
+  // Setting pixels on either side of a word boundary.
+  OccupancyGrid occupancy_grid(10., 5., 0.1);
+  occupancy_grid.SetOccupied(3, 63, true);
+  occupancy_grid.SetOccupied(3, 64, true);
+  occupancy_grid.SetOccupied(49, 99, true);
+  ASSERT_TRUE(occupancy_grid.IsOccupied(3, 63));
+  ASSERT_TRUE(occupancy_grid.IsOccupied(3, 64));
+  ASSERT_TRUE(occupancy_grid.IsOccupied(49, 99));
+  ASSERT_FALSE(occupancy_grid.IsOccupied(3, 62));
+  ASSERT_EQ(occupancy_grid.ToMapData().sum(), 3 * MapConstants::OBSTACLE);
+
+  occupancy_grid.SetOccupied(3, 64, false);
+  ASSERT_FALSE(occupancy_grid.IsOccupied(3, 64));
+  ASSERT_TRUE(occupancy_grid.IsOccupied(3, 63));
+}
+
+TEST_F(OccupancyGridTest, InvalidOccupancy) {
+  ASSERT_THROW(occupancy_grid_->IsOccupied(-1, 0), std::out_of_range);
+  ASSERT_THROW(occupancy_grid_->IsOccupied(0, 150), std::out_of_range);
+  ASSERT_THROW(occupancy_grid_->SetOccupied(50, 0, true), std::out_of_range);
+}
+
+TEST_F(OccupancyGridTest, RegionQueries) {
+  // Regions within a single word, across word boundaries, and over whole
+  // rows.
+  for (const auto& region :
+       {MapRegion{0, 0, 50, 150}, MapRegion{3, 5, 20, 40},
+        MapRegion{10, 60, 11, 70}, MapRegion{0, 63, 50, 129},
+        MapRegion{7, 64, 9, 128}, MapRegion{20, 149, 50, 150},
+        MapRegion{5, 5, 5, 10}}) {
+    ASSERT_EQ(occupancy_grid_->CountOccupied(region),
+              CountObstacles(data_, region));
+    ASSERT_EQ(occupancy_grid_->IsRegionFree(region),
+              CountObstacles(data_, region) == 0);
+  }
+
+  ASSERT_THROW(occupancy_grid_->CountOccupied(MapRegion{0, 0, 51, 10}),
+               std::out_of_range);
+  ASSERT_THROW(occupancy_grid_->IsRegionFree(MapRegion{-1, 0, 5, 10}),
+               std::out_of_range);
+}
+
+TEST_F(OccupancyGridTest, FillRegion) {
+  const MapRegion region{4, 60, 30, 131};
+  occupancy_grid_->FillRegion(region, false);
+  ASSERT_TRUE(occupancy_grid_->IsRegionFree(region));
+
+  // The pixels outside the region are untouched.
+  MapData expected_data = data_;
+  expected_data.block(4, 60, 26, 71).setConstant(MapConstants::EMPTY);
+  ASSERT_TRUE(occupancy_grid_->ToMapData() == expected_data);
+
+  occupancy_grid_->FillRegion(region, true);
+  expected_data.block(4, 60, 26, 71).setConstant(MapConstants::OBSTACLE);
+  ASSERT_TRUE(occupancy_grid_->ToMapData() == expected_data);
+  ASSERT_EQ(occupancy_grid_->CountOccupied(region), 26 * 71);
+
+  ASSERT_THROW(occupancy_grid_->FillRegion(MapRegion{0, 0, 10, 151}, true),
+               std::out_of_range);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,192 @@
+#include "environment/include/tiled_map.h"
+
+#include <cstdio>
+#include <fstream>
+
+#include "Eigen/Dense"
+#include "gtest/gtest.h"
+
+namespace {
+
+using std::ifstream;
+using std::make_unique;
+using std::ofstream;
+using std::remove;
+using std::string;
+using std::unique_ptr;
+
+using morphac::common::aliases::MapData;
+using morphac::constants::MapConstants;
+using morphac::environment::Map;
+using morphac::environment::MapRegion;
+using morphac::environment::TiledMap;
+
+class TiledMapTest : public ::testing::Test {
+ protected:
+  TiledMapTest() {
+    // Set random seed for Eigen.
+    srand(7);
+
+    // 50 x 70 pixels, in 16 x 16 tiles. The tiles along the bottom and right
+    // edges are partially outside the map.
+    tiled_map_ = make_unique<TiledMap>(7., 5., 0.1, 16);
+  }
+
+  void SetUp() override {}
+
+  unique_ptr<TiledMap> tiled_map_;
+};
+
+TEST_F(TiledMapTest, Construction) {
+  ASSERT_DOUBLE_EQ(tiled_map_->get_width(), 7.);
+  ASSERT_DOUBLE_EQ(tiled_map_->get_height(), 5.);
+  ASSERT_EQ(tiled_map_->get_resolution(), 0.1);
+  ASSERT_EQ(tiled_map_->get_rows(), 50);
+  ASSERT_EQ(tiled_map_->get_cols(), 70);
+  ASSERT_EQ(tiled_map_->get_tile_size(), 16);
+  ASSERT_EQ(tiled_map_->get_num_tiles(), 4 * 5);
+  ASSERT_EQ(tiled_map_->get_num_allocated_tiles(), 0);
+
+  // Huge maps are constructed without allocating any tiles. This is
+  // 100000 x 100000 pixels.
+  TiledMap huge_tiled_map(2000., 2000., 0.02);
+  ASSERT_EQ(huge_tiled_map.get_rows(), 100000);
+  ASSERT_EQ(huge_tiled_map.get_num_allocated_tiles(), 0);
+  ASSERT_EQ(huge_tiled_map.GetPixel(54321, 98765), MapConstants::EMPTY);
+}
+
+TEST_F(TiledMapTest, InvalidConstruction) {
+  ASSERT_THROW(TiledMap(0., 5., 0.1), std::invalid_argument);
+  ASSERT_THROW(TiledMap(7., -5., 0.1), std::invalid_argument);
+  ASSERT_THROW(TiledMap(7., 5., 0.), std::invalid_argument);
+  ASSERT_THROW(TiledMap(7., 5., 0.3), std::invalid_argument);
+  ASSERT_THROW(TiledMap(7., 5., 0.1, 0), std::invalid_argument);
+  ASSERT_THROW(TiledMap(7., 5., 0.1, "/nonexistent/directory/map"),
+               std::runtime_error);
+}
+
+TEST_F(TiledMapTest, Pixels) {
+  // Reads don't allocate tiles.
+  ASSERT_EQ(tiled_map_->GetPixel(20, 30), MapConstants::EMPTY);
+  ASSERT_EQ(tiled_map_->get_num_allocated_tiles(), 0);
+  // Neither does writing empty values to unallocated tiles.
+  tiled_map_->SetPixel(20, 30, MapConstants::EMPTY);
+  ASSERT_EQ(tiled_map_->get_num_allocated_tiles(), 0);
+
+  tiled_map_->SetPixel(20, 30, MapConstants::OBSTACLE);
+  tiled_map_->SetPixel(21, 31, 5);
+  tiled_map_->SetPixel(49, 69, MapConstants::OBSTACLE);
+  ASSERT_EQ(tiled_map_->GetPixel(20, 30), MapConstants::OBSTACLE);
+  ASSERT_EQ(tiled_map_->GetPixel(21, 31), 5);
+  ASSERT_EQ(tiled_map_->GetPixel(49, 69), MapConstants::OBSTACLE);
+  // The rest of an allocated tile is empty.
+  ASSERT_EQ(tiled_map_->GetPixel(20, 31), MapConstants::EMPTY);
+  ASSERT_EQ(tiled_map_->get_num_allocated_tiles(), 2);
+
+  ASSERT_THROW(tiled_map_->GetPixel(50, 0), std::out_of_range);
+  ASSERT_THROW(tiled_map_->SetPixel(0, -1, 1), std::out_of_range);
+}
+
+TEST_F(TiledMapTest, Regions) {
+  // The region spans parts of several tiles.
+  const MapData data = MapData::Random(30, 40);
+  tiled_map_->SetRegion(10, 20, data);
+
+  MapData expected_data = MapData::Zero(50, 70);
+  expected_data.block(10, 20, 30, 40) = data;
+  ASSERT_TRUE(tiled_map_->GetRegion(MapRegion{0, 0, 50, 70}) == expected_data);
+  ASSERT_TRUE(tiled_map_->GetRegion(MapRegion{5, 15, 45, 65}) ==
+              expected_data.block(5, 15, 40, 50));
+  ASSERT_EQ(tiled_map_->GetRegion(MapRegion{5, 5, 5, 10}).size(), 0);
+
+  // Filling with empty values keeps the tiles allocated, while the untouched
+  // tiles remain unallocated.
+  const int num_allocated_tiles = tiled_map_->get_num_allocated_tiles();
+  tiled_map_->FillRegion(MapRegion{0, 0, 50, 70}, MapConstants::EMPTY);
+  ASSERT_TRUE(tiled_map_->GetRegion(MapRegion{0, 0, 50, 70}).isZero());
+  ASSERT_EQ(tiled_map_->get_num_allocated_tiles(), num_allocated_tiles);
+
+  tiled_map_->FillRegion(MapRegion{40, 60, 50, 70}, MapConstants::OBSTACLE);
+  expected_data.setZero();
+  expected_data.block(40, 60, 10, 10).setConstant(MapConstants::OBSTACLE);
+  ASSERT_TRUE(tiled_map_->GetRegion(MapRegion{0, 0, 50, 70}) == expected_data);
+
+  ASSERT_THROW(tiled_map_->GetRegion(MapRegion{0, 0, 51, 70}),
+               std::out_of_range);
+  ASSERT_THROW(tiled_map_->SetRegion(40, 60, MapData::Ones(11, 10)),
+               std::out_of_range);
+  ASSERT_THROW(tiled_map_->FillRegion(MapRegion{-1, 0, 5, 5}, 1),
+               std::out_of_range);
+}
+
+TEST_F(TiledMapTest, SparseRegions) {
+  // Only the tiles that receive non-empty values are allocated. The obstacle
+  // is in the tile at (1, 2).
+  MapData data = MapData::Zero(50, 70);
+  data(20, 40) = MapConstants::OBSTACLE;
+  tiled_map_->SetRegion(0, 0, data);
+
+  ASSERT_EQ(tiled_map_->get_num_allocated_tiles(), 1);
+  ASSERT_TRUE(tiled_map_->GetRegion(MapRegion{0, 0, 50, 70}) == data);
+
+  tiled_map_->FillRegion(MapRegion{0, 0, 50, 70}, MapConstants::EMPTY);
+  ASSERT_EQ(tiled_map_->get_num_allocated_tiles(), 1);
+}
+
+TEST_F(TiledMapTest, ToMap) {
+  tiled_map_->FillRegion(MapRegion{10, 10, 20, 20}, MapConstants::OBSTACLE);
+  Map map = tiled_map_->ToMap(MapRegion{5, 5, 25, 35});
+
+  ASSERT_EQ(map.get_resolution(), 0.1);
+  ASSERT_EQ(map.get_data().rows(), 20);
+  ASSERT_EQ(map.get_data().cols(), 30);
+  ASSERT_EQ(map.get_data().sum(), 100 * MapConstants::OBSTACLE);
+  ASSERT_EQ(map.get_data()(5, 5), MapConstants::OBSTACLE);
+}
+
+TEST_F(TiledMapTest, FileBacked) {
+  const string file_path = testing::TempDir() + "tiled_map_test.bin";
+  // Removing any file left behind by an earlier run.
+  remove(file_path.c_str());
+  {
+    TiledMap tiled_map(7., 5., 0.1, file_path, 16);
+    ASSERT_EQ(tiled_map.get_num_allocated_tiles(), 0);
+    ASSERT_EQ(tiled_map.GetPixel(20, 30), MapConstants::EMPTY);
+
+    const MapData data = MapData::Random(30, 40);
+    tiled_map.SetRegion(10, 20, data);
+    tiled_map.SetPixel(49, 69, MapConstants::OBSTACLE);
+    ASSERT_TRUE(tiled_map.GetRegion(MapRegion{10, 20, 40, 60}) == data);
+    ASSERT_EQ(tiled_map.GetPixel(49, 69), MapConstants::OBSTACLE);
+    ASSERT_EQ(tiled_map.GetPixel(0, 0), MapConstants::EMPTY);
+
+    // The file is removed once it is mapped.
+    ASSERT_FALSE(ifstream(file_path).good());
+  }
+
+  // The same path may be used again.
+  {
+    TiledMap tiled_map(7., 5., 0.1, file_path, 16);
+    ASSERT_EQ(tiled_map.GetPixel(49, 69), MapConstants::EMPTY);
+  }
+
+  // An existing file is only overwritten if it is asked for.
+  {
+    ofstream file(file_path);
+    file << "map";
+  }
+  ASSERT_THROW(TiledMap(7., 5., 0.1, file_path, 16), std::runtime_error);
+  ASSERT_TRUE(ifstream(file_path).good());
+  {
+    TiledMap tiled_map(7., 5., 0.1, file_path, 16, true);
+    ASSERT_EQ(tiled_map.GetPixel(49, 69), MapConstants::EMPTY);
+  }
+  ASSERT_FALSE(ifstream(file_path).good());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
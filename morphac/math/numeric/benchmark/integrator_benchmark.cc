@@ -0,0 +1,219 @@
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Eigen/Dense"
+#include "benchmark/benchmark.h"
+
+#include "constructs/include/control_input.h"
+#include "constructs/include/state.h"
+#include "math/numeric/include/dormand_prince_integrator.h"
+#include "math/numeric/include/euler_integrator.h"
+#include "math/numeric/include/exact_integrator.h"
+#include "math/numeric/include/integrator.h"
+#include "math/numeric/include/mid_point_integrator.h"
+#include "math/numeric/include/rk4_integrator.h"
+#include "math/numeric/test/allocation_counter.h"
+#include "mechanics/models/include/ackermann_model.h"
+#include "mechanics/models/include/diffdrive_model.h"
+#include "mechanics/models/include/dubin_model.h"
+#include "mechanics/models/include/kinematic_model.h"
+#include "mechanics/models/include/tricycle_model.h"
+
+namespace {
+
+using std::function;
+using std::make_unique;
+using std::string;
+using std::unique_ptr;
+using std::vector;
+
+using morphac::constructs::ControlInput;
+using morphac::constructs::State;
+using morphac::math::numeric::DormandPrinceIntegrator;
+using morphac::math::numeric::EulerIntegrator;
+using morphac::math::numeric::ExactIntegrator;
+using morphac::math::numeric::Integrator;
+using morphac::math::numeric::MidPointIntegrator;
+using morphac::math::numeric::RK4Integrator;
+using morphac::mechanics::models::AckermannModel;
+using morphac::mechanics::models::DiffdriveModel;
+using morphac::mechanics::models::DubinModel;
+using morphac::mechanics::models::KinematicModel;
+using morphac::mechanics::models::TricycleModel;
+
+constexpr double kDt = 0.01;
+// Time that Integrate integrates for.
+constexpr double kIntegrationTime = 1.;
+// Number of steps of a rollout.
+constexpr int kNumRolloutSteps = 1000;
+
+// Model along with a valid state and control input to step it with.
+struct ModelSetup {
+  string name;
+  unique_ptr<KinematicModel> kinematic_model;
+  State state;
+  ControlInput control_input;
+};
+
+struct IntegratorSetup {
+  string name;
+  function<unique_ptr<Integrator>(KinematicModel&)> create_integrator;
+};
+
+vector<ModelSetup> CreateModelSetups() {
+  vector<ModelSetup> model_setups;
+  model_setups.push_back({"Diffdrive", make_unique<DiffdriveModel>(0.1, 0.4),
+                          State({0., 0., 0.}, {}), ControlInput({1., 0.5})});
+  model_setups.push_back({"Dubin", make_unique<DubinModel>(1.),
+                          State({0., 0., 0.}, {}), ControlInput({0.5})});
+  model_setups.push_back({"Ackermann", make_unique<AckermannModel>(1., 2.),
+                          State({0., 0., 0., 0.}, {}),
+                          ControlInput({1., 0.1})});
+  model_setups.push_back({"Tricycle", make_unique<TricycleModel>(1., 2.),
+                          State({0., 0., 0., 0.}, {}),
+                          ControlInput({1., 0.1})});
+  return model_setups;
+}
+
+vector<IntegratorSetup> CreateIntegratorSetups() {
+  return {
+      {"Euler",
+       [](KinematicModel& kinematic_model) {
+         return make_unique<EulerIntegrator>(kinematic_model);
+       }},
+      {"MidPoint",
+       [](KinematicModel& kinematic_model) {
+         return make_unique<MidPointIntegrator>(kinematic_model);
+       }},
+      {"RK4",
+       [](KinematicModel& kinematic_model) {
+         return make_unique<RK4Integrator>(kinematic_model);
+       }},
+      {"DormandPrince",
+       [](KinematicModel& kinematic_model) {
+         return make_unique<DormandPrinceIntegrator>(kinematic_model, 1e-6,
+                                                     1e-6);
+       }},
+      {"Exact",
+       [](KinematicModel& kinematic_model) {
+         return make_unique<ExactIntegrator>(kinematic_model);
+       }},
+  };
+}
+
+// Reports the heap allocations per iteration (See num_allocations).
+void SetAllocationsCounter(benchmark::State& benchmark_state,
+                           const long initial_num_allocations) {
+  benchmark_state.counters["allocations"] =
+      benchmark::Counter(num_allocations - initial_num_allocations,
+                         benchmark::Counter::kAvgIterations);
+}
+
+void BM_Step(benchmark::State& benchmark_state, const Integrator& integrator,
+             const ModelSetup& model_setup) {
+  State updated_state = model_setup.state;
+  const long initial_num_allocations = num_allocations;
+
+  for (auto _ : benchmark_state) {
+    updated_state =
+        integrator.Step(model_setup.state, model_setup.control_input, kDt);
+    benchmark::DoNotOptimize(updated_state);
+  }
+  SetAllocationsCounter(benchmark_state, initial_num_allocations);
+}
+
+void BM_StepInPlace(benchmark::State& benchmark_state,
+                    const Integrator& integrator,
+                    const ModelSetup& model_setup) {
+  State updated_state = model_setup.state;
+  const long initial_num_allocations = num_allocations;
+
+  for (auto _ : benchmark_state) {
+    integrator.Step(model_setup.state, model_setup.control_input, kDt,
+                    updated_state);
+    benchmark::DoNotOptimize(updated_state);
+  }
+  SetAllocationsCounter(benchmark_state, initial_num_allocations);
+}
+
+void BM_Integrate(benchmark::State& benchmark_state,
+                  const Integrator& integrator,
+                  const ModelSetup& model_setup) {
+  const long initial_num_allocations = num_allocations;
+
+  for (auto _ : benchmark_state) {
+    State updated_state =
+        integrator.Integrate(model_setup.state, model_setup.control_input,
+                             kIntegrationTime, kDt);
+    benchmark::DoNotOptimize(updated_state);
+  }
+  SetAllocationsCounter(benchmark_state, initial_num_allocations);
+}
+
+// Steps the robot, recording the state of every step like a simulation (or a
+// planner rollout) would.
+void BM_Rollout(benchmark::State& benchmark_state,
+                const Integrator& integrator, const ModelSetup& model_setup) {
+  const long initial_num_allocations = num_allocations;
+
+  for (auto _ : benchmark_state) {
+    State state = model_setup.state;
+    vector<State> states;
+    for (int i = 0; i < kNumRolloutSteps; ++i) {
+      state = integrator.Step(state, model_setup.control_input, kDt);
+      states.push_back(state);
+    }
+    benchmark::DoNotOptimize(states);
+  }
+  SetAllocationsCounter(benchmark_state, initial_num_allocations);
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() *
+                                    kNumRolloutSteps);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  // The benchmarks refer to the models and integrators, so they must outlive
+  // the run.
+  const vector<ModelSetup> model_setups = CreateModelSetups();
+  vector<unique_ptr<Integrator>> integrators;
+
+  for (const auto& model_setup : model_setups) {
+    for (const auto& integrator_setup : CreateIntegratorSetups()) {
+      if (integrator_setup.name == "Exact" &&
+          !model_setup.kinematic_model->HasExactStep()) {
+        continue;
+      }
+      integrators.push_back(
+          integrator_setup.create_integrator(*model_setup.kinematic_model));
+      const Integrator& integrator = *integrators.back();
+      const string suffix = model_setup.name + "/" + integrator_setup.name;
+
+      benchmark::RegisterBenchmark(("BM_Step/" + suffix).c_str(), BM_Step,
+                                   std::cref(integrator),
+                                   std::cref(model_setup));
+      benchmark::RegisterBenchmark(("BM_StepInPlace/" + suffix).c_str(),
+                                   BM_StepInPlace, std::cref(integrator),
+                                   std::cref(model_setup));
+      benchmark::RegisterBenchmark(("BM_Integrate/" + suffix).c_str(),
+                                   BM_Integrate, std::cref(integrator),
+                                   std::cref(model_setup))
+          ->Unit(benchmark::kMicrosecond);
+      benchmark::RegisterBenchmark(("BM_Rollout/" + suffix).c_str(),
+                                   BM_Rollout, std::cref(integrator),
+                                   std::cref(model_setup))
+          ->Unit(benchmark::kMicrosecond);
+    }
+  }
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -4,6 +4,8 @@ from ._binding_numeric_python import (
     EulerIntegrator,
     MidPointIntegrator,
     RK4Integrator,
+    DormandPrinceIntegrator,
+    ExactIntegrator,
 )
 
 from morphac.constructs._binding_constructs_python import State as _State
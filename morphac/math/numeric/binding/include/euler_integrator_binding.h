@@ -3,6 +3,7 @@
 
 #include "constructs/include/control_input.h"
 #include "constructs/include/state.h"
+#include "math/numeric/binding/include/integrator_binding.h"
 #include "math/numeric/include/euler_integrator.h"
 #include "math/numeric/include/integrator.h"
 #include "mechanics/models/include/kinematic_model.h"
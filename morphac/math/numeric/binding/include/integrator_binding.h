@@ -1,10 +1,12 @@
 #ifndef INTEGRATOR_BINDING_H
 #define INTEGRATOR_BINDING_H
 
+#include "common/error_handling/include/error_macros.h"
 #include "constructs/include/control_input.h"
 #include "constructs/include/state.h"
 #include "math/numeric/include/integrator.h"
 #include "mechanics/models/include/kinematic_model.h"
+#include "pybind11/eigen.h"
 #include "pybind11/pybind11.h"
 
 namespace morphac {
@@ -17,12 +19,21 @@ class PyIntegrator : public morphac::math::numeric::Integrator {
  public:
   using Integrator::Integrator;
 
+  // The states computed in python are validated here, as the kinematic
+  // models only validate them on their hot paths.
   morphac::constructs::State Step(
       const morphac::constructs::State& state,
       const morphac::constructs::ControlInput& control_input,
       const double dt) const override {
-    PYBIND11_OVERLOAD_PURE_NAME(morphac::constructs::State, Integrator, "step",
-                                Step, state, control_input, dt);
+    morphac::constructs::State updated_state =
+        ComputePythonStep(state, control_input, dt);
+    MORPH_REQUIRE(
+        updated_state.get_pose_size() == kinematic_model_.pose_size &&
+            updated_state.get_velocity_size() == kinematic_model_.velocity_size,
+        std::invalid_argument,
+        "Dimensions of the state computed in python do not match the "
+        "dimensions of the kinematic model.");
+    return updated_state;
   }
 
   morphac::constructs::State Integrate(
@@ -32,8 +43,43 @@ class PyIntegrator : public morphac::math::numeric::Integrator {
     PYBIND11_OVERLOAD_NAME(morphac::constructs::State, Integrator, "integrate",
                            Integrate, state, control_input, time, dt);
   }
+
+ private:
+  morphac::constructs::State ComputePythonStep(
+      const morphac::constructs::State& state,
+      const morphac::constructs::ControlInput& control_input,
+      const double dt) const {
+    PYBIND11_OVERLOAD_PURE_NAME(morphac::constructs::State, Integrator, "step",
+                                Step, state, control_input, dt);
+  }
 };
 
+// The integrators only validate the dimensions of the states and control
+// inputs on their hot paths, which are not checked below the full check
+// level. As everything coming in from python is an API boundary, the
+// integrator bindings go through these functions, which validate the
+// arguments against the kinematic model before calling into the integrator.
+void RequireDimensions(const morphac::math::numeric::Integrator& integrator,
+                       const morphac::constructs::State& state,
+                       const morphac::constructs::ControlInput& control_input);
+morphac::constructs::State Step(
+    const morphac::math::numeric::Integrator& integrator,
+    const morphac::constructs::State& state,
+    const morphac::constructs::ControlInput& control_input, const double dt);
+morphac::constructs::State Integrate(
+    const morphac::math::numeric::Integrator& integrator,
+    const morphac::constructs::State& state,
+    const morphac::constructs::ControlInput& control_input, const double time,
+    const double dt);
+Eigen::MatrixXd ComputeStateJacobian(
+    const morphac::math::numeric::Integrator& integrator,
+    const morphac::constructs::State& state,
+    const morphac::constructs::ControlInput& control_input, const double dt);
+Eigen::MatrixXd ComputeControlJacobian(
+    const morphac::math::numeric::Integrator& integrator,
+    const morphac::constructs::State& state,
+    const morphac::constructs::ControlInput& control_input, const double dt);
+
 void define_integrator_binding(pybind11::module& m);
 
 void define_integrator_type_binding(pybind11::module& m);
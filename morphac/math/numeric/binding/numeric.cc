@@ -1,4 +1,6 @@
+#include "math/numeric/binding/include/dormand_prince_integrator_binding.h"
 #include "math/numeric/binding/include/euler_integrator_binding.h"
+#include "math/numeric/binding/include/exact_integrator_binding.h"
 #include "math/numeric/binding/include/integrator_binding.h"
 #include "math/numeric/binding/include/mid_point_integrator_binding.h"
 #include "math/numeric/binding/include/rk4_integrator_binding.h"
@@ -18,6 +20,8 @@ PYBIND11_MODULE(_binding_numeric_python, m) {
   define_euler_integrator_binding(m);
   define_mid_point_integrator_binding(m);
   define_rk4_integrator_binding(m);
+  define_dormand_prince_integrator_binding(m);
+  define_exact_integrator_binding(m);
 }
 
 }  // namespace binding
@@ -0,0 +1,47 @@
+#include "math/numeric/binding/include/dormand_prince_integrator_binding.h"
+
+namespace morphac {
+namespace math {
+namespace numeric {
+namespace binding {
+
+namespace py = pybind11;
+
+using morphac::constructs::ControlInput;
+using morphac::constructs::State;
+using morphac::math::numeric::DormandPrinceIntegrator;
+using morphac::math::numeric::Integrator;
+using morphac::mechanics::models::KinematicModel;
+
+void define_dormand_prince_integrator_binding(py::module& m) {
+  py::class_<DormandPrinceIntegrator, Integrator> dormand_prince_integrator(
+      m, "DormandPrinceIntegrator");
+
+  dormand_prince_integrator.def(
+      py::init<KinematicModel&, const double, const double>(),
+      py::arg("kinematic_model"), py::arg("absolute_tolerance") = 1e-6,
+      py::arg("relative_tolerance") = 1e-6, py::keep_alive<1, 2>());
+  dormand_prince_integrator.def(
+      "step",
+      [](const DormandPrinceIntegrator& dormand_prince_integrator,
+         const State& state, const ControlInput& control_input,
+         const double dt) {
+        // The integrator only validates dt on its hot path.
+        MORPH_REQUIRE(dt >= 0, std::invalid_argument,
+                      "dt must be non-negative.");
+        return Step(dormand_prince_integrator, state, control_input, dt);
+      },
+      py::arg("robot_state"), py::arg("control_input"), py::arg("dt"));
+  dormand_prince_integrator.def("integrate", &Integrate, py::arg("robot_state"),
+                                py::arg("control_input"), py::arg("time"),
+                                py::arg("dt"));
+  dormand_prince_integrator.def_property_readonly(
+      "absolute_tolerance", &DormandPrinceIntegrator::get_absolute_tolerance);
+  dormand_prince_integrator.def_property_readonly(
+      "relative_tolerance", &DormandPrinceIntegrator::get_relative_tolerance);
+}
+
+}  // namespace binding
+}  // namespace numeric
+}  // namespace math
+}  // namespace morphac
@@ -0,0 +1,30 @@
+#include "math/numeric/binding/include/exact_integrator_binding.h"
+
+namespace morphac {
+namespace math {
+namespace numeric {
+namespace binding {
+
+namespace py = pybind11;
+
+using morphac::math::numeric::ExactIntegrator;
+using morphac::math::numeric::Integrator;
+using morphac::mechanics::models::KinematicModel;
+
+void define_exact_integrator_binding(py::module& m) {
+  py::class_<ExactIntegrator, Integrator> exact_integrator(m,
+                                                           "ExactIntegrator");
+
+  exact_integrator.def(py::init<KinematicModel&>(), py::arg("kinematic_model"),
+                       py::keep_alive<1, 2>());
+  exact_integrator.def("step", &Step, py::arg("robot_state"),
+                       py::arg("control_input"), py::arg("dt"));
+  exact_integrator.def("integrate", &Integrate, py::arg("robot_state"),
+                       py::arg("control_input"), py::arg("time"),
+                       py::arg("dt"));
+}
+
+}  // namespace binding
+}  // namespace numeric
+}  // namespace math
+}  // namespace morphac
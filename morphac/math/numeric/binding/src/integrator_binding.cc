@@ -7,19 +7,70 @@ namespace binding {
 
 namespace py = pybind11;
 
+using Eigen::MatrixXd;
+
+using morphac::constructs::ControlInput;
+using morphac::constructs::State;
 using morphac::math::numeric::Integrator;
 using morphac::math::numeric::IntegratorType;
 using morphac::mechanics::models::KinematicModel;
 
+void RequireDimensions(const Integrator& integrator, const State& state,
+                       const ControlInput& control_input) {
+  const KinematicModel& kinematic_model = integrator.get_kinematic_model();
+  MORPH_REQUIRE(state.get_pose_size() == kinematic_model.pose_size &&
+                    state.get_velocity_size() == kinematic_model.velocity_size,
+                std::invalid_argument,
+                "State dimensions do not match the dimensions of the "
+                "kinematic model.");
+  MORPH_REQUIRE(control_input.get_size() == kinematic_model.control_input_size,
+                std::invalid_argument,
+                "Control input must be of size control_input_size.");
+}
+
+State Step(const Integrator& integrator, const State& state,
+           const ControlInput& control_input, const double dt) {
+  RequireDimensions(integrator, state, control_input);
+  return integrator.Step(state, control_input, dt);
+}
+
+State Integrate(const Integrator& integrator, const State& state,
+                const ControlInput& control_input, const double time,
+                const double dt) {
+  RequireDimensions(integrator, state, control_input);
+  return integrator.Integrate(state, control_input, time, dt);
+}
+
+MatrixXd ComputeStateJacobian(const Integrator& integrator, const State& state,
+                              const ControlInput& control_input,
+                              const double dt) {
+  RequireDimensions(integrator, state, control_input);
+  return integrator.ComputeStateJacobian(state, control_input, dt);
+}
+
+MatrixXd ComputeControlJacobian(const Integrator& integrator,
+                                const State& state,
+                                const ControlInput& control_input,
+                                const double dt) {
+  RequireDimensions(integrator, state, control_input);
+  return integrator.ComputeControlJacobian(state, control_input, dt);
+}
+
 void define_integrator_binding(py::module& m) {
   py::class_<Integrator, PyIntegrator> integrator(m, "Integrator");
 
   integrator.def(py::init<KinematicModel&>(), py::arg("kinematic_model"),
                  py::keep_alive<1, 2>());
-  integrator.def("step", &Integrator::Step, py::arg("robot_state"),
+  integrator.def("step", &Step, py::arg("robot_state"),
                  py::arg("control_input"), py::arg("dt"));
-  integrator.def("integrate", &Integrator::Integrate, py::arg("robot_state"),
+  integrator.def("integrate", &Integrate, py::arg("robot_state"),
                  py::arg("control_input"), py::arg("time"), py::arg("dt"));
+  integrator.def("compute_state_jacobian", &ComputeStateJacobian,
+                 py::arg("robot_state"), py::arg("control_input"),
+                 py::arg("dt"));
+  integrator.def("compute_control_jacobian", &ComputeControlJacobian,
+                 py::arg("robot_state"), py::arg("control_input"),
+                 py::arg("dt"));
 }
 
 void define_integrator_type_binding(py::module& m) {
@@ -28,6 +79,9 @@ void define_integrator_type_binding(py::module& m) {
   integrator_type.value("MID_POINT_INTEGRATOR",
                         IntegratorType::kMidPointIntegrator);
   integrator_type.value("RK4_INTEGRATOR", IntegratorType::kRK4Integrator);
+  integrator_type.value("DORMAND_PRINCE_INTEGRATOR",
+                        IntegratorType::kDormandPrinceIntegrator);
+  integrator_type.value("EXACT_INTEGRATOR", IntegratorType::kExactIntegrator);
 }
 
 }  // namespace binding
@@ -16,11 +16,10 @@ void define_rk4_integrator_binding(py::module& m) {
 
   rk4_integrator.def(py::init<KinematicModel&>(), py::arg("kinematic_model"),
                      py::keep_alive<1, 2>());
-  rk4_integrator.def("step", &RK4Integrator::Step, py::arg("robot_state"),
+  rk4_integrator.def("step", &Step, py::arg("robot_state"),
                      py::arg("control_input"), py::arg("dt"));
-  rk4_integrator.def("integrate", &RK4Integrator::Integrate,
-                     py::arg("robot_state"), py::arg("control_input"),
-                     py::arg("time"), py::arg("dt"));
+  rk4_integrator.def("integrate", &Integrate, py::arg("robot_state"),
+                     py::arg("control_input"), py::arg("time"), py::arg("dt"));
 }
 
 }  // namespace binding
@@ -1,4 +1,6 @@
+#include "math/numeric/include/dormand_prince_integrator.h"
 #include "math/numeric/include/euler_integrator.h"
+#include "math/numeric/include/exact_integrator.h"
 #include "math/numeric/include/integrator.h"
 #include "math/numeric/include/mid_point_integrator.h"
 #include "math/numeric/include/rk4_integrator.h"
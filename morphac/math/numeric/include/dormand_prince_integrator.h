@@ -0,0 +1,87 @@
+#ifndef DORMAND_PRINCE_INTEGRATOR_H
+#define DORMAND_PRINCE_INTEGRATOR_H
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "common/error_handling/include/error_macros.h"
+#include "constructs/include/control_input.h"
+#include "constructs/include/state.h"
+#include "math/numeric/include/integrator.h"
+#include "mechanics/models/include/kinematic_model.h"
+
+namespace morphac {
+namespace math {
+namespace numeric {
+
+// Adaptive step Dormand-Prince (RK45) integrator. Each sub-step computes a
+// fifth order solution along with an embedded fourth order solution, the
+// difference of which is used as an estimate of the local error. Sub-steps
+// with an error larger than the tolerance are rejected and retried with a
+// smaller step size, and the step size grows again when the error is small.
+// The tolerance of each element is absolute_tolerance + relative_tolerance *
+// |element|.
+class DormandPrinceIntegrator : public morphac::math::numeric::Integrator {
+ public:
+  DormandPrinceIntegrator(
+      morphac::mechanics::models::KinematicModel& kinematic_model,
+      const double absolute_tolerance = 1e-6,
+      const double relative_tolerance = 1e-6);
+
+  // Integrates through dt, using dt as the initial step size. Hence if the
+  // error of the whole step is within the tolerance, only one step is taken.
+  morphac::constructs::State Step(
+      const morphac::constructs::State& state,
+      const morphac::constructs::ControlInput& control_input,
+      const double dt) const override;
+  void Step(const morphac::constructs::State& state,
+            const morphac::constructs::ControlInput& control_input,
+            const double dt,
+            morphac::constructs::State& updated_state) const override;
+
+  // Unlike the fixed step integrators, the time is not chopped into uniform
+  // steps of dt. dt is only the initial step size, after which the step size
+  // adapts to the error estimate (Possibly growing much larger than dt).
+  morphac::constructs::State Integrate(
+      const morphac::constructs::State& state,
+      const morphac::constructs::ControlInput& control_input, const double time,
+      const double dt) const override;
+
+  // Jacobians of Step, propagated through the stages of each of the accepted
+  // sub-steps.
+  void ComputeJacobians(const morphac::constructs::State& state,
+                        const morphac::constructs::ControlInput& control_input,
+                        const double dt, Eigen::MatrixXd& state_jacobian,
+                        Eigen::MatrixXd& control_jacobian) const override;
+
+  double get_absolute_tolerance() const;
+  double get_relative_tolerance() const;
+
+ private:
+  // If accepted_dts is given, the sizes of the accepted sub-steps are
+  // appended to it.
+  void IntegrateAdaptively(
+      const morphac::constructs::State& state,
+      const morphac::constructs::ControlInput& control_input, const double time,
+      const double initial_dt, morphac::constructs::State& updated_state,
+      std::vector<double>* accepted_dts = nullptr) const;
+
+  // Root mean square of the estimated local error, with each element scaled
+  // by its tolerance. An error <= 1 is within the tolerance.
+  double ComputeScaledError(const double dt) const;
+
+  const double absolute_tolerance_;
+  const double relative_tolerance_;
+
+  // Scratch buffers used while integrating.
+  mutable morphac::constructs::State k1_, k2_, k3_, k4_, k5_, k6_, k7_;
+  mutable morphac::constructs::State current_state_, intermediate_state_,
+      candidate_state_;
+};
+
+}  // namespace numeric
+}  // namespace math
+}  // namespace morphac
+
+#endif
@@ -18,6 +18,20 @@ class EulerIntegrator : public morphac::math::numeric::Integrator {
       const morphac::constructs::State& state,
       const morphac::constructs::ControlInput& control_input,
       const double dt) const override;
+  void Step(const morphac::constructs::State& state,
+            const morphac::constructs::ControlInput& control_input,
+            const double dt,
+            morphac::constructs::State& updated_state) const override;
+
+  // Jacobians of the Euler step, I + dt * df/dx and dt * df/du.
+  void ComputeJacobians(const morphac::constructs::State& state,
+                        const morphac::constructs::ControlInput& control_input,
+                        const double dt, Eigen::MatrixXd& state_jacobian,
+                        Eigen::MatrixXd& control_jacobian) const override;
+
+ private:
+  // Scratch buffers used while stepping.
+  mutable morphac::constructs::State derivative_;
 };
 
 }  // namespace numeric
@@ -0,0 +1,43 @@
+#ifndef EXACT_INTEGRATOR_H
+#define EXACT_INTEGRATOR_H
+
+#include "common/error_handling/include/error_macros.h"
+#include "constructs/include/control_input.h"
+#include "constructs/include/state.h"
+#include "math/numeric/include/integrator.h"
+#include "mechanics/models/include/kinematic_model.h"
+
+namespace morphac {
+namespace math {
+namespace numeric {
+
+// Integrator for models that have a closed form solution under a constant
+// control input (See KinematicModel::ExactStep). As there is no truncation
+// error, arbitrarily large time steps can be taken without any drift. The
+// model must have an exact step.
+class ExactIntegrator : public morphac::math::numeric::Integrator {
+ public:
+  ExactIntegrator(morphac::mechanics::models::KinematicModel& kinematic_model);
+
+  morphac::constructs::State Step(
+      const morphac::constructs::State& state,
+      const morphac::constructs::ControlInput& control_input,
+      const double dt) const override;
+  void Step(const morphac::constructs::State& state,
+            const morphac::constructs::ControlInput& control_input,
+            const double dt,
+            morphac::constructs::State& updated_state) const override;
+
+  // As the step is exact, the whole time is integrated in a single step and
+  // dt is unused (It is only validated).
+  morphac::constructs::State Integrate(
+      const morphac::constructs::State& state,
+      const morphac::constructs::ControlInput& control_input, const double time,
+      const double dt) const override;
+};
+
+}  // namespace numeric
+}  // namespace math
+}  // namespace morphac
+
+#endif
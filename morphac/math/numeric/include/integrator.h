@@ -1,6 +1,13 @@
 #ifndef INTEGRATOR_H
 #define INTEGRATOR_H
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "Eigen/Dense"
+#include "common/error_handling/include/error_macros.h"
 #include "constructs/include/control_input.h"
 #include "constructs/include/state.h"
 #include "mechanics/models/include/kinematic_model.h"
@@ -12,7 +19,9 @@ namespace numeric {
 enum class IntegratorType {
   kEulerIntegrator,
   kMidPointIntegrator,
-  kRK4Integrator
+  kRK4Integrator,
+  kDormandPrinceIntegrator,
+  kExactIntegrator
 };
 
 class Integrator {
@@ -33,6 +42,18 @@ class Integrator {
       const morphac::constructs::ControlInput& control_input,
       const double dt) const = 0;
 
+  // In place variant of Step that writes the result into updated_state, which
+  // may be the same object as the given state. The morphac integrators use
+  // scratch buffers that are allocated on construction, so no memory is
+  // allocated as long as updated_state is already of the right dimensions.
+  // As the scratch buffers are shared across calls, an integrator must not be
+  // stepped from multiple threads at the same time.
+  // The default implementation delegates to the Step function above.
+  virtual void Step(const morphac::constructs::State& state,
+                    const morphac::constructs::ControlInput& control_input,
+                    const double dt,
+                    morphac::constructs::State& updated_state) const;
+
   // Function to integrate through a larger time step. In this case, we chain
   // together individual calls to Step so that don't lose too much accuracy.
   // We asume that the given state is the initial state and the same control
@@ -45,7 +66,53 @@ class Integrator {
       const morphac::constructs::ControlInput& control_input, const double time,
       const double dt) const;
 
+  // Jacobians of the discrete time dynamics given by Step,
+  // x_next = F(x, u, dt), with respect to the state (dF/dx) and the control
+  // input (dF/du). These are what linearization based controllers (LQR, iLQR,
+  // etc) require. The default implementation uses central finite differences
+  // through Step, while the morphac integrators override it to propagate the
+  // analytic Jacobians of the kinematic model through their stages (chain
+  // rule). The angle wrap around from the normalization is ignored.
+  virtual void ComputeJacobians(
+      const morphac::constructs::State& state,
+      const morphac::constructs::ControlInput& control_input, const double dt,
+      Eigen::MatrixXd& state_jacobian, Eigen::MatrixXd& control_jacobian) const;
+
+  // Convenience functions that only return one of the Jacobians. Prefer
+  // ComputeJacobians when both are required, as they share most of the
+  // computation.
+  Eigen::MatrixXd ComputeStateJacobian(
+      const morphac::constructs::State& state,
+      const morphac::constructs::ControlInput& control_input,
+      const double dt) const;
+  Eigen::MatrixXd ComputeControlJacobian(
+      const morphac::constructs::State& state,
+      const morphac::constructs::ControlInput& control_input,
+      const double dt) const;
+
+  const morphac::mechanics::models::KinematicModel& get_kinematic_model()
+      const;
+
  protected:
+  // Computes the Jacobians of a single explicit Runge-Kutta step with the
+  // given Butcher tableau (Strictly lower triangular stage coefficients a and
+  // weights b), x_next = x + dt * sum_i(b_i * k_i), where
+  // k_i = f(x + dt * sum_j(a_ij * k_j), u). If updated_state is given, the
+  // (unnormalized) x_next is written into it as well.
+  void ComputeRungeKuttaJacobians(
+      const morphac::constructs::State& state,
+      const morphac::constructs::ControlInput& control_input, const double dt,
+      const Eigen::MatrixXd& a, const Eigen::VectorXd& b,
+      Eigen::MatrixXd& state_jacobian, Eigen::MatrixXd& control_jacobian,
+      morphac::constructs::State* updated_state = nullptr) const;
+
+  // Computes updated_state = state + scale * derivative in place. The updated
+  // state may be the same object as either of the other states.
+  static void AddScaledDerivative(
+      const morphac::constructs::State& state, const double scale,
+      const morphac::constructs::State& derivative,
+      morphac::constructs::State& updated_state);
+
   morphac::mechanics::models::KinematicModel& kinematic_model_;
 };
 
@@ -17,6 +17,20 @@ class MidPointIntegrator : public morphac::math::numeric::Integrator {
       const morphac::constructs::State& state,
       const morphac::constructs::ControlInput& control_input,
       const double dt) const override;
+  void Step(const morphac::constructs::State& state,
+            const morphac::constructs::ControlInput& control_input,
+            const double dt,
+            morphac::constructs::State& updated_state) const override;
+
+  // Jacobians propagated through the two mid point stages.
+  void ComputeJacobians(const morphac::constructs::State& state,
+                        const morphac::constructs::ControlInput& control_input,
+                        const double dt, Eigen::MatrixXd& state_jacobian,
+                        Eigen::MatrixXd& control_jacobian) const override;
+
+ private:
+  // Scratch buffers used while stepping.
+  mutable morphac::constructs::State k1_, k2_, intermediate_state_;
 };
 
 }  // namespace numeric
@@ -16,6 +16,20 @@ class RK4Integrator : public morphac::math::numeric::Integrator {
       const morphac::constructs::State& state,
       const morphac::constructs::ControlInput& control_input,
       const double dt) const override;
+  void Step(const morphac::constructs::State& state,
+            const morphac::constructs::ControlInput& control_input,
+            const double dt,
+            morphac::constructs::State& updated_state) const override;
+
+  // Jacobians propagated through the four RK4 stages.
+  void ComputeJacobians(const morphac::constructs::State& state,
+                        const morphac::constructs::ControlInput& control_input,
+                        const double dt, Eigen::MatrixXd& state_jacobian,
+                        Eigen::MatrixXd& control_jacobian) const override;
+
+ private:
+  // Scratch buffers used while stepping.
+  mutable morphac::constructs::State k1_, k2_, k3_, k4_, intermediate_state_;
 };
 
 }  // namespace numeric
@@ -0,0 +1,81 @@
+import pytest
+
+from morphac.constructs import ControlInput, State
+from morphac.math.numeric import DormandPrinceIntegrator
+from morphac.mechanics.models import DiffdriveModel
+
+
+@pytest.fixture()
+def generate_integrator():
+
+    return DormandPrinceIntegrator(DiffdriveModel(0.1, 0.2))
+
+
+def test_step_computation(generate_integrator):
+
+    dormand_prince_integrator = generate_integrator
+
+    # We don't check the actual computation as the cpp test covers this. We
+    # only check if the function calls and returns properly.
+
+    # Test with positional arguments.
+    updated_state = dormand_prince_integrator.step(
+        robot_state=State([1, 2, 0], []), control_input=ControlInput([1, -1]), dt=0.1
+    )
+
+    assert updated_state.size == 3
+    assert updated_state.pose.size == 3
+    assert updated_state.is_velocity_empty()
+
+
+def test_integration(generate_integrator):
+
+    dormand_prince_integrator = generate_integrator
+
+    # We don't check the actual value, as the cpp test covers this. We only
+    # check if the adaptive integration calls and returns properly.
+
+    # Test with positional arguments.
+    updated_state = dormand_prince_integrator.integrate(
+        robot_state=State([1, 2, 0], []),
+        control_input=ControlInput([1, -1]),
+        time=10,
+        dt=0.01,
+    )
+
+    # Making sure that the output state dimensions and configuration is
+    # correct.
+    assert updated_state.size == 3
+    assert updated_state.pose.size == 3
+    assert updated_state.is_velocity_empty()
+
+
+def test_jacobian_computation(generate_integrator):
+
+    dormand_prince_integrator = generate_integrator
+
+    # The values are compared against finite differences on the cpp side.
+    state_jacobian = dormand_prince_integrator.compute_state_jacobian(
+        robot_state=State([1, 2, 0], []), control_input=ControlInput([1, -1]), dt=0.1
+    )
+    control_jacobian = dormand_prince_integrator.compute_control_jacobian(
+        State([1, 2, 0], []), ControlInput([1, -1]), 0.1
+    )
+
+    assert state_jacobian.shape == (3, 3)
+    assert control_jacobian.shape == (3, 2)
+
+
+def test_tolerances():
+
+    dormand_prince_integrator = DormandPrinceIntegrator(
+        DiffdriveModel(0.1, 0.2), absolute_tolerance=1e-3, relative_tolerance=1e-4
+    )
+
+    assert dormand_prince_integrator.absolute_tolerance == 1e-3
+    assert dormand_prince_integrator.relative_tolerance == 1e-4
+
+    with pytest.raises(ValueError):
+        DormandPrinceIntegrator(
+            DiffdriveModel(0.1, 0.2), absolute_tolerance=0, relative_tolerance=0
+        )
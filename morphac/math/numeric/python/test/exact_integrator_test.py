@@ -0,0 +1,113 @@
+import numpy as np
+import pytest
+
+from morphac.constructs import ControlInput, State
+from morphac.math.numeric import ExactIntegrator
+from morphac.mechanics.models import DiffdriveModel, KinematicModel
+from morphac.robot.blueprint import Footprint
+
+
+# Model with a closed form solution, implemented in python.
+class ConstantVelocityModel(KinematicModel):
+    def __init__(self, exact):
+
+        KinematicModel.__init__(self, 1, 0, 1)
+        self.exact = exact
+
+    def compute_state_derivative(self, robot_state, control_input):
+
+        return State(control_input.data, [])
+
+    def has_exact_step(self):
+
+        return self.exact
+
+    def exact_step(self, robot_state, control_input, dt):
+
+        return State(robot_state.data + dt * control_input.data, [])
+
+    def default_footprint(self):
+
+        return Footprint(np.ones([10, 2], dtype=np.float))
+
+
+@pytest.fixture()
+def generate_integrator():
+
+    return ExactIntegrator(DiffdriveModel(0.1, 0.2))
+
+
+def test_invalid_construction():
+
+    # The model must have an exact step.
+    with pytest.raises(ValueError):
+        _ = ExactIntegrator(ConstantVelocityModel(exact=False))
+
+
+def test_step_computation(generate_integrator):
+
+    exact_integrator = generate_integrator
+
+    # We don't check the actual computation as the cpp test covers this. We
+    # only check if the function calls and returns properly.
+
+    # Test with positional arguments.
+    updated_state = exact_integrator.step(
+        robot_state=State([1, 2, 0], []), control_input=ControlInput([1, -1]), dt=0.1
+    )
+
+    assert updated_state.size == 3
+    assert updated_state.pose.size == 3
+    assert updated_state.is_velocity_empty()
+
+
+def test_integration(generate_integrator):
+
+    exact_integrator = generate_integrator
+
+    # We don't check the actual value, as the cpp test covers this. We only
+    # check if the function calls and returns properly.
+
+    # Test with positional arguments.
+    updated_state = exact_integrator.integrate(
+        robot_state=State([1, 2, 0], []),
+        control_input=ControlInput([1, -1]),
+        time=10,
+        dt=0.01,
+    )
+
+    # Making sure that the output state dimensions and configuration is
+    # correct.
+    assert updated_state.size == 3
+    assert updated_state.pose.size == 3
+    assert updated_state.is_velocity_empty()
+
+
+def test_jacobian_computation(generate_integrator):
+
+    exact_integrator = generate_integrator
+
+    # The values are compared against finite differences on the cpp side.
+    state_jacobian = exact_integrator.compute_state_jacobian(
+        robot_state=State([1, 2, 0], []), control_input=ControlInput([1, -1]), dt=0.1
+    )
+    control_jacobian = exact_integrator.compute_control_jacobian(
+        State([1, 2, 0], []), ControlInput([1, -1]), 0.1
+    )
+
+    assert state_jacobian.shape == (3, 3)
+    assert control_jacobian.shape == (3, 2)
+
+
+def test_python_model():
+
+    # The exact step of a model implemented in python must be used.
+    exact_integrator = ExactIntegrator(ConstantVelocityModel(exact=True))
+
+    updated_state = exact_integrator.step(State([1], []), ControlInput([2]), 0.5)
+    assert np.allclose(updated_state.data, [2])
+
+    updated_state = exact_integrator.integrate(
+        State([1], []), ControlInput([2]), 10, 0.1
+    )
+    assert np.allclose(updated_state.data, [21])
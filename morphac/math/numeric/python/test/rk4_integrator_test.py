@@ -48,3 +48,19 @@ def test_integration(generate_integrator):
     assert updated_state.size == 3
     assert updated_state.pose.size == 3
     assert updated_state.is_velocity_empty()
+
+
+def test_jacobian_computation(generate_integrator):
+
+    rk4_integrator = generate_integrator
+
+    # The values are compared against finite differences on the cpp side.
+    state_jacobian = rk4_integrator.compute_state_jacobian(
+        robot_state=State([1, 2, 0], []), control_input=ControlInput([1, -1]), dt=0.1
+    )
+    control_jacobian = rk4_integrator.compute_control_jacobian(
+        State([1, 2, 0], []), ControlInput([1, -1]), 0.1
+    )
+
+    assert state_jacobian.shape == (3, 3)
+    assert control_jacobian.shape == (3, 2)
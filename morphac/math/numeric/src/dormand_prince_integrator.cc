@@ -0,0 +1,269 @@
+#include "math/numeric/include/dormand_prince_integrator.h"
+
+namespace morphac {
+namespace math {
+namespace numeric {
+
+using std::abs;
+using std::max;
+using std::min;
+using std::pow;
+using std::sqrt;
+using std::swap;
+using std::vector;
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+using morphac::constructs::ControlInput;
+using morphac::constructs::Lazy;
+using morphac::constructs::State;
+using morphac::math::numeric::Integrator;
+using morphac::mechanics::models::KinematicModel;
+
+// Dormand-Prince coefficients. As the control input is constant throughout
+// the step, the time coefficients (c) aren't required.
+constexpr double kA21 = 1. / 5.;
+constexpr double kA31 = 3. / 40., kA32 = 9. / 40.;
+constexpr double kA41 = 44. / 45., kA42 = -56. / 15., kA43 = 32. / 9.;
+constexpr double kA51 = 19372. / 6561., kA52 = -25360. / 2187.,
+                 kA53 = 64448. / 6561., kA54 = -212. / 729.;
+constexpr double kA61 = 9017. / 3168., kA62 = -355. / 33.,
+                 kA63 = 46732. / 5247., kA64 = 49. / 176.,
+                 kA65 = -5103. / 18656.;
+// Fifth order solution weights. The seventh stage is evaluated at the fifth
+// order solution itself and is reused as the first stage of the next step.
+constexpr double kB1 = 35. / 384., kB3 = 500. / 1113., kB4 = 125. / 192.,
+                 kB5 = -2187. / 6784., kB6 = 11. / 84.;
+// Difference between the fifth and fourth order solution weights.
+constexpr double kE1 = 71. / 57600., kE3 = -71. / 16695., kE4 = 71. / 1920.,
+                 kE5 = -17253. / 339200., kE6 = 22. / 525., kE7 = -1. / 40.;
+
+// Step size control parameters. The step size is scaled by
+// safety * error^(-1/5), bounded by the minimum and maximum factors.
+constexpr double kSafetyFactor = 0.9;
+constexpr double kMinimumStepFactor = 0.2;
+constexpr double kMaximumStepFactor = 5.;
+// Relative step size below which the integration is deemed to have failed.
+constexpr double kMinimumRelativeStepSize = 1e-12;
+
+DormandPrinceIntegrator::DormandPrinceIntegrator(
+    KinematicModel& kinematic_model, const double absolute_tolerance,
+    const double relative_tolerance)
+    : Integrator(kinematic_model),
+      absolute_tolerance_(absolute_tolerance),
+      relative_tolerance_(relative_tolerance),
+      k1_(kinematic_model.pose_size, kinematic_model.velocity_size),
+      k2_(kinematic_model.pose_size, kinematic_model.velocity_size),
+      k3_(kinematic_model.pose_size, kinematic_model.velocity_size),
+      k4_(kinematic_model.pose_size, kinematic_model.velocity_size),
+      k5_(kinematic_model.pose_size, kinematic_model.velocity_size),
+      k6_(kinematic_model.pose_size, kinematic_model.velocity_size),
+      k7_(kinematic_model.pose_size, kinematic_model.velocity_size),
+      current_state_(kinematic_model.pose_size, kinematic_model.velocity_size),
+      intermediate_state_(kinematic_model.pose_size,
+                          kinematic_model.velocity_size),
+      candidate_state_(kinematic_model.pose_size,
+                       kinematic_model.velocity_size) {
+  MORPH_REQUIRE(absolute_tolerance >= 0 && relative_tolerance >= 0,
+                std::invalid_argument, "Tolerances must be non-negative.");
+  MORPH_REQUIRE(absolute_tolerance > 0 || relative_tolerance > 0,
+                std::invalid_argument,
+                "At least one of the tolerances must be positive.");
+}
+
+double DormandPrinceIntegrator::get_absolute_tolerance() const {
+  return absolute_tolerance_;
+}
+
+double DormandPrinceIntegrator::get_relative_tolerance() const {
+  return relative_tolerance_;
+}
+
+State DormandPrinceIntegrator::Step(const State& state,
+                                    const ControlInput& control_input,
+                                    double dt) const {
+  State updated_state = State::CreateLike(state);
+  Step(state, control_input, dt, updated_state);
+  return updated_state;
+}
+
+void DormandPrinceIntegrator::Step(const State& state,
+                                   const ControlInput& control_input,
+                                   const double dt,
+                                   State& updated_state) const {
+  MORPH_HOT_REQUIRE(dt >= 0, std::invalid_argument, "dt must be non-negative.");
+  IntegrateAdaptively(state, control_input, dt, dt, updated_state);
+}
+
+State DormandPrinceIntegrator::Integrate(const State& state,
+                                         const ControlInput& control_input,
+                                         const double time,
+                                         const double dt) const {
+  MORPH_REQUIRE(time >= 0, std::invalid_argument,
+                "Integration time must be non-negative.");
+  MORPH_REQUIRE(dt > 0, std::invalid_argument, "dt must be positive.");
+  State updated_state = State::CreateLike(state);
+  IntegrateAdaptively(state, control_input, time, dt, updated_state);
+  return updated_state;
+}
+
+void DormandPrinceIntegrator::IntegrateAdaptively(
+    const State& state, const ControlInput& control_input, const double time,
+    const double initial_dt, State& updated_state,
+    vector<double>* accepted_dts) const {
+  current_state_ = state;
+  double elapsed_time = 0.;
+  double dt = min(initial_dt, time);
+
+  if (time > 0.) {
+    kinematic_model_.ComputeStateDerivative(current_state_, control_input,
+                                            k1_);
+  }
+
+  while (elapsed_time < time) {
+    // Making sure that the last step doesn't overshoot the time.
+    const bool is_last_step = dt >= time - elapsed_time;
+    if (is_last_step) {
+      dt = time - elapsed_time;
+    }
+    MORPH_REQUIRE(dt > kMinimumRelativeStepSize * time, std::runtime_error,
+                  "Step size became too small to satisfy the tolerances.");
+
+    // The intermediate stages. Each stage is evaluated in a single loop over
+    // the state (See construct_expression.h).
+    intermediate_state_ = Lazy(current_state_) + (dt * kA21) * Lazy(k1_);
+    kinematic_model_.ComputeStateDerivative(intermediate_state_,
+                                            control_input, k2_);
+
+    intermediate_state_ =
+        Lazy(current_state_) + dt * (kA31 * Lazy(k1_) + kA32 * Lazy(k2_));
+    kinematic_model_.ComputeStateDerivative(intermediate_state_,
+                                            control_input, k3_);
+
+    intermediate_state_ =
+        Lazy(current_state_) +
+        dt * (kA41 * Lazy(k1_) + kA42 * Lazy(k2_) + kA43 * Lazy(k3_));
+    kinematic_model_.ComputeStateDerivative(intermediate_state_,
+                                            control_input, k4_);
+
+    intermediate_state_ =
+        Lazy(current_state_) +
+        dt * (kA51 * Lazy(k1_) + kA52 * Lazy(k2_) + kA53 * Lazy(k3_) +
+              kA54 * Lazy(k4_));
+    kinematic_model_.ComputeStateDerivative(intermediate_state_,
+                                            control_input, k5_);
+
+    intermediate_state_ =
+        Lazy(current_state_) +
+        dt * (kA61 * Lazy(k1_) + kA62 * Lazy(k2_) + kA63 * Lazy(k3_) +
+              kA64 * Lazy(k4_) + kA65 * Lazy(k5_));
+    kinematic_model_.ComputeStateDerivative(intermediate_state_,
+                                            control_input, k6_);
+
+    // Fifth order solution, which is normalized so that the angles don't
+    // wind up over long integrations.
+    candidate_state_ =
+        Lazy(current_state_) +
+        dt * (kB1 * Lazy(k1_) + kB3 * Lazy(k3_) + kB4 * Lazy(k4_) +
+              kB5 * Lazy(k5_) + kB6 * Lazy(k6_));
+    kinematic_model_.NormalizeState(candidate_state_, candidate_state_);
+    kinematic_model_.ComputeStateDerivative(candidate_state_, control_input,
+                                            k7_);
+
+    const double error = ComputeScaledError(dt);
+    const bool is_accepted = error <= 1.;
+
+    if (is_accepted) {
+      elapsed_time = is_last_step ? time : elapsed_time + dt;
+      if (accepted_dts != nullptr) {
+        accepted_dts->push_back(dt);
+      }
+      // The candidate state and the seventh stage are recomputed in the next
+      // step, so they are swapped (moved) in instead of being copied.
+      swap(current_state_, candidate_state_);
+      // First same as last. The derivative at the accepted solution is the
+      // first stage of the next step.
+      swap(k1_, k7_);
+    }
+
+    // Adapting the step size according to the error.
+    double step_factor = kMaximumStepFactor;
+    if (error > 0.) {
+      step_factor = min(kMaximumStepFactor,
+                        max(kMinimumStepFactor,
+                            kSafetyFactor * pow(error, -1. / 5.)));
+    }
+    if (!is_accepted) {
+      // The step size must never grow after a rejection.
+      step_factor = min(1., step_factor);
+    }
+    dt *= step_factor;
+  }
+
+  updated_state = current_state_;
+}
+
+void DormandPrinceIntegrator::ComputeJacobians(
+    const State& state, const ControlInput& control_input, const double dt,
+    MatrixXd& state_jacobian, MatrixXd& control_jacobian) const {
+  MORPH_REQUIRE(dt >= 0, std::invalid_argument, "dt must be non-negative.");
+
+  // Finding the sub-steps that Step takes.
+  vector<double> accepted_dts;
+  State updated_state = State::CreateLike(state);
+  IntegrateAdaptively(state, control_input, dt, dt, updated_state,
+                      &accepted_dts);
+
+  // Butcher tableau of the fifth order solution. The seventh stage doesn't
+  // contribute to it.
+  MatrixXd a = MatrixXd::Zero(6, 6);
+  a.row(1).head<1>() << kA21;
+  a.row(2).head<2>() << kA31, kA32;
+  a.row(3).head<3>() << kA41, kA42, kA43;
+  a.row(4).head<4>() << kA51, kA52, kA53, kA54;
+  a.row(5).head<5>() << kA61, kA62, kA63, kA64, kA65;
+  VectorXd b(6);
+  b << kB1, 0., kB3, kB4, kB5, kB6;
+
+  // Chaining the Jacobians of the sub-steps.
+  const int state_size = state.get_size();
+  state_jacobian = MatrixXd::Identity(state_size, state_size);
+  control_jacobian = MatrixXd::Zero(state_size, control_input.get_size());
+  MatrixXd step_state_jacobian, step_control_jacobian;
+  State current_state = state;
+  for (const double accepted_dt : accepted_dts) {
+    ComputeRungeKuttaJacobians(current_state, control_input, accepted_dt, a, b,
+                               step_state_jacobian, step_control_jacobian,
+                               &updated_state);
+    kinematic_model_.NormalizeState(updated_state, current_state);
+    control_jacobian =
+        step_state_jacobian * control_jacobian + step_control_jacobian;
+    state_jacobian = step_state_jacobian * state_jacobian;
+  }
+}
+
+double DormandPrinceIntegrator::ComputeScaledError(const double dt) const {
+  const int size = current_state_.get_size();
+  if (size == 0) {
+    return 0.;
+  }
+
+  double squared_error_sum = 0.;
+  for (int i = 0; i < size; ++i) {
+    const double error =
+        dt * (kE1 * k1_[i] + kE3 * k3_[i] + kE4 * k4_[i] + kE5 * k5_[i] +
+              kE6 * k6_[i] + kE7 * k7_[i]);
+    const double tolerance =
+        absolute_tolerance_ +
+        relative_tolerance_ *
+            max(abs(current_state_[i]), abs(candidate_state_[i]));
+    squared_error_sum += (error / tolerance) * (error / tolerance);
+  }
+
+  return sqrt(squared_error_sum / size);
+}
+
+}  // namespace numeric
+}  // namespace math
+}  // namespace morphac
@@ -4,23 +4,47 @@ namespace morphac {
 namespace math {
 namespace numeric {
 
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
 using morphac::constructs::ControlInput;
 using morphac::constructs::State;
 using morphac::math::numeric::Integrator;
 using morphac::mechanics::models::KinematicModel;
 
 EulerIntegrator::EulerIntegrator(KinematicModel& kinematic_model)
-    : Integrator(kinematic_model) {}
+    : Integrator(kinematic_model),
+      derivative_(kinematic_model.pose_size, kinematic_model.velocity_size) {}
 
 State EulerIntegrator::Step(const State& state,
                             const ControlInput& control_input,
                             double dt) const {
-  auto derivative =
-      kinematic_model_.ComputeStateDerivative(state, control_input);
+  State updated_state = State::CreateLike(state);
+  Step(state, control_input, dt, updated_state);
+  return updated_state;
+}
+
+void EulerIntegrator::Step(const State& state,
+                           const ControlInput& control_input, const double dt,
+                           State& updated_state) const {
+  kinematic_model_.ComputeStateDerivative(state, control_input, derivative_);
+
+  // Integrate and normalize. We normalize to make sure that the output state
+  // is good to use in simulations, etc directly.
+  AddScaledDerivative(state, dt, derivative_, updated_state);
+  kinematic_model_.NormalizeState(updated_state, updated_state);
+}
 
-  // Integrate, normalize and return. We normalize to make sure that the output
-  // state is good to use in simulations, etc directly.
-  return kinematic_model_.NormalizeState(state + (dt * derivative));
+void EulerIntegrator::ComputeJacobians(const State& state,
+                                       const ControlInput& control_input,
+                                       const double dt,
+                                       MatrixXd& state_jacobian,
+                                       MatrixXd& control_jacobian) const {
+  // Butcher tableau.
+  MatrixXd a = MatrixXd::Zero(1, 1);
+  VectorXd b = VectorXd::Ones(1);
+  ComputeRungeKuttaJacobians(state, control_input, dt, a, b, state_jacobian,
+                             control_jacobian);
 }
 
 }  // namespace numeric
@@ -0,0 +1,52 @@
+#include "math/numeric/include/exact_integrator.h"
+
+namespace morphac {
+namespace math {
+namespace numeric {
+
+using morphac::constructs::ControlInput;
+using morphac::constructs::State;
+using morphac::math::numeric::Integrator;
+using morphac::mechanics::models::KinematicModel;
+
+ExactIntegrator::ExactIntegrator(KinematicModel& kinematic_model)
+    : Integrator(kinematic_model) {
+  MORPH_REQUIRE(kinematic_model.HasExactStep(), std::invalid_argument,
+                "The kinematic model does not have an exact step.");
+}
+
+State ExactIntegrator::Step(const State& state,
+                            const ControlInput& control_input,
+                            double dt) const {
+  State updated_state = State::CreateLike(state);
+  Step(state, control_input, dt, updated_state);
+  return updated_state;
+}
+
+void ExactIntegrator::Step(const State& state,
+                           const ControlInput& control_input, const double dt,
+                           State& updated_state) const {
+  if (updated_state.get_pose_size() != state.get_pose_size() ||
+      updated_state.get_velocity_size() != state.get_velocity_size()) {
+    // Only allocates if the updated state isn't of the right dimensions.
+    updated_state = State::CreateLike(state);
+  }
+
+  // Step and normalize. We normalize to make sure that the output state is
+  // good to use in simulations, etc directly.
+  kinematic_model_.ExactStep(state, control_input, dt, updated_state);
+  kinematic_model_.NormalizeState(updated_state, updated_state);
+}
+
+State ExactIntegrator::Integrate(const State& state,
+                                 const ControlInput& control_input,
+                                 const double time, const double dt) const {
+  MORPH_REQUIRE(time >= 0, std::invalid_argument,
+                "Integration time must be non-negative.");
+  MORPH_REQUIRE(dt > 0, std::invalid_argument, "dt must be positive.");
+  return Step(state, control_input, time);
+}
+
+}  // namespace numeric
+}  // namespace math
+}  // namespace morphac
@@ -4,15 +4,29 @@ namespace morphac {
 namespace math {
 namespace numeric {
 
+using std::abs;
+using std::cbrt;
+using std::max;
 using std::min;
+using std::numeric_limits;
+using std::vector;
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
 
 using morphac::constructs::ControlInput;
+using morphac::constructs::Lazy;
 using morphac::constructs::State;
 using morphac::mechanics::models::KinematicModel;
 
 Integrator::Integrator(KinematicModel& kinematic_model)
     : kinematic_model_(kinematic_model) {}
 
+void Integrator::Step(const State& state, const ControlInput& control_input,
+                      const double dt, State& updated_state) const {
+  updated_state = Step(state, control_input, dt);
+}
+
 State Integrator::Integrate(const State& state,
                             const ControlInput& control_input,
                             const double time, const double dt) const {
@@ -22,13 +36,151 @@ State Integrator::Integrate(const State& state,
     // In case dt isn't a factor of time, we want to make sure that the last
     // step is integrated with the correct dt (Which will be lesser than dt).
     double step_time = min(dt, time - elapsed_time);
-    updated_state = Step(updated_state, control_input, step_time);
+    // Stepping in place, so that the state isn't copied every step.
+    Step(updated_state, control_input, step_time, updated_state);
     elapsed_time += step_time;
   }
 
   return updated_state;
 }
 
+void Integrator::ComputeJacobians(const State& state,
+                                  const ControlInput& control_input,
+                                  const double dt, MatrixXd& state_jacobian,
+                                  MatrixXd& control_jacobian) const {
+  // Central finite differences, with the step scaled by the magnitude of each
+  // element.
+  const double step_scale = cbrt(numeric_limits<double>::epsilon());
+  state_jacobian.resize(state.get_size(), state.get_size());
+  control_jacobian.resize(state.get_size(), control_input.get_size());
+
+  State perturbed_state = state;
+  State forward_state = State::CreateLike(state);
+  State backward_state = State::CreateLike(state);
+  // Normalizes the difference between the forward and backward states. As
+  // the difference is small, this takes care of any angle wrap around that
+  // the normalization of the stepped states introduces.
+  auto compute_difference = [&]() {
+    State difference = forward_state - backward_state;
+    kinematic_model_.NormalizeState(difference, difference);
+    return difference.get_data();
+  };
+
+  for (int i = 0; i < state.get_size(); ++i) {
+    const double h = step_scale * max(1., abs(state[i]));
+    perturbed_state[i] = state[i] + h;
+    Step(perturbed_state, control_input, dt, forward_state);
+    perturbed_state[i] = state[i] - h;
+    Step(perturbed_state, control_input, dt, backward_state);
+    perturbed_state[i] = state[i];
+
+    state_jacobian.col(i) = compute_difference() / (2 * h);
+  }
+
+  ControlInput perturbed_control_input = control_input;
+  for (int i = 0; i < control_input.get_size(); ++i) {
+    const double h = step_scale * max(1., abs(control_input[i]));
+    perturbed_control_input[i] = control_input[i] + h;
+    Step(state, perturbed_control_input, dt, forward_state);
+    perturbed_control_input[i] = control_input[i] - h;
+    Step(state, perturbed_control_input, dt, backward_state);
+    perturbed_control_input[i] = control_input[i];
+
+    control_jacobian.col(i) = compute_difference() / (2 * h);
+  }
+}
+
+MatrixXd Integrator::ComputeStateJacobian(const State& state,
+                                          const ControlInput& control_input,
+                                          const double dt) const {
+  MatrixXd state_jacobian, control_jacobian;
+  ComputeJacobians(state, control_input, dt, state_jacobian, control_jacobian);
+  return state_jacobian;
+}
+
+MatrixXd Integrator::ComputeControlJacobian(const State& state,
+                                            const ControlInput& control_input,
+                                            const double dt) const {
+  MatrixXd state_jacobian, control_jacobian;
+  ComputeJacobians(state, control_input, dt, state_jacobian, control_jacobian);
+  return control_jacobian;
+}
+
+const KinematicModel& Integrator::get_kinematic_model() const {
+  return kinematic_model_;
+}
+
+void Integrator::ComputeRungeKuttaJacobians(
+    const State& state, const ControlInput& control_input, const double dt,
+    const MatrixXd& a, const VectorXd& b, MatrixXd& state_jacobian,
+    MatrixXd& control_jacobian, State* updated_state) const {
+  const int num_stages = b.size();
+  const int state_size = state.get_size();
+  const int control_input_size = control_input.get_size();
+
+  // Stage derivatives k_i along with their Jacobians dk_i/dx and dk_i/du.
+  vector<State> k(num_stages, State::CreateLike(state));
+  vector<MatrixXd> k_state_jacobians(num_stages);
+  vector<MatrixXd> k_control_jacobians(num_stages);
+
+  State stage_state = State::CreateLike(state);
+  MatrixXd stage_state_jacobian(state_size, state_size);
+  MatrixXd stage_control_jacobian(state_size, control_input_size);
+  for (int i = 0; i < num_stages; ++i) {
+    // The stage state x_i = x + dt * sum_j(a_ij * k_j) and its Jacobians.
+    stage_state = state;
+    stage_state_jacobian.setIdentity();
+    stage_control_jacobian.setZero();
+    for (int j = 0; j < i; ++j) {
+      if (a(i, j) == 0.) {
+        continue;
+      }
+      AddScaledDerivative(stage_state, dt * a(i, j), k[j], stage_state);
+      stage_state_jacobian += dt * a(i, j) * k_state_jacobians[j];
+      stage_control_jacobian += dt * a(i, j) * k_control_jacobians[j];
+    }
+
+    // Chain rule through k_i = f(x_i, u).
+    kinematic_model_.ComputeStateDerivative(stage_state, control_input, k[i]);
+    const MatrixXd model_state_jacobian =
+        kinematic_model_.ComputeStateJacobian(stage_state, control_input);
+    k_state_jacobians[i] = model_state_jacobian * stage_state_jacobian;
+    k_control_jacobians[i] =
+        model_state_jacobian * stage_control_jacobian +
+        kinematic_model_.ComputeControlJacobian(stage_state, control_input);
+  }
+
+  state_jacobian = MatrixXd::Identity(state_size, state_size);
+  control_jacobian = MatrixXd::Zero(state_size, control_input_size);
+  if (updated_state != nullptr) {
+    *updated_state = state;
+  }
+  for (int i = 0; i < num_stages; ++i) {
+    if (b(i) == 0.) {
+      continue;
+    }
+    state_jacobian += dt * b(i) * k_state_jacobians[i];
+    control_jacobian += dt * b(i) * k_control_jacobians[i];
+    if (updated_state != nullptr) {
+      AddScaledDerivative(*updated_state, dt * b(i), k[i], *updated_state);
+    }
+  }
+}
+
+void Integrator::AddScaledDerivative(const State& state, const double scale,
+                                     const State& derivative,
+                                     State& updated_state) {
+  MORPH_HOT_REQUIRE(
+      state.get_pose_size() == derivative.get_pose_size() &&
+          state.get_velocity_size() == derivative.get_velocity_size(),
+      std::invalid_argument,
+      "State and derivative dimensions do not match.");
+  // The expression is evaluated coefficient wise without any temporaries, so
+  // the states are allowed to alias. The updated state is only resized (and
+  // allocated) if it isn't of the right dimensions.
+  updated_state = Lazy(state) + scale * Lazy(derivative);
+}
+
 }  // namespace numeric
 }  // namespace math
 }  // namespace morphac
@@ -4,24 +4,55 @@ namespace morphac {
 namespace math {
 namespace numeric {
 
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
 using morphac::constructs::ControlInput;
 using morphac::constructs::State;
 using morphac::math::numeric::Integrator;
 using morphac::mechanics::models::KinematicModel;
 
 MidPointIntegrator::MidPointIntegrator(KinematicModel& kinematic_model)
-    : Integrator(kinematic_model) {}
+    : Integrator(kinematic_model),
+      k1_(kinematic_model.pose_size, kinematic_model.velocity_size),
+      k2_(kinematic_model.pose_size, kinematic_model.velocity_size),
+      intermediate_state_(kinematic_model.pose_size,
+                          kinematic_model.velocity_size) {}
 
 State MidPointIntegrator::Step(const State& state,
                                const ControlInput& control_input,
                                double dt) const {
+  State updated_state = State::CreateLike(state);
+  Step(state, control_input, dt, updated_state);
+  return updated_state;
+}
+
+void MidPointIntegrator::Step(const State& state,
+                              const ControlInput& control_input,
+                              const double dt, State& updated_state) const {
   // The two slope values.
-  auto k1 = kinematic_model_.ComputeStateDerivative(state, control_input);
-  auto k2 = kinematic_model_.ComputeStateDerivative(state + (dt / 2.) * k1,
-                                                    control_input);
+  kinematic_model_.ComputeStateDerivative(state, control_input, k1_);
+  AddScaledDerivative(state, dt / 2., k1_, intermediate_state_);
+  kinematic_model_.ComputeStateDerivative(intermediate_state_, control_input,
+                                          k2_);
+
+  // Normalizing the updated state.
+  AddScaledDerivative(state, dt, k2_, updated_state);
+  kinematic_model_.NormalizeState(updated_state, updated_state);
+}
 
-  // Normalizing the state before returning the updated state.
-  return kinematic_model_.NormalizeState(state + (dt * k2));
+void MidPointIntegrator::ComputeJacobians(const State& state,
+                                          const ControlInput& control_input,
+                                          const double dt,
+                                          MatrixXd& state_jacobian,
+                                          MatrixXd& control_jacobian) const {
+  // Butcher tableau.
+  MatrixXd a = MatrixXd::Zero(2, 2);
+  a(1, 0) = 1. / 2.;
+  VectorXd b(2);
+  b << 0., 1.;
+  ComputeRungeKuttaJacobians(state, control_input, dt, a, b, state_jacobian,
+                             control_jacobian);
 }
 
 }  // namespace numeric
@@ -4,28 +4,67 @@ namespace morphac {
 namespace math {
 namespace numeric {
 
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
 using morphac::constructs::ControlInput;
+using morphac::constructs::Lazy;
 using morphac::constructs::State;
 using morphac::math::numeric::Integrator;
 using morphac::mechanics::models::KinematicModel;
 
 RK4Integrator::RK4Integrator(KinematicModel& kinematic_model)
-    : Integrator(kinematic_model) {}
+    : Integrator(kinematic_model),
+      k1_(kinematic_model.pose_size, kinematic_model.velocity_size),
+      k2_(kinematic_model.pose_size, kinematic_model.velocity_size),
+      k3_(kinematic_model.pose_size, kinematic_model.velocity_size),
+      k4_(kinematic_model.pose_size, kinematic_model.velocity_size),
+      intermediate_state_(kinematic_model.pose_size,
+                          kinematic_model.velocity_size) {}
 
 State RK4Integrator::Step(const State& state, const ControlInput& control_input,
                           double dt) const {
-  // The four slope values.
-  auto k1 = kinematic_model_.ComputeStateDerivative(state, control_input);
-  auto k2 = kinematic_model_.ComputeStateDerivative(state + (dt / 2.) * k1,
-                                                    control_input);
-  auto k3 = kinematic_model_.ComputeStateDerivative(state + (dt / 2.) * k2,
-                                                    control_input);
-  auto k4 =
-      kinematic_model_.ComputeStateDerivative(state + dt * k3, control_input);
-
-  // Normalizing the state before returning the updated state.
-  return kinematic_model_.NormalizeState(
-      state + ((1. / 6.) * dt * (k1 + 2 * k2 + 2 * k3 + k4)));
+  State updated_state = State::CreateLike(state);
+  Step(state, control_input, dt, updated_state);
+  return updated_state;
+}
+
+void RK4Integrator::Step(const State& state, const ControlInput& control_input,
+                         const double dt, State& updated_state) const {
+  // The four slope values. The intermediate states are evaluated in place.
+  kinematic_model_.ComputeStateDerivative(state, control_input, k1_);
+  intermediate_state_ = Lazy(state) + (dt / 2.) * Lazy(k1_);
+  kinematic_model_.ComputeStateDerivative(intermediate_state_, control_input,
+                                          k2_);
+  intermediate_state_ = Lazy(state) + (dt / 2.) * Lazy(k2_);
+  kinematic_model_.ComputeStateDerivative(intermediate_state_, control_input,
+                                          k3_);
+  intermediate_state_ = Lazy(state) + dt * Lazy(k3_);
+  kinematic_model_.ComputeStateDerivative(intermediate_state_, control_input,
+                                          k4_);
+
+  // The arithmetic is lazy, so the whole combination is evaluated in a single
+  // loop over the state, without any intermediate states.
+  updated_state = Lazy(state) + (dt / 6.) * (Lazy(k1_) + 2. * Lazy(k2_) +
+                                                 2. * Lazy(k3_) + Lazy(k4_));
+
+  // Normalizing the updated state.
+  kinematic_model_.NormalizeState(updated_state, updated_state);
+}
+
+void RK4Integrator::ComputeJacobians(const State& state,
+                                     const ControlInput& control_input,
+                                     const double dt, MatrixXd& state_jacobian,
+                                     MatrixXd& control_jacobian) const {
+  // Butcher tableau.
+  MatrixXd a = MatrixXd::Zero(4, 4);
+  a(1, 0) = 1. / 2.;
+  a(2, 1) = 1. / 2.;
+  a(3, 2) = 1.;
+  VectorXd b(4);
+  b << 1. / 6., 1. / 3., 1. / 3., 1. / 6.;
+  ComputeRungeKuttaJacobians(state, control_input, dt, a, b, state_jacobian,
+                             control_jacobian);
 }
 
 }  // namespace numeric
@@ -0,0 +1,50 @@
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+#include <atomic>
+#include <cstdlib>
+
+// Counts the heap allocations of the executable by interposing the C
+// allocation functions. Both operator new and Eigen allocate through them, so
+// this counts all the heap allocations. Note that the compiler may turn a
+// malloc followed by a memset into a calloc, so calloc and realloc are counted
+// as well.
+//
+// The allocation functions are defined here, so this header must only be
+// included in a single source file of an executable (The tests and
+// benchmarks that check for allocations). Counting relies on glibc exposing
+// the underlying allocator, and MORPHAC_COUNT_ALLOCATIONS is only defined if
+// the allocations are being counted.
+
+namespace {
+
+// Number of heap allocations made so far. It is atomic so that the compiler
+// can't assume that it is left unchanged by the calls that allocate.
+std::atomic<long> num_allocations(0);
+
+}  // namespace
+
+#if defined(__GLIBC__)
+#define MORPHAC_COUNT_ALLOCATIONS
+
+extern "C" void* __libc_malloc(std::size_t size);
+extern "C" void* __libc_calloc(std::size_t num, std::size_t size);
+extern "C" void* __libc_realloc(void* pointer, std::size_t size);
+
+extern "C" void* malloc(std::size_t size) noexcept {
+  num_allocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_malloc(size);
+}
+
+extern "C" void* calloc(std::size_t num, std::size_t size) noexcept {
+  num_allocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_calloc(num, size);
+}
+
+extern "C" void* realloc(void* pointer, std::size_t size) noexcept {
+  num_allocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_realloc(pointer, size);
+}
+#endif
+
+#endif
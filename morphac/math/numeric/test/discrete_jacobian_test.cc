@@ -0,0 +1,166 @@
+#include "Eigen/Dense"
+#include "gtest/gtest.h"
+
+#include "math/numeric/include/dormand_prince_integrator.h"
+#include "math/numeric/include/euler_integrator.h"
+#include "math/numeric/include/exact_integrator.h"
+#include "math/numeric/include/integrator.h"
+#include "math/numeric/include/mid_point_integrator.h"
+#include "math/numeric/include/rk4_integrator.h"
+#include "mechanics/models/include/ackermann_model.h"
+#include "mechanics/models/include/diffdrive_model.h"
+#include "mechanics/models/include/dubin_model.h"
+#include "mechanics/models/include/tricycle_model.h"
+
+namespace {
+
+using std::make_unique;
+using std::srand;
+using std::unique_ptr;
+using std::vector;
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+using morphac::constructs::ControlInput;
+using morphac::constructs::State;
+using morphac::math::numeric::DormandPrinceIntegrator;
+using morphac::math::numeric::EulerIntegrator;
+using morphac::math::numeric::ExactIntegrator;
+using morphac::math::numeric::Integrator;
+using morphac::math::numeric::MidPointIntegrator;
+using morphac::math::numeric::RK4Integrator;
+using morphac::mechanics::models::AckermannModel;
+using morphac::mechanics::models::DiffdriveModel;
+using morphac::mechanics::models::DubinModel;
+using morphac::mechanics::models::KinematicModel;
+using morphac::mechanics::models::TricycleModel;
+
+class DiscreteJacobianTest : public ::testing::Test {
+ protected:
+  DiscreteJacobianTest() {
+    // Set random seed for Eigen.
+    srand(7);
+    kinematic_models_.push_back(make_unique<DiffdriveModel>(0.5, 1.2));
+    kinematic_models_.push_back(make_unique<DubinModel>(1.5));
+    kinematic_models_.push_back(make_unique<AckermannModel>(1., 2.));
+    kinematic_models_.push_back(make_unique<TricycleModel>(1., 2.));
+  }
+
+  void SetUp() override {}
+
+  // All the integrators of the given model.
+  vector<unique_ptr<Integrator>> CreateIntegrators(
+      KinematicModel& kinematic_model) {
+    vector<unique_ptr<Integrator>> integrators;
+    integrators.push_back(make_unique<EulerIntegrator>(kinematic_model));
+    integrators.push_back(make_unique<MidPointIntegrator>(kinematic_model));
+    integrators.push_back(make_unique<RK4Integrator>(kinematic_model));
+    integrators.push_back(
+        make_unique<DormandPrinceIntegrator>(kinematic_model, 1e-8, 1e-8));
+    integrators.push_back(make_unique<ExactIntegrator>(kinematic_model));
+    return integrators;
+  }
+
+  vector<unique_ptr<KinematicModel>> kinematic_models_;
+};
+
+TEST_F(DiscreteJacobianTest, EulerJacobians) {
+  // The Euler Jacobians are I + dt * df/dx and dt * df/du.
+  DiffdriveModel diffdrive_model{0.5, 1.2};
+  EulerIntegrator euler_integrator{diffdrive_model};
+  State state({1., -2., 0.5}, {});
+  ControlInput control_input({1.2, -0.4});
+
+  MatrixXd state_jacobian, control_jacobian;
+  euler_integrator.ComputeJacobians(state, control_input, 0.1, state_jacobian,
+                                    control_jacobian);
+  ASSERT_TRUE(state_jacobian.isApprox(
+      MatrixXd::Identity(3, 3) +
+      0.1 * diffdrive_model.ComputeStateJacobian(state, control_input)));
+  ASSERT_TRUE(control_jacobian.isApprox(
+      0.1 * diffdrive_model.ComputeControlJacobian(state, control_input)));
+}
+
+TEST_F(DiscreteJacobianTest, FiniteDifferenceAgreement) {
+  // The Jacobians propagated through the stages must match the finite
+  // difference ones of the default implementation.
+  for (auto& kinematic_model : kinematic_models_) {
+    auto integrators = CreateIntegrators(*kinematic_model);
+    const int state_size =
+        kinematic_model->pose_size + kinematic_model->velocity_size;
+
+    for (int i = 0; i < 5; ++i) {
+      State state(VectorXd::Random(kinematic_model->pose_size),
+                  VectorXd::Random(kinematic_model->velocity_size));
+      ControlInput control_input(
+          VectorXd::Random(kinematic_model->control_input_size));
+
+      for (auto& integrator : integrators) {
+        for (const double dt : {0.01, 0.5}) {
+          MatrixXd state_jacobian, control_jacobian;
+          integrator->ComputeJacobians(state, control_input, dt,
+                                       state_jacobian, control_jacobian);
+          ASSERT_EQ(state_jacobian.rows(), state_size);
+          ASSERT_EQ(state_jacobian.cols(), state_size);
+          ASSERT_EQ(control_jacobian.rows(), state_size);
+          ASSERT_EQ(control_jacobian.cols(),
+                    kinematic_model->control_input_size);
+
+          MatrixXd numerical_state_jacobian, numerical_control_jacobian;
+          integrator->Integrator::ComputeJacobians(
+              state, control_input, dt, numerical_state_jacobian,
+              numerical_control_jacobian);
+          ASSERT_LT((state_jacobian - numerical_state_jacobian).norm(), 1e-6);
+          ASSERT_LT((control_jacobian - numerical_control_jacobian).norm(),
+                    1e-6);
+
+          // The convenience functions must match.
+          ASSERT_TRUE(integrator->ComputeStateJacobian(state, control_input, dt)
+                          .isApprox(state_jacobian));
+          ASSERT_TRUE(
+              integrator->ComputeControlJacobian(state, control_input, dt)
+                  .isApprox(control_jacobian));
+        }
+      }
+    }
+  }
+}
+
+TEST_F(DiscreteJacobianTest, AngleWrapAround) {
+  // Stepping across theta = pi wraps the angle around, which must not show up
+  // in the finite difference Jacobians.
+  DubinModel dubin_model{1.};
+  ExactIntegrator exact_integrator{dubin_model};
+  State state({0., 0., M_PI - 1e-7}, {});
+  ControlInput control_input({0.5});
+
+  MatrixXd state_jacobian, control_jacobian;
+  exact_integrator.ComputeJacobians(state, control_input, 0.1, state_jacobian,
+                                    control_jacobian);
+  ASSERT_NEAR(state_jacobian(2, 2), 1., 1e-6);
+  ASSERT_NEAR(control_jacobian(2, 0), 0.1, 1e-6);
+}
+
+TEST_F(DiscreteJacobianTest, InvalidComputation) {
+  DiffdriveModel diffdrive_model{0.5, 1.2};
+  MatrixXd state_jacobian, control_jacobian;
+
+  for (auto& integrator : CreateIntegrators(diffdrive_model)) {
+    ASSERT_THROW(integrator->ComputeJacobians(State(4, 0), ControlInput(2),
+                                              0.1, state_jacobian,
+                                              control_jacobian),
+                 std::invalid_argument);
+    ASSERT_THROW(integrator->ComputeJacobians(State(3, 0), ControlInput(3),
+                                              0.1, state_jacobian,
+                                              control_jacobian),
+                 std::invalid_argument);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,261 @@
+#include "Eigen/Dense"
+#include "gtest/gtest.h"
+
+#include "math/numeric/include/dormand_prince_integrator.h"
+#include "math/numeric/include/integrator.h"
+#include "math/numeric/include/rk4_integrator.h"
+#include "mechanics/models/include/ackermann_model.h"
+#include "mechanics/models/include/diffdrive_model.h"
+#include "utils/include/angle_utils.h"
+
+namespace {
+
+using std::abs;
+using std::cos;
+using std::make_unique;
+using std::sin;
+using std::srand;
+using std::tan;
+using std::unique_ptr;
+
+using Eigen::VectorXd;
+
+using morphac::constructs::ControlInput;
+using morphac::constructs::State;
+using morphac::math::numeric::DormandPrinceIntegrator;
+using morphac::math::numeric::RK4Integrator;
+using morphac::mechanics::models::AckermannModel;
+using morphac::mechanics::models::DiffdriveModel;
+using morphac::mechanics::models::KinematicModel;
+using morphac::robot::blueprint::Footprint;
+using morphac::utils::NormalizeAngle;
+
+// Model that counts the number of derivative evaluations of the model that it
+// wraps.
+class CountingModel : public KinematicModel {
+ public:
+  CountingModel(KinematicModel& kinematic_model)
+      : KinematicModel(kinematic_model.pose_size,
+                       kinematic_model.velocity_size,
+                       kinematic_model.control_input_size),
+        kinematic_model(kinematic_model) {}
+
+  State ComputeStateDerivative(
+      const State& state, const ControlInput& control_input) const override {
+    ++num_evaluations;
+    return kinematic_model.ComputeStateDerivative(state, control_input);
+  }
+
+  void ComputeStateDerivative(const State& state,
+                              const ControlInput& control_input,
+                              State& derivative) const override {
+    ++num_evaluations;
+    kinematic_model.ComputeStateDerivative(state, control_input, derivative);
+  }
+
+  State NormalizeState(const State& state) const override {
+    return kinematic_model.NormalizeState(state);
+  }
+
+  void NormalizeState(const State& state,
+                      State& normalized_state) const override {
+    kinematic_model.NormalizeState(state, normalized_state);
+  }
+
+  Footprint DefaultFootprint() const override {
+    return kinematic_model.DefaultFootprint();
+  }
+
+  KinematicModel& kinematic_model;
+  mutable int num_evaluations = 0;
+};
+
+class DormandPrinceIntegratorTest : public ::testing::Test {
+ protected:
+  DormandPrinceIntegratorTest() {
+    // Set random seed for Eigen.
+    srand(7);
+    diffdrive_model_ = make_unique<DiffdriveModel>(0.1, 0.2);
+    dormand_prince_integrator_ = make_unique<DormandPrinceIntegrator>(
+        *diffdrive_model_, 1e-10, 1e-10);
+  }
+
+  void SetUp() override {}
+
+  // Exact pose of the ackermann model for a constant steering angle.
+  State ComputeAckermannPose(const AckermannModel& ackermann_model,
+                             const State& state, const double speed,
+                             const double time) {
+    const double theta = state[2];
+    const double phi = state[3];
+    if (phi == 0.) {
+      return State({state[0] + speed * time * cos(theta),
+                    state[1] + speed * time * sin(theta), theta, phi},
+                   {});
+    }
+    const double radius = ackermann_model.length / tan(phi);
+    const double updated_theta = theta + speed * time / radius;
+    return State({state[0] + radius * (sin(updated_theta) - sin(theta)),
+                  state[1] - radius * (cos(updated_theta) - cos(theta)),
+                  NormalizeAngle(updated_theta), phi},
+                 {});
+  }
+
+  // Maximum absolute position and heading error.
+  double ComputeError(const State& state1, const State& state2) {
+    return std::max({abs(state1[0] - state2[0]), abs(state1[1] - state2[1]),
+                     abs(NormalizeAngle(state1[2] - state2[2]))});
+  }
+
+  unique_ptr<DiffdriveModel> diffdrive_model_;
+  unique_ptr<DormandPrinceIntegrator> dormand_prince_integrator_;
+};
+
+TEST_F(DormandPrinceIntegratorTest, Construction) {
+  DormandPrinceIntegrator integrator1{*diffdrive_model_};
+  DormandPrinceIntegrator integrator2{*diffdrive_model_, 1e-3, 0.};
+
+  ASSERT_EQ(integrator1.get_absolute_tolerance(), 1e-6);
+  ASSERT_EQ(integrator1.get_relative_tolerance(), 1e-6);
+  ASSERT_EQ(integrator2.get_absolute_tolerance(), 1e-3);
+  ASSERT_EQ(integrator2.get_relative_tolerance(), 0.);
+}
+
+TEST_F(DormandPrinceIntegratorTest, InvalidConstruction) {
+  ASSERT_THROW(DormandPrinceIntegrator(*diffdrive_model_, -1e-6, 1e-6),
+               std::invalid_argument);
+  ASSERT_THROW(DormandPrinceIntegrator(*diffdrive_model_, 1e-6, -1e-6),
+               std::invalid_argument);
+  ASSERT_THROW(DormandPrinceIntegrator(*diffdrive_model_, 0., 0.),
+               std::invalid_argument);
+}
+
+TEST_F(DormandPrinceIntegratorTest, TrivialStep) {
+  // Derivative is zero when the wheel velocities are zero.
+  auto updated_state1 = dormand_prince_integrator_->Step(
+      State({1, 1, 1}, {}), ControlInput({0, 0}), 0.5);
+
+  // Nothing changes when the time step is zero.
+  auto updated_state2 =
+      dormand_prince_integrator_->Step(State(3, 0), ControlInput({1, 1}), 0.);
+
+  ASSERT_TRUE(updated_state1.get_data().isApprox(VectorXd::Ones(3)));
+  ASSERT_TRUE(updated_state2.get_data().isApprox(VectorXd::Zero(3)));
+}
+
+TEST_F(DormandPrinceIntegratorTest, Step) {
+  // Linear velocity = 0.05, angular velocity = 0.
+  auto updated_state = dormand_prince_integrator_->Step(
+      State({1., 2., M_PI / 4}, {}), ControlInput({0.5, 0.5}), 0.1);
+  ASSERT_TRUE(updated_state == State({1 + 0.005 * cos(M_PI / 4),
+                                      2 + 0.005 * sin(M_PI / 4), M_PI / 4},
+                                     {}));
+
+  // Linear velocity = 0, angular velocity = 0.5.
+  updated_state = dormand_prince_integrator_->Step(
+      State({0, 0, 0}, {}), ControlInput({-0.5, 0.5}), 0.1);
+  ASSERT_TRUE(updated_state == State({0, 0, 0.05}, {}));
+
+  // Large steps are split up internally to meet the tolerance. Tracing a full
+  // circle in one step must get us back to the start.
+  updated_state = dormand_prince_integrator_->Step(
+      State({0, 0, M_PI / 2}, {}), ControlInput({1, 2}), (2 * M_PI) / 0.5);
+  ASSERT_TRUE(updated_state == State({0, 0, M_PI / 2}, {}));
+}
+
+TEST_F(DormandPrinceIntegratorTest, InvalidStep) {
+  ASSERT_THROW(
+      dormand_prince_integrator_->Step(State(3, 0), ControlInput(2), -0.1),
+      std::invalid_argument);
+  ASSERT_THROW(
+      dormand_prince_integrator_->Step(State(4, 0), ControlInput(2), 0.1),
+      std::invalid_argument);
+  ASSERT_THROW(dormand_prince_integrator_->Integrate(
+                   State(3, 0), ControlInput(2), -1., 0.1),
+               std::invalid_argument);
+  ASSERT_THROW(dormand_prince_integrator_->Integrate(
+                   State(3, 0), ControlInput(2), 1., 0.),
+               std::invalid_argument);
+}
+
+TEST_F(DormandPrinceIntegratorTest, Integrate) {
+  // Turn in place by 270 degrees to the right. As the output state is
+  // normalized, the final angle would be positive.
+  auto updated_state = dormand_prince_integrator_->Integrate(
+      State(3, 0), ControlInput({0.5, -0.5}), 3 * M_PI, 0.01);
+  ASSERT_TRUE(updated_state == State({0, 0, M_PI / 2}, {}));
+
+  // Running in circles for a few full rounds (See the RK4 integrator test).
+  updated_state = dormand_prince_integrator_->Integrate(
+      State(3, 0), ControlInput({10, 5}), (4 * M_PI + M_PI / 2) / 2.5, 0.01);
+  ASSERT_NEAR(updated_state[0], 0.3, 1e-8);
+  ASSERT_NEAR(updated_state[1], -0.3, 1e-8);
+  ASSERT_NEAR(updated_state[2], -M_PI / 2, 1e-8);
+}
+
+TEST_F(DormandPrinceIntegratorTest, TightAckermannTurn) {
+  AckermannModel ackermann_model{1., 2.};
+  DormandPrinceIntegrator integrator{ackermann_model, 1e-9, 1e-9};
+
+  // Tight turn with a constant steering angle.
+  State state({1., -1., 0.3, 1.2}, {});
+  State updated_state =
+      integrator.Integrate(state, ControlInput({2., 0.}), 25., 0.1);
+
+  ASSERT_LT(ComputeError(updated_state,
+                         ComputeAckermannPose(ackermann_model, state, 2., 25.)),
+            1e-6);
+}
+
+TEST_F(DormandPrinceIntegratorTest, FunctionEvaluations) {
+  // Comparing the number of function evaluations against RK4, for an
+  // ackermann robot that drives along a long straight line and then takes a
+  // tight turn.
+  AckermannModel ackermann_model{1., 2.};
+  CountingModel counting_model{ackermann_model};
+  DormandPrinceIntegrator dormand_prince_integrator{counting_model, 1e-8,
+                                                    1e-8};
+  RK4Integrator rk4_integrator{counting_model};
+
+  const double speed = 2.;
+  State initial_state({0., 0., 0.3, 0.}, {});
+  State turn_state = ComputeAckermannPose(ackermann_model, initial_state,
+                                          speed, 100.);
+  turn_state[3] = 1.2;
+  State final_state =
+      ComputeAckermannPose(ackermann_model, turn_state, speed, 10.);
+
+  auto integrate = [&](const auto& integrator, const double dt) {
+    State updated_state = integrator.Integrate(
+        initial_state, ControlInput({speed, 0.}), 100., dt);
+    updated_state[3] = 1.2;
+    updated_state = integrator.Integrate(updated_state,
+                                         ControlInput({speed, 0.}), 10., dt);
+    return ComputeError(updated_state, final_state);
+  };
+
+  counting_model.num_evaluations = 0;
+  const double dormand_prince_error = integrate(dormand_prince_integrator, 0.1);
+  const int dormand_prince_evaluations = counting_model.num_evaluations;
+
+  // Finding the largest RK4 dt that is at least as accurate.
+  double rk4_dt = 0.1;
+  counting_model.num_evaluations = 0;
+  while (integrate(rk4_integrator, rk4_dt) > dormand_prince_error) {
+    rk4_dt /= 2.;
+    counting_model.num_evaluations = 0;
+  }
+  const int rk4_evaluations = counting_model.num_evaluations;
+
+  ASSERT_LT(dormand_prince_error, 1e-6);
+  // The straight line is integrated in a handful of large steps, so the
+  // adaptive integrator must need a lot fewer evaluations.
+  ASSERT_LT(5 * dormand_prince_evaluations, rk4_evaluations);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
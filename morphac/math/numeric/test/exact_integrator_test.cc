@@ -0,0 +1,194 @@
+#include "Eigen/Dense"
+#include "gtest/gtest.h"
+
+#include "math/numeric/include/exact_integrator.h"
+#include "math/numeric/include/integrator.h"
+#include "math/numeric/include/rk4_integrator.h"
+#include "mechanics/models/include/ackermann_model.h"
+#include "mechanics/models/include/diffdrive_model.h"
+#include "mechanics/models/include/dubin_model.h"
+#include "mechanics/models/include/tricycle_model.h"
+#include "utils/include/angle_utils.h"
+
+namespace {
+
+using std::abs;
+using std::cos;
+using std::make_unique;
+using std::max;
+using std::sin;
+using std::srand;
+using std::unique_ptr;
+
+using morphac::constructs::ControlInput;
+using morphac::constructs::State;
+using morphac::math::numeric::ExactIntegrator;
+using morphac::math::numeric::RK4Integrator;
+using morphac::mechanics::models::AckermannModel;
+using morphac::mechanics::models::DiffdriveModel;
+using morphac::mechanics::models::DubinModel;
+using morphac::mechanics::models::KinematicModel;
+using morphac::mechanics::models::TricycleModel;
+using morphac::robot::blueprint::Footprint;
+using morphac::utils::NormalizeAngle;
+
+// Model without an exact step.
+class NumericalModel : public KinematicModel {
+ public:
+  NumericalModel() : KinematicModel(1, 0, 1) {}
+
+  State ComputeStateDerivative(
+      const State& state, const ControlInput& control_input) const override {
+    State derivative = State::CreateLike(state);
+    derivative[0] = control_input[0];
+    return derivative;
+  }
+
+  Footprint DefaultFootprint() const override {
+    return Footprint::CreateCircularFootprint(1., 0.1);
+  }
+};
+
+class ExactIntegratorTest : public ::testing::Test {
+ protected:
+  ExactIntegratorTest() {
+    // Set random seed for Eigen.
+    srand(7);
+    diffdrive_model_ = make_unique<DiffdriveModel>(0.1, 0.2);
+    exact_integrator_ = make_unique<ExactIntegrator>(*diffdrive_model_);
+  }
+
+  void SetUp() override {}
+
+  // Maximum absolute difference between the states, with the angles
+  // compared on the circle.
+  double ComputeError(const State& state1, const State& state2) {
+    double error = 0.;
+    for (int i = 0; i < state1.get_size(); ++i) {
+      error = max(error, abs(NormalizeAngle(state1[i] - state2[i])));
+    }
+    return error;
+  }
+
+  unique_ptr<DiffdriveModel> diffdrive_model_;
+  unique_ptr<ExactIntegrator> exact_integrator_;
+};
+
+TEST_F(ExactIntegratorTest, Construction) {
+  NumericalModel numerical_model;
+
+  ASSERT_NO_THROW(ExactIntegrator{*diffdrive_model_});
+  ASSERT_THROW(ExactIntegrator{numerical_model}, std::invalid_argument);
+}
+
+TEST_F(ExactIntegratorTest, Step) {
+  // Linear velocity = 0.05, angular velocity = 0.
+  auto updated_state = exact_integrator_->Step(State({1., 2., M_PI / 4}, {}),
+                                               ControlInput({0.5, 0.5}), 0.1);
+  ASSERT_TRUE(updated_state == State({1 + 0.005 * cos(M_PI / 4),
+                                      2 + 0.005 * sin(M_PI / 4), M_PI / 4},
+                                     {}));
+
+  // Turning in place by 270 degrees to the right in a single step. The output
+  // state is normalized.
+  updated_state = exact_integrator_->Step(
+      State(3, 0), ControlInput({0.5, -0.5}), 3 * M_PI);
+  ASSERT_TRUE(updated_state == State({0, 0, M_PI / 2}, {}));
+
+  // The in place variant resizes the updated state if required.
+  State state({0, 0, M_PI / 2}, {});
+  State in_place_state(2, 2);
+  exact_integrator_->Step(state, ControlInput({1, 2}), (2 * M_PI) / 0.5,
+                          in_place_state);
+  ASSERT_TRUE(in_place_state == State({0, 0, M_PI / 2}, {}));
+  exact_integrator_->Step(state, ControlInput({1, 2}), (2 * M_PI) / 0.5,
+                          state);
+  ASSERT_TRUE(state == State({0, 0, M_PI / 2}, {}));
+}
+
+TEST_F(ExactIntegratorTest, Integrate) {
+  // Running in circles for a few full rounds (See the RK4 integrator test).
+  // The result is exact, irrespective of dt.
+  for (const double dt : {1e-2, 1., 100.}) {
+    auto updated_state = exact_integrator_->Integrate(
+        State(3, 0), ControlInput({10, 5}), (4 * M_PI + M_PI / 2) / 2.5, dt);
+    ASSERT_NEAR(updated_state[0], 0.3, 1e-12);
+    ASSERT_NEAR(updated_state[1], -0.3, 1e-12);
+    ASSERT_NEAR(updated_state[2], -M_PI / 2, 1e-12);
+  }
+
+  ASSERT_THROW(
+      exact_integrator_->Integrate(State(3, 0), ControlInput(2), -1., 0.1),
+      std::invalid_argument);
+  ASSERT_THROW(
+      exact_integrator_->Integrate(State(3, 0), ControlInput(2), 1., 0.),
+      std::invalid_argument);
+}
+
+TEST_F(ExactIntegratorTest, NumericalAgreement) {
+  // The exact steps must agree with a fine numerical integration.
+  DiffdriveModel diffdrive_model{0.5, 1.2};
+  DubinModel dubin_model{1.5};
+  AckermannModel ackermann_model{1., 2.};
+  TricycleModel tricycle_model{1., 2.};
+
+  struct TestCase {
+    KinematicModel& kinematic_model;
+    State state;
+    ControlInput control_input;
+  };
+  std::vector<TestCase> test_cases = {
+      {diffdrive_model, State({1., -2., 0.5}, {}), ControlInput({1.2, -0.4})},
+      {dubin_model, State({1., -2., 0.5}, {}), ControlInput({-0.7})},
+      {ackermann_model, State({1., -2., 0.5, 0.3}, {}), ControlInput({2., 0.})},
+      // Steering at a constant rate.
+      {ackermann_model, State({1., -2., 0.5, -0.6}, {}),
+       ControlInput({2., 0.3})},
+      {tricycle_model, State({1., -2., 0.5, 0.3}, {}), ControlInput({2., 0.})},
+      {tricycle_model, State({1., -2., 0.5, -0.6}, {}),
+       ControlInput({2., 0.5})},
+  };
+
+  for (const auto& test_case : test_cases) {
+    ExactIntegrator exact_integrator{test_case.kinematic_model};
+    RK4Integrator rk4_integrator{test_case.kinematic_model};
+
+    State exact_state = exact_integrator.Integrate(
+        test_case.state, test_case.control_input, 3., 1.);
+    State rk4_state = rk4_integrator.Integrate(
+        test_case.state, test_case.control_input, 3., 1e-3);
+    ASSERT_LT(ComputeError(exact_state, rk4_state), 1e-10);
+  }
+}
+
+TEST_F(ExactIntegratorTest, LargeSteps) {
+  // Stepping with a large dt, like a simulation would. The exact integrator
+  // doesn't drift while RK4 does.
+  AckermannModel ackermann_model{1., 2.};
+  ExactIntegrator exact_integrator{ackermann_model};
+  RK4Integrator rk4_integrator{ackermann_model};
+
+  const State initial_state({0., 0., 0., 0.8}, {});
+  const ControlInput control_input({3., 0.});
+  const double dt = 1.;
+  const int num_steps = 100;
+
+  State exact_state = initial_state;
+  State rk4_state = initial_state;
+  for (int i = 0; i < num_steps; ++i) {
+    exact_integrator.Step(exact_state, control_input, dt, exact_state);
+    rk4_integrator.Step(rk4_state, control_input, dt, rk4_state);
+  }
+  State expected_state =
+      exact_integrator.Step(initial_state, control_input, num_steps * dt);
+
+  ASSERT_LT(ComputeError(exact_state, expected_state), 1e-9);
+  ASSERT_GT(ComputeError(rk4_state, expected_state), 1e-3);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
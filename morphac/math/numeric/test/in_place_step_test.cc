@@ -0,0 +1,112 @@
+#include <cstdlib>
+
+#include "Eigen/Dense"
+#include "gtest/gtest.h"
+
+#include "math/numeric/include/euler_integrator.h"
+#include "math/numeric/include/integrator.h"
+#include "math/numeric/include/mid_point_integrator.h"
+#include "math/numeric/include/rk4_integrator.h"
+#include "math/numeric/test/allocation_counter.h"
+#include "mechanics/models/include/diffdrive_model.h"
+
+namespace {
+
+using std::make_unique;
+using std::srand;
+using std::unique_ptr;
+using std::vector;
+
+using morphac::constructs::ControlInput;
+using morphac::constructs::State;
+using morphac::math::numeric::EulerIntegrator;
+using morphac::math::numeric::Integrator;
+using morphac::math::numeric::MidPointIntegrator;
+using morphac::math::numeric::RK4Integrator;
+using morphac::mechanics::models::DiffdriveModel;
+
+class InPlaceStepTest : public ::testing::Test {
+ protected:
+  InPlaceStepTest() {
+    // Set random seed for Eigen.
+    srand(7);
+    diffdrive_model_ = make_unique<DiffdriveModel>(0.1, 0.2);
+    integrators_.push_back(make_unique<EulerIntegrator>(*diffdrive_model_));
+    integrators_.push_back(make_unique<MidPointIntegrator>(*diffdrive_model_));
+    integrators_.push_back(make_unique<RK4Integrator>(*diffdrive_model_));
+  }
+
+  void SetUp() override {}
+
+  unique_ptr<DiffdriveModel> diffdrive_model_;
+  vector<unique_ptr<Integrator>> integrators_;
+};
+
+TEST_F(InPlaceStepTest, Step) {
+  State state({1., -2., 3.}, {});
+  ControlInput control_input({2.5, -1.});
+
+  for (auto& integrator : integrators_) {
+    State expected_state = integrator->Step(state, control_input, 0.1);
+
+    State updated_state(3, 0);
+    integrator->Step(state, control_input, 0.1, updated_state);
+    ASSERT_TRUE(updated_state == expected_state);
+
+    // The updated state may be the state being stepped.
+    updated_state = state;
+    integrator->Step(updated_state, control_input, 0.1, updated_state);
+    ASSERT_TRUE(updated_state == expected_state);
+
+    // Updated states of the wrong dimensions are resized.
+    State resized_state(2, 1);
+    integrator->Step(state, control_input, 0.1, resized_state);
+    ASSERT_TRUE(resized_state == expected_state);
+  }
+}
+
+TEST_F(InPlaceStepTest, InvalidStep) {
+  State updated_state(3, 0);
+
+  for (auto& integrator : integrators_) {
+    ASSERT_THROW(
+        integrator->Step(State(2, 0), ControlInput(2), 0.1, updated_state),
+        std::invalid_argument);
+    ASSERT_THROW(
+        integrator->Step(State(3, 0), ControlInput(3), 0.1, updated_state),
+        std::invalid_argument);
+  }
+}
+
+TEST_F(InPlaceStepTest, ZeroAllocations) {
+#if defined(MORPHAC_COUNT_ALLOCATIONS)
+  State state({1., -2., 3.}, {});
+  ControlInput control_input({2.5, -1.});
+  State updated_state(3, 0);
+
+  // Making sure that the allocations are being counted, as the allocating
+  // Step creates a new state.
+  long initial_num_allocations = num_allocations;
+  updated_state = integrators_[0]->Step(state, control_input, 0.01);
+  ASSERT_GT(num_allocations - initial_num_allocations, 0);
+
+  for (auto& integrator : integrators_) {
+    initial_num_allocations = num_allocations;
+    for (int i = 0; i < 100; ++i) {
+      integrator->Step(state, control_input, 0.01, updated_state);
+      integrator->Step(updated_state, control_input, 0.01, updated_state);
+    }
+
+    ASSERT_EQ(num_allocations - initial_num_allocations, 0);
+  }
+#else
+  GTEST_SKIP() << "Allocations can only be counted with glibc.";
+#endif
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
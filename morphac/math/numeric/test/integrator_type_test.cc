@@ -9,14 +9,20 @@ TEST(IntegratorTypeTest, Equality) {
   IntegratorType euler_type{IntegratorType::kEulerIntegrator};
   IntegratorType mid_point_type{IntegratorType::kMidPointIntegrator};
   IntegratorType rk4_type{IntegratorType::kRK4Integrator};
+  IntegratorType dormand_prince_type{IntegratorType::kDormandPrinceIntegrator};
+  IntegratorType exact_type{IntegratorType::kExactIntegrator};
 
   ASSERT_TRUE(euler_type == IntegratorType::kEulerIntegrator);
   ASSERT_TRUE(mid_point_type == IntegratorType::kMidPointIntegrator);
   ASSERT_TRUE(rk4_type == IntegratorType::kRK4Integrator);
+  ASSERT_TRUE(dormand_prince_type == IntegratorType::kDormandPrinceIntegrator);
+  ASSERT_TRUE(exact_type == IntegratorType::kExactIntegrator);
 
   ASSERT_TRUE(euler_type != IntegratorType::kMidPointIntegrator);
   ASSERT_TRUE(mid_point_type != IntegratorType::kRK4Integrator);
   ASSERT_TRUE(rk4_type != IntegratorType::kEulerIntegrator);
+  ASSERT_TRUE(dormand_prince_type != IntegratorType::kRK4Integrator);
+  ASSERT_TRUE(exact_type != IntegratorType::kDormandPrinceIntegrator);
 }
 
 }  // namespace
@@ -0,0 +1,71 @@
+#include <vector>
+
+#include "Eigen/Dense"
+#include "benchmark/benchmark.h"
+
+#include "math/transforms/include/transforms.h"
+
+namespace {
+
+using std::vector;
+
+using morphac::common::aliases::Pixels;
+using morphac::common::aliases::Point;
+using morphac::common::aliases::Points;
+using morphac::math::transforms::CanvasToWorld;
+using morphac::math::transforms::TransformPoints;
+using morphac::math::transforms::WorldToCanvas;
+
+constexpr double kResolution = 0.05;
+
+// Canvas that contains all the (random) points.
+const vector<int> kCanvasSize = {100, 100};
+
+// Points within the canvas, as many as given by the benchmark argument.
+Points CreatePoints(const benchmark::State& benchmark_state) {
+  return 2.5 * (Points::Random(benchmark_state.range(0), 2).array() + 1.)
+                   .matrix();
+}
+
+void BM_TransformPoints(benchmark::State& benchmark_state) {
+  const Points points = CreatePoints(benchmark_state);
+  const Point translation(1., -2.);
+
+  for (auto _ : benchmark_state) {
+    Points transformed_points = TransformPoints(points, 0.3, translation);
+    benchmark::DoNotOptimize(transformed_points);
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() *
+                                    points.rows());
+}
+
+void BM_WorldToCanvas(benchmark::State& benchmark_state) {
+  const Points points = CreatePoints(benchmark_state);
+
+  for (auto _ : benchmark_state) {
+    Pixels pixels = WorldToCanvas(points, kResolution, kCanvasSize);
+    benchmark::DoNotOptimize(pixels);
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() *
+                                    points.rows());
+}
+
+void BM_CanvasToWorld(benchmark::State& benchmark_state) {
+  const Pixels pixels =
+      WorldToCanvas(CreatePoints(benchmark_state), kResolution, kCanvasSize);
+
+  for (auto _ : benchmark_state) {
+    Points points = CanvasToWorld(pixels, kResolution, kCanvasSize);
+    benchmark::DoNotOptimize(points);
+  }
+  benchmark_state.SetItemsProcessed(benchmark_state.iterations() *
+                                    pixels.rows());
+}
+
+BENCHMARK(BM_TransformPoints)->RangeMultiplier(10)->Range(10, 1000000);
+BENCHMARK(BM_WorldToCanvas)->RangeMultiplier(10)->Range(10, 1000000);
+BENCHMARK(BM_CanvasToWorld)->RangeMultiplier(10)->Range(10, 1000000);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -34,10 +34,17 @@ void define_transforms_binding(py::module& m) {
         py::arg("angle"), py::arg("translation"));
 
   // Cpp overloads.
-  m.def("canvas_to_world",
-        py::overload_cast<const Pixel&, const double, const vector<int>&>(
-            &CanvasToWorld),
-        py::arg("canvas_coord"), py::arg("resolution"), py::arg("canvas_size"));
+  // The single point transforms only validate the resolution on their hot
+  // paths, so it is validated here for everything coming in from python.
+  m.def(
+      "canvas_to_world",
+      [](const Pixel& canvas_coord, const double resolution,
+         const vector<int>& canvas_size) {
+        MORPH_REQUIRE(resolution > 0, std::invalid_argument,
+                      "Resolution must be positive.");
+        return CanvasToWorld(canvas_coord, resolution, canvas_size);
+      },
+      py::arg("canvas_coord"), py::arg("resolution"), py::arg("canvas_size"));
   m.def("canvas_to_world",
         py::overload_cast<const Pixels&, const double, const vector<int>&>(
             &CanvasToWorld),
@@ -48,10 +55,15 @@ void define_transforms_binding(py::module& m) {
         py::arg("scalar"), py::arg("resolution"));
 
   // Cpp overloads + default value overloads for python.
-  m.def("world_to_canvas",
-        py::overload_cast<const Point&, const double, const vector<int>&>(
-            &WorldToCanvas),
-        py::arg("world_coord"), py::arg("resolution"), py::arg("canvas_size"));
+  m.def(
+      "world_to_canvas",
+      [](const Point& world_coord, const double resolution,
+         const vector<int>& canvas_size) {
+        MORPH_REQUIRE(resolution > 0, std::invalid_argument,
+                      "Resolution must be positive.");
+        return WorldToCanvas(world_coord, resolution, canvas_size);
+      },
+      py::arg("world_coord"), py::arg("resolution"), py::arg("canvas_size"));
   m.def("world_to_canvas",
         py::overload_cast<const Points&, const double, const vector<int>&>(
             &WorldToCanvas),
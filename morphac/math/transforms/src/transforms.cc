@@ -65,8 +65,8 @@ Points TransformPoints(const Points& points, const double angle,
 
 Point CanvasToWorld(const Pixel& canvas_coord, const double resolution,
                     const vector<int>& canvas_size) {
-  MORPH_REQUIRE(resolution > 0, std::invalid_argument,
-                "Resolution must be positive.");
+  MORPH_HOT_REQUIRE(resolution > 0, std::invalid_argument,
+                    "Resolution must be positive.");
   // The x and y coordinates need to be interchanged (Due to how matrices are
   // indexed).
   // The y coordinate needs to be inverted.
@@ -98,8 +98,8 @@ double CanvasToWorld(const int scalar, const double resolution) {
 
 Pixel WorldToCanvas(const Point& world_coord, const double resolution,
                     const vector<int>& canvas_size) {
-  MORPH_REQUIRE(resolution > 0, std::invalid_argument,
-                "Resolution must be positive.");
+  MORPH_HOT_REQUIRE(resolution > 0, std::invalid_argument,
+                    "Resolution must be positive.");
   Pixel canvas_coord = Pixel::Zero();
   // Pixel canvas_coord =
   //    ((1 / resolution) * world_coord).array().round().matrix().cast<int>();
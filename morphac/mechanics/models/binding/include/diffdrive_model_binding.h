@@ -1,8 +1,10 @@
 #ifndef DIFFDRIVE_MODEL_BINDING_H
 #define DIFFDRIVE_MODEL_BINDING_H
 
+#include "mechanics/models/binding/include/kinematic_model_binding.h"
 #include "mechanics/models/include/diffdrive_model.h"
 #include "mechanics/models/include/kinematic_model.h"
+#include "pybind11/eigen.h"
 #include "pybind11/pybind11.h"
 
 namespace morphac {
@@ -1,8 +1,10 @@
 #ifndef DUBIN_MODEL_BINDING_H
 #define DUBIN_MODEL_BINDING_H
 
+#include "mechanics/models/binding/include/kinematic_model_binding.h"
 #include "mechanics/models/include/dubin_model.h"
 #include "mechanics/models/include/kinematic_model.h"
+#include "pybind11/eigen.h"
 #include "pybind11/pybind11.h"
 
 namespace morphac {
@@ -1,9 +1,11 @@
 #ifndef KINEMATIC_MODEL_BINDING_H
 #define KINEMATIC_MODEL_BINDING_H
 
+#include "common/error_handling/include/error_macros.h"
 #include "constructs/include/control_input.h"
 #include "constructs/include/state.h"
 #include "mechanics/models/include/kinematic_model.h"
+#include "pybind11/eigen.h"
 #include "pybind11/pybind11.h"
 
 namespace morphac {
@@ -16,12 +18,46 @@ class PyKinematicModel : public morphac::mechanics::models::KinematicModel {
  public:
   using KinematicModel::KinematicModel;
 
+  // The states computed in python are validated here, as the integrators
+  // only validate them on their hot paths.
   morphac::constructs::State ComputeStateDerivative(
       const morphac::constructs::State& state,
       const morphac::constructs::ControlInput& control_input) const override {
-    PYBIND11_OVERLOAD_PURE_NAME(morphac::constructs::State, KinematicModel,
-                                "compute_state_derivative",
-                                ComputeStateDerivative, state, control_input);
+    morphac::constructs::State derivative =
+        ComputePythonStateDerivative(state, control_input);
+    RequireStateDimensions(derivative);
+    return derivative;
+  }
+
+  Eigen::MatrixXd ComputeStateJacobian(
+      const morphac::constructs::State& state,
+      const morphac::constructs::ControlInput& control_input) const override {
+    PYBIND11_OVERLOAD_NAME(Eigen::MatrixXd, KinematicModel,
+                           "compute_state_jacobian", ComputeStateJacobian,
+                           state, control_input);
+  }
+
+  Eigen::MatrixXd ComputeControlJacobian(
+      const morphac::constructs::State& state,
+      const morphac::constructs::ControlInput& control_input) const override {
+    PYBIND11_OVERLOAD_NAME(Eigen::MatrixXd, KinematicModel,
+                           "compute_control_jacobian", ComputeControlJacobian,
+                           state, control_input);
+  }
+
+  bool HasExactStep() const override {
+    PYBIND11_OVERLOAD_NAME(bool, KinematicModel, "has_exact_step",
+                           HasExactStep);
+  }
+
+  morphac::constructs::State ExactStep(
+      const morphac::constructs::State& state,
+      const morphac::constructs::ControlInput& control_input,
+      const double dt) const override {
+    morphac::constructs::State updated_state =
+        ComputePythonExactStep(state, control_input, dt);
+    RequireStateDimensions(updated_state);
+    return updated_state;
   }
 
   morphac::robot::blueprint::Footprint DefaultFootprint() const override {
@@ -29,8 +65,65 @@ class PyKinematicModel : public morphac::mechanics::models::KinematicModel {
                                 KinematicModel, "default_footprint",
                                 DefaultFootprint);
   }
+
+ private:
+  morphac::constructs::State ComputePythonStateDerivative(
+      const morphac::constructs::State& state,
+      const morphac::constructs::ControlInput& control_input) const {
+    PYBIND11_OVERLOAD_PURE_NAME(morphac::constructs::State, KinematicModel,
+                                "compute_state_derivative",
+                                ComputeStateDerivative, state, control_input);
+  }
+
+  morphac::constructs::State ComputePythonExactStep(
+      const morphac::constructs::State& state,
+      const morphac::constructs::ControlInput& control_input,
+      const double dt) const {
+    PYBIND11_OVERLOAD_NAME(morphac::constructs::State, KinematicModel,
+                           "exact_step", ExactStep, state, control_input, dt);
+  }
+
+  void RequireStateDimensions(const morphac::constructs::State& state) const {
+    MORPH_REQUIRE(state.get_pose_size() == pose_size &&
+                      state.get_velocity_size() == velocity_size,
+                  std::invalid_argument,
+                  "Dimensions of the state computed in python do not match "
+                  "the dimensions of the model.");
+  }
 };
 
+// The kinematic models only validate the dimensions of the states and control
+// inputs on their hot paths, which are not checked below the full check
+// level. As everything coming in from python is an API boundary, the model
+// bindings go through these functions, which validate the arguments before
+// calling into the (virtual) model functions.
+void RequireStateDimensions(
+    const morphac::mechanics::models::KinematicModel& kinematic_model,
+    const morphac::constructs::State& state);
+void RequireDimensions(
+    const morphac::mechanics::models::KinematicModel& kinematic_model,
+    const morphac::constructs::State& state,
+    const morphac::constructs::ControlInput& control_input);
+morphac::constructs::State ComputeStateDerivative(
+    const morphac::mechanics::models::KinematicModel& kinematic_model,
+    const morphac::constructs::State& state,
+    const morphac::constructs::ControlInput& control_input);
+Eigen::MatrixXd ComputeStateJacobian(
+    const morphac::mechanics::models::KinematicModel& kinematic_model,
+    const morphac::constructs::State& state,
+    const morphac::constructs::ControlInput& control_input);
+Eigen::MatrixXd ComputeControlJacobian(
+    const morphac::mechanics::models::KinematicModel& kinematic_model,
+    const morphac::constructs::State& state,
+    const morphac::constructs::ControlInput& control_input);
+morphac::constructs::State NormalizeState(
+    const morphac::mechanics::models::KinematicModel& kinematic_model,
+    const morphac::constructs::State& state);
+morphac::constructs::State ExactStep(
+    const morphac::mechanics::models::KinematicModel& kinematic_model,
+    const morphac::constructs::State& state,
+    const morphac::constructs::ControlInput& control_input, const double dt);
+
 void define_kinematic_model_binding(pybind11::module& m);
 
 }  // namespace binding
@@ -2,7 +2,9 @@
 #define TRICYCLE_MODEL_BINDING_H
 
 #include "mechanics/models/include/kinematic_model.h"
+#include "mechanics/models/binding/include/kinematic_model_binding.h"
 #include "mechanics/models/include/tricycle_model.h"
+#include "pybind11/eigen.h"
 #include "pybind11/pybind11.h"
 
 namespace morphac {
@@ -3,6 +3,7 @@
 #include "mechanics/models/binding/include/dubin_model_binding.h"
 #include "mechanics/models/binding/include/kinematic_model_binding.h"
 #include "mechanics/models/binding/include/tricycle_model_binding.h"
+#include "pybind11/eigen.h"
 #include "pybind11/pybind11.h"
 
 namespace morphac {
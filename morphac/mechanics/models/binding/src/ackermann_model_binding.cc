@@ -7,22 +7,81 @@ namespace binding {
 
 namespace py = pybind11;
 
+using Eigen::MatrixXd;
+
+using morphac::constructs::ControlInput;
+using morphac::constructs::State;
 using morphac::mechanics::models::AckermannModel;
 using morphac::mechanics::models::KinematicModel;
 
+namespace {
+
+// The model only validates the steering angle on its hot paths.
+void RequireSteeringAngle(const State& state) {
+  MORPH_REQUIRE(
+      (state[3] > -M_PI / 2) && (state[3] < M_PI / 2), std::invalid_argument,
+      "Invalid steering angle. It must lie between -pi / 2 and pi / 2.");
+}
+
+}  // namespace
+
 void define_ackermann_model_binding(py::module& m) {
   py::class_<AckermannModel, KinematicModel> ackermann_model(m,
                                                              "AckermannModel");
   ackermann_model.def(py::init<const double, const double>(), py::arg("width"),
                       py::arg("length"));
-  ackermann_model.def("compute_state_derivative",
-                      &AckermannModel::ComputeStateDerivative,
-                      py::arg("robot_state"), py::arg("control_input"));
-  ackermann_model.def("normalized_state", &AckermannModel::NormalizeState,
+  ackermann_model.def(
+      "compute_state_derivative",
+      [](const AckermannModel& ackermann_model, const State& state,
+         const ControlInput& control_input) {
+        RequireDimensions(ackermann_model, state, control_input);
+        RequireSteeringAngle(state);
+        return ackermann_model.ComputeStateDerivative(state, control_input);
+      },
+      py::arg("robot_state"), py::arg("control_input"));
+  ackermann_model.def(
+      "compute_state_jacobian",
+      [](const AckermannModel& ackermann_model, const State& state,
+         const ControlInput& control_input) {
+        RequireDimensions(ackermann_model, state, control_input);
+        RequireSteeringAngle(state);
+        return ackermann_model.ComputeStateJacobian(state, control_input);
+      },
+      py::arg("robot_state"), py::arg("control_input"));
+  ackermann_model.def(
+      "compute_control_jacobian",
+      [](const AckermannModel& ackermann_model, const State& state,
+         const ControlInput& control_input) {
+        RequireDimensions(ackermann_model, state, control_input);
+        RequireSteeringAngle(state);
+        return ackermann_model.ComputeControlJacobian(state, control_input);
+      },
+      py::arg("robot_state"), py::arg("control_input"));
+  ackermann_model.def(
+      "compute_state_derivative_batch",
+      py::overload_cast<const MatrixXd&, const MatrixXd&>(
+          &AckermannModel::ComputeStateDerivativeBatch, py::const_),
+      py::arg("robot_states"), py::arg("control_inputs"));
+  ackermann_model.def("normalized_state", &NormalizeState,
                       py::arg("robot_state"));
   ackermann_model.def("compute_steering_angles",
                       &AckermannModel::ComputeSteeringAngles,
                       py::arg("ideal_steering_angle"));
+  ackermann_model.def("has_exact_step", &AckermannModel::HasExactStep);
+  ackermann_model.def(
+      "exact_step",
+      [](const AckermannModel& ackermann_model, const State& state,
+         const ControlInput& control_input, const double dt) {
+        RequireDimensions(ackermann_model, state, control_input);
+        RequireSteeringAngle(state);
+        const double updated_phi = state[3] + control_input[1] * dt;
+        MORPH_REQUIRE((updated_phi > -M_PI / 2) && (updated_phi < M_PI / 2),
+                      std::invalid_argument,
+                      "Invalid steering angle at the end of the step. It must "
+                      "lie between -pi / 2 and pi / 2.");
+        return ackermann_model.ExactStep(state, control_input, dt);
+      },
+      py::arg("robot_state"), py::arg("control_input"), py::arg("dt"));
   ackermann_model.def("default_footprint", &AckermannModel::DefaultFootprint);
   ackermann_model.def_readonly("width", &AckermannModel::width);
   ackermann_model.def_readonly("length", &AckermannModel::length);
@@ -7,6 +7,8 @@ namespace binding {
 
 namespace py = pybind11;
 
+using Eigen::MatrixXd;
+
 using morphac::mechanics::models::DiffdriveModel;
 using morphac::mechanics::models::KinematicModel;
 
@@ -16,11 +18,22 @@ void define_diffdrive_model_binding(py::module& m) {
 
   diffdrive_model.def(py::init<const double, const double>(), py::arg("radius"),
                       py::arg("width"));
-  diffdrive_model.def("compute_state_derivative",
-                      &DiffdriveModel::ComputeStateDerivative,
+  diffdrive_model.def("compute_state_derivative", &ComputeStateDerivative,
+                      py::arg("robot_state"), py::arg("control_input"));
+  diffdrive_model.def("compute_state_jacobian", &ComputeStateJacobian,
+                      py::arg("robot_state"), py::arg("control_input"));
+  diffdrive_model.def("compute_control_jacobian", &ComputeControlJacobian,
                       py::arg("robot_state"), py::arg("control_input"));
-  diffdrive_model.def("normalize_state", &DiffdriveModel::NormalizeState,
+  diffdrive_model.def(
+      "compute_state_derivative_batch",
+      py::overload_cast<const MatrixXd&, const MatrixXd&>(
+          &DiffdriveModel::ComputeStateDerivativeBatch, py::const_),
+      py::arg("robot_states"), py::arg("control_inputs"));
+  diffdrive_model.def("normalize_state", &NormalizeState,
                       py::arg("robot_state"));
+  diffdrive_model.def("has_exact_step", &DiffdriveModel::HasExactStep);
+  diffdrive_model.def("exact_step", &ExactStep, py::arg("robot_state"),
+                      py::arg("control_input"), py::arg("dt"));
   diffdrive_model.def("default_footprint", &DiffdriveModel::DefaultFootprint);
   diffdrive_model.def_readonly("radius", &DiffdriveModel::radius);
   diffdrive_model.def_readonly("width", &DiffdriveModel::width);
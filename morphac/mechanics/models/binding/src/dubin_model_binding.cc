@@ -7,6 +7,8 @@ namespace binding {
 
 namespace py = pybind11;
 
+using Eigen::MatrixXd;
+
 using morphac::mechanics::models::DubinModel;
 using morphac::mechanics::models::KinematicModel;
 
@@ -14,11 +16,21 @@ void define_dubin_model_binding(py::module& m) {
   py::class_<DubinModel, KinematicModel> dubin_model(m, "DubinModel");
 
   dubin_model.def(py::init<const double>(), py::arg("speed"));
-  dubin_model.def("compute_state_derivative",
-                  &DubinModel::ComputeStateDerivative, py::arg("robot_state"),
-                  py::arg("control_input"));
-  dubin_model.def("normalize_state", &DubinModel::NormalizeState,
-                  py::arg("robot_state"));
+  dubin_model.def("compute_state_derivative", &ComputeStateDerivative,
+                  py::arg("robot_state"), py::arg("control_input"));
+  dubin_model.def("compute_state_jacobian", &ComputeStateJacobian,
+                  py::arg("robot_state"), py::arg("control_input"));
+  dubin_model.def("compute_control_jacobian", &ComputeControlJacobian,
+                  py::arg("robot_state"), py::arg("control_input"));
+  dubin_model.def(
+      "compute_state_derivative_batch",
+      py::overload_cast<const MatrixXd&, const MatrixXd&>(
+          &DubinModel::ComputeStateDerivativeBatch, py::const_),
+      py::arg("robot_states"), py::arg("control_inputs"));
+  dubin_model.def("normalize_state", &NormalizeState, py::arg("robot_state"));
+  dubin_model.def("has_exact_step", &DubinModel::HasExactStep);
+  dubin_model.def("exact_step", &ExactStep, py::arg("robot_state"),
+                  py::arg("control_input"), py::arg("dt"));
   dubin_model.def("default_footprint", &DubinModel::DefaultFootprint);
   dubin_model.def_readonly("speed", &DubinModel::speed);
   dubin_model.def_readonly("pose_size", &KinematicModel::pose_size);
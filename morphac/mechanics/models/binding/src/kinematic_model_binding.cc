@@ -7,8 +7,61 @@ namespace binding {
 
 namespace py = pybind11;
 
+using Eigen::MatrixXd;
+
+using morphac::constructs::ControlInput;
+using morphac::constructs::State;
 using morphac::mechanics::models::KinematicModel;
 
+void RequireStateDimensions(const KinematicModel& kinematic_model,
+                            const State& state) {
+  MORPH_REQUIRE(state.get_pose_size() == kinematic_model.pose_size &&
+                    state.get_velocity_size() == kinematic_model.velocity_size,
+                std::invalid_argument,
+                "State dimensions do not match the dimensions of the model.");
+}
+
+void RequireDimensions(const KinematicModel& kinematic_model,
+                       const State& state, const ControlInput& control_input) {
+  RequireStateDimensions(kinematic_model, state);
+  MORPH_REQUIRE(control_input.get_size() == kinematic_model.control_input_size,
+                std::invalid_argument,
+                "Control input must be of size control_input_size.");
+}
+
+State ComputeStateDerivative(const KinematicModel& kinematic_model,
+                             const State& state,
+                             const ControlInput& control_input) {
+  RequireDimensions(kinematic_model, state, control_input);
+  return kinematic_model.ComputeStateDerivative(state, control_input);
+}
+
+MatrixXd ComputeStateJacobian(const KinematicModel& kinematic_model,
+                              const State& state,
+                              const ControlInput& control_input) {
+  RequireDimensions(kinematic_model, state, control_input);
+  return kinematic_model.ComputeStateJacobian(state, control_input);
+}
+
+MatrixXd ComputeControlJacobian(const KinematicModel& kinematic_model,
+                                const State& state,
+                                const ControlInput& control_input) {
+  RequireDimensions(kinematic_model, state, control_input);
+  return kinematic_model.ComputeControlJacobian(state, control_input);
+}
+
+State NormalizeState(const KinematicModel& kinematic_model,
+                     const State& state) {
+  RequireStateDimensions(kinematic_model, state);
+  return kinematic_model.NormalizeState(state);
+}
+
+State ExactStep(const KinematicModel& kinematic_model, const State& state,
+                const ControlInput& control_input, const double dt) {
+  RequireDimensions(kinematic_model, state, control_input);
+  return kinematic_model.ExactStep(state, control_input, dt);
+}
+
 void define_kinematic_model_binding(py::module& m) {
   py::class_<KinematicModel, PyKinematicModel> kinematic_model(
       m, "KinematicModel");
@@ -16,11 +69,22 @@ void define_kinematic_model_binding(py::module& m) {
   kinematic_model.def(py::init<const int, const int, const int>(),
                       py::arg("size_pose"), py::arg("size_velocity"),
                       py::arg("size_control_input"));
-  kinematic_model.def("compute_state_derivative",
-                      &KinematicModel::ComputeStateDerivative,
+  kinematic_model.def("compute_state_derivative", &ComputeStateDerivative,
+                      py::arg("robot_state"), py::arg("control_input"));
+  kinematic_model.def("compute_state_jacobian", &ComputeStateJacobian,
+                      py::arg("robot_state"), py::arg("control_input"));
+  kinematic_model.def("compute_control_jacobian", &ComputeControlJacobian,
                       py::arg("robot_state"), py::arg("control_input"));
-  kinematic_model.def("normalize_state", &KinematicModel::NormalizeState,
+  kinematic_model.def(
+      "compute_state_derivative_batch",
+      py::overload_cast<const MatrixXd&, const MatrixXd&>(
+          &KinematicModel::ComputeStateDerivativeBatch, py::const_),
+      py::arg("robot_states"), py::arg("control_inputs"));
+  kinematic_model.def("normalize_state", &NormalizeState,
                       py::arg("robot_state"));
+  kinematic_model.def("has_exact_step", &KinematicModel::HasExactStep);
+  kinematic_model.def("exact_step", &ExactStep, py::arg("robot_state"),
+                      py::arg("control_input"), py::arg("dt"));
   kinematic_model.def("default_footprint", &KinematicModel::DefaultFootprint);
   kinematic_model.def_readonly("pose_size", &KinematicModel::pose_size);
   kinematic_model.def_readonly("velocity_size", &KinematicModel::velocity_size);
@@ -7,6 +7,8 @@ namespace binding {
 
 namespace py = pybind11;
 
+using Eigen::MatrixXd;
+
 using morphac::mechanics::models::KinematicModel;
 using morphac::mechanics::models::TricycleModel;
 
@@ -15,11 +17,22 @@ void define_tricycle_model_binding(py::module& m) {
 
   tricycle_model.def(py::init<const double, const double>(), py::arg("width"),
                      py::arg("length"));
-  tricycle_model.def("compute_state_derivative",
-                     &TricycleModel::ComputeStateDerivative,
+  tricycle_model.def("compute_state_derivative", &ComputeStateDerivative,
+                     py::arg("robot_state"), py::arg("control_input"));
+  tricycle_model.def("compute_state_jacobian", &ComputeStateJacobian,
+                     py::arg("robot_state"), py::arg("control_input"));
+  tricycle_model.def("compute_control_jacobian", &ComputeControlJacobian,
                      py::arg("robot_state"), py::arg("control_input"));
-  tricycle_model.def("normalize_state", &TricycleModel::NormalizeState,
+  tricycle_model.def(
+      "compute_state_derivative_batch",
+      py::overload_cast<const MatrixXd&, const MatrixXd&>(
+          &TricycleModel::ComputeStateDerivativeBatch, py::const_),
+      py::arg("robot_states"), py::arg("control_inputs"));
+  tricycle_model.def("normalize_state", &NormalizeState,
                      py::arg("robot_state"));
+  tricycle_model.def("has_exact_step", &TricycleModel::HasExactStep);
+  tricycle_model.def("exact_step", &ExactStep, py::arg("robot_state"),
+                     py::arg("control_input"), py::arg("dt"));
   tricycle_model.def("default_footprint", &TricycleModel::DefaultFootprint);
   tricycle_model.def_readonly("width", &TricycleModel::width);
   tricycle_model.def_readonly("length", &TricycleModel::length);
@@ -12,6 +12,13 @@ namespace models {
 
 class DiffdriveModel : public morphac::mechanics::models::KinematicModel {
  public:
+  // Fixed size state and control input types of the model.
+  using StateType = morphac::constructs::StateN<3, 0>;
+  using ControlInputType = morphac::constructs::ControlInputN<2>;
+  // Fixed size Jacobian types of the model.
+  using StateJacobianType = Eigen::Matrix<double, 3, 3>;
+  using ControlJacobianType = Eigen::Matrix<double, 3, 2>;
+
   DiffdriveModel(const double radius, const double width);
 
   morphac::constructs::State ComputeStateDerivative(
@@ -21,6 +28,51 @@ class DiffdriveModel : public morphac::mechanics::models::KinematicModel {
   morphac::constructs::State NormalizeState(
       const morphac::constructs::State& state) const override;
 
+  void ComputeStateDerivative(
+      const morphac::constructs::State& state,
+      const morphac::constructs::ControlInput& control_input,
+      morphac::constructs::State& derivative) const override;
+  void NormalizeState(
+      const morphac::constructs::State& state,
+      morphac::constructs::State& normalized_state) const override;
+
+  Eigen::MatrixXd ComputeStateJacobian(
+      const morphac::constructs::State& state,
+      const morphac::constructs::ControlInput& control_input) const override;
+  Eigen::MatrixXd ComputeControlJacobian(
+      const morphac::constructs::State& state,
+      const morphac::constructs::ControlInput& control_input) const override;
+
+  Eigen::MatrixXd ComputeStateDerivativeBatch(
+      const Eigen::MatrixXd& states,
+      const Eigen::MatrixXd& control_inputs) const override;
+  void ComputeStateDerivativeBatch(const Eigen::MatrixXd& states,
+                                   const Eigen::MatrixXd& control_inputs,
+                                   Eigen::MatrixXd& derivatives) const override;
+
+  bool HasExactStep() const override;
+  morphac::constructs::State ExactStep(
+      const morphac::constructs::State& state,
+      const morphac::constructs::ControlInput& control_input,
+      const double dt) const override;
+  void ExactStep(const morphac::constructs::State& state,
+                 const morphac::constructs::ControlInput& control_input,
+                 const double dt,
+                 morphac::constructs::State& updated_state) const override;
+
+  // Fixed size overloads that don't allocate any memory. The dynamic
+  // functions convert their arguments and delegate to these.
+  StateType ComputeStateDerivative(
+      const StateType& state, const ControlInputType& control_input) const;
+  StateType NormalizeState(const StateType& state) const;
+  StateJacobianType ComputeStateJacobian(
+      const StateType& state, const ControlInputType& control_input) const;
+  ControlJacobianType ComputeControlJacobian(
+      const StateType& state, const ControlInputType& control_input) const;
+  StateType ExactStep(const StateType& state,
+                      const ControlInputType& control_input,
+                      const double dt) const;
+
   morphac::robot::blueprint::Footprint DefaultFootprint() const override;
 
   const double radius;
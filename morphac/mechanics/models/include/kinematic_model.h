@@ -1,10 +1,17 @@
 #ifndef KINEMATIC_MODEL_H
 #define KINEMATIC_MODEL_H
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include "Eigen/Dense"
+#include "common/error_handling/include/error_macros.h"
 #include "constants/include/mechanics_constants.h"
 #include "constructs/include/control_input.h"
+#include "constructs/include/control_input_n.h"
 #include "constructs/include/state.h"
+#include "constructs/include/state_n.h"
 #include "robot/blueprint/include/footprint.h"
 
 namespace morphac {
@@ -31,14 +38,141 @@ class KinematicModel {
   virtual morphac::constructs::State NormalizeState(
       const morphac::constructs::State& state) const;
 
+  // In place variants of the above functions that write the result into an
+  // existing state of the correct dimensions. The normalized state may be the
+  // same object as the state being normalized. The default implementations
+  // delegate to the functions above, while the models override them to avoid
+  // any memory allocations (These are what the integrators use).
+  virtual void ComputeStateDerivative(
+      const morphac::constructs::State& state,
+      const morphac::constructs::ControlInput& control_input,
+      morphac::constructs::State& derivative) const;
+  virtual void NormalizeState(
+      const morphac::constructs::State& state,
+      morphac::constructs::State& normalized_state) const;
+
+  // Jacobians of the state derivative f(x, u) with respect to the state
+  // (df/dx, of size state size x state size) and the control input (df/du, of
+  // size state size x control input size). The default implementations use
+  // central finite differences through ComputeStateDerivative, while the
+  // models override them with closed form expressions.
+  virtual Eigen::MatrixXd ComputeStateJacobian(
+      const morphac::constructs::State& state,
+      const morphac::constructs::ControlInput& control_input) const;
+  virtual Eigen::MatrixXd ComputeControlJacobian(
+      const morphac::constructs::State& state,
+      const morphac::constructs::ControlInput& control_input) const;
+
+  // Batched variant of ComputeStateDerivative for N states at once. Each row
+  // of states is the data of a state ([pose, velocity]) and each row of
+  // control_inputs is the data of the corresponding control input. Returns
+  // the N x (pose_size + velocity_size) matrix of derivatives, one per row.
+  // The models compute each derivative component as a column wise array
+  // operation, so the sin, cos, etc over contiguous columns are vectorized.
+  virtual Eigen::MatrixXd ComputeStateDerivativeBatch(
+      const Eigen::MatrixXd& states,
+      const Eigen::MatrixXd& control_inputs) const;
+
+  // In place variant of ComputeStateDerivativeBatch that writes into
+  // derivatives (resizing it if required). derivatives must not be the same
+  // object as states. The default implementation computes the derivatives one
+  // state at a time through ComputeStateDerivative.
+  virtual void ComputeStateDerivativeBatch(
+      const Eigen::MatrixXd& states, const Eigen::MatrixXd& control_inputs,
+      Eigen::MatrixXd& derivatives) const;
+
+  // Whether the model has a closed form solution for its state after a time
+  // step, under a constant control input. Models that do, override this and
+  // the ExactStep functions. Defaults to false.
+  virtual bool HasExactStep() const;
+
+  // Function to compute the state after a time dt, assuming that the control
+  // input is constant throughout. Unlike numerical integration, the result
+  // doesn't drift irrespective of how large dt is. The returned state isn't
+  // normalized. The default implementation throws as the model doesn't have
+  // an exact step unless HasExactStep is overriden.
+  virtual morphac::constructs::State ExactStep(
+      const morphac::constructs::State& state,
+      const morphac::constructs::ControlInput& control_input,
+      const double dt) const;
+
+  // In place variant of ExactStep. The updated state may be the same object as
+  // the given state. The default implementation delegates to the function
+  // above.
+  virtual void ExactStep(const morphac::constructs::State& state,
+                         const morphac::constructs::ControlInput& control_input,
+                         const double dt,
+                         morphac::constructs::State& updated_state) const;
+
   // Function to create the default footprint for the model.
   virtual morphac::robot::blueprint::Footprint DefaultFootprint() const = 0;
 
   const int pose_size;
   const int velocity_size;
   const int control_input_size;
+
+ protected:
+  // Validates the dimensions of the state and control input.
+  void RequireDimensions(
+      const morphac::constructs::State& state,
+      const morphac::constructs::ControlInput& control_input) const;
+
+  // Validates the dimensions of the batched states and control inputs.
+  void RequireBatchDimensions(const Eigen::MatrixXd& states,
+                              const Eigen::MatrixXd& control_inputs) const;
+
+  // Displacement [dx, dy] when moving a distance along a circular arc that
+  // starts at the heading theta and turns by heading_change. Straight lines
+  // (zero heading change) are handled without any loss in precision.
+  static Eigen::Vector2d ComputeArcDisplacement(const double theta,
+                                                const double distance,
+                                                const double heading_change);
+
+  // Displacement [dx, dy] over [0, time] for a speed and heading that vary
+  // with the time elapsed, given as functions speed(t) and heading(t). This
+  // is used when the motion has no closed form (like steering at a constant
+  // rate). The integral is computed using a composite five point
+  // Gauss-Legendre quadrature over num_intervals equal intervals. It is
+  // accurate to floating point precision as long as the heading varies by at
+  // most pi / 4 across each interval.
+  template <typename SpeedFunction, typename HeadingFunction>
+  static Eigen::Vector2d ComputeQuadratureDisplacement(
+      const SpeedFunction& speed, const HeadingFunction& heading,
+      const double time, const int num_intervals);
 };
 
+template <typename SpeedFunction, typename HeadingFunction>
+Eigen::Vector2d KinematicModel::ComputeQuadratureDisplacement(
+    const SpeedFunction& speed, const HeadingFunction& heading,
+    const double time, const int num_intervals) {
+  MORPH_REQUIRE(num_intervals > 0, std::invalid_argument,
+                "Number of quadrature intervals must be positive.");
+
+  // Gauss-Legendre nodes and weights on [-1, 1].
+  constexpr int kNumNodes = 5;
+  constexpr double kNodes[kNumNodes] = {
+      -0.9061798459386640, -0.5384693101056831, 0., 0.5384693101056831,
+      0.9061798459386640};
+  constexpr double kWeights[kNumNodes] = {
+      0.2369268850561891, 0.4786286704993665, 0.5688888888888889,
+      0.4786286704993665, 0.2369268850561891};
+
+  const double interval = time / num_intervals;
+  Eigen::Vector2d displacement = Eigen::Vector2d::Zero();
+  for (int i = 0; i < num_intervals; ++i) {
+    const double mid_time = (i + 0.5) * interval;
+    for (int j = 0; j < kNumNodes; ++j) {
+      const double t = mid_time + 0.5 * interval * kNodes[j];
+      const double weighted_speed = 0.5 * interval * kWeights[j] * speed(t);
+      const double theta = heading(t);
+      displacement(0) += weighted_speed * std::cos(theta);
+      displacement(1) += weighted_speed * std::sin(theta);
+    }
+  }
+
+  return displacement;
+}
+
 }  // namespace models
 }  // namespace mechanics
 }  // namespace morphac
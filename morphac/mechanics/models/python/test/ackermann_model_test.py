@@ -139,6 +139,83 @@ def test_compute_steering_angles(generate_ackermann_model_list):
     assert inner_steering_angle < ideal_steering_angle < outer_steering_angle
 
 
+def test_derivative_batch_computation(generate_ackermann_model_list):
+
+    a1, a2 = generate_ackermann_model_list
+
+    # Each row of the batch must match the single state computation. The
+    # actual computation is tested on the cpp side.
+    robot_states = np.array([[1, 2, 3, 0]] * 5, dtype=np.float)
+    control_inputs = np.ones([5, 2])
+
+    derivatives = a1.compute_state_derivative_batch(
+        robot_states=robot_states, control_inputs=control_inputs
+    )
+    derivative = a1.compute_state_derivative(
+        State([1, 2, 3, 0], []), ControlInput([1, 1])
+    )
+
+    assert derivatives.shape == (5, 4)
+    for row in derivatives:
+        assert np.allclose(row, derivative.data)
+
+    # Making sure that the batch dimensions are validated.
+    with pytest.raises(ValueError):
+        a2.compute_state_derivative_batch(np.zeros([5, 5]), control_inputs)
+    with pytest.raises(ValueError):
+        a2.compute_state_derivative_batch(robot_states, np.zeros([4, 2]))
+
+
+def test_jacobians(generate_ackermann_model_list):
+
+    a1, a2 = generate_ackermann_model_list
+
+    # The values are compared against finite differences on the cpp side.
+    robot_state = State([1, 2, 0, 0], [])
+    control_input = ControlInput([2, 0])
+
+    state_jacobian = a1.compute_state_jacobian(
+        robot_state=robot_state, control_input=control_input
+    )
+    control_jacobian = a1.compute_control_jacobian(
+        robot_state=robot_state, control_input=control_input
+    )
+
+    assert np.allclose(
+        state_jacobian, [[0, 0, 0, 0], [0, 0, 2, 0], [0, 0, 0, 1], [0, 0, 0, 0]]
+    )
+    assert np.allclose(control_jacobian, [[1, 0], [0, 0], [0, 0], [0, 1]])
+
+    with pytest.raises(ValueError):
+        a2.compute_state_jacobian(State(3, 0), ControlInput(2))
+    with pytest.raises(ValueError):
+        a2.compute_control_jacobian(State(3, 0), ControlInput(2))
+
+
+def test_exact_step(generate_ackermann_model_list):
+
+    a1, a2 = generate_ackermann_model_list
+
+    # We only test that the function is called and returns properly, not the
+    # actual computation as the cpp side tests this.
+    assert a1.has_exact_step()
+
+    # Test with positional arguments.
+    updated_state = a1.exact_step(
+        robot_state=State([1, 2, 3, 0], []), control_input=ControlInput(2), dt=0.1
+    )
+
+    # Zero control input, so the state doesn't change.
+    assert np.allclose(updated_state.data, [1, 2, 3, 0])
+
+    # Making sure that the step can only be computed for states and control
+    # inputs that are of the correct dimensions.
+    with pytest.raises(ValueError):
+        a2.exact_step(State(3, 0), ControlInput(2), 0.1)
+    with pytest.raises(ValueError):
+        a2.exact_step(State(4, 0), ControlInput(3), 0.1)
+
+
 def test_normalize_state():
 
     ackermann_model = AckermannModel(1, 1)
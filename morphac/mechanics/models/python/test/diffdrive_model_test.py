@@ -105,6 +105,81 @@ def test_derivative_computation(generate_diffdrive_model_list):
         d2.compute_state_derivative(State(3, 0), ControlInput(3))
 
 
+def test_derivative_batch_computation(generate_diffdrive_model_list):
+
+    d1, d2 = generate_diffdrive_model_list
+
+    # Each row of the batch must match the single state computation. The
+    # actual computation is tested on the cpp side.
+    robot_states = np.array([[1, 2, 3]] * 5, dtype=np.float)
+    control_inputs = np.ones([5, 2])
+
+    derivatives = d1.compute_state_derivative_batch(
+        robot_states=robot_states, control_inputs=control_inputs
+    )
+    derivative = d1.compute_state_derivative(
+        State([1, 2, 3], []), ControlInput([1, 1])
+    )
+
+    assert derivatives.shape == (5, 3)
+    for row in derivatives:
+        assert np.allclose(row, derivative.data)
+
+    # Making sure that the batch dimensions are validated.
+    with pytest.raises(ValueError):
+        d2.compute_state_derivative_batch(np.zeros([5, 4]), control_inputs)
+    with pytest.raises(ValueError):
+        d2.compute_state_derivative_batch(robot_states, np.zeros([4, 2]))
+
+
+def test_jacobians(generate_diffdrive_model_list):
+
+    d1, d2 = generate_diffdrive_model_list
+
+    # The values are compared against finite differences on the cpp side.
+    robot_state = State([1, 2, 0], [])
+    control_input = ControlInput([1, 1])
+
+    state_jacobian = d1.compute_state_jacobian(
+        robot_state=robot_state, control_input=control_input
+    )
+    control_jacobian = d1.compute_control_jacobian(
+        robot_state=robot_state, control_input=control_input
+    )
+
+    assert np.allclose(state_jacobian, [[0, 0, 0], [0, 0, 1], [0, 0, 0]])
+    assert np.allclose(control_jacobian, [[0.5, 0.5], [0, 0], [-0.5, 0.5]])
+
+    with pytest.raises(ValueError):
+        d2.compute_state_jacobian(State(4, 0), ControlInput(2))
+    with pytest.raises(ValueError):
+        d2.compute_control_jacobian(State(4, 0), ControlInput(2))
+
+
+def test_exact_step(generate_diffdrive_model_list):
+
+    d1, d2 = generate_diffdrive_model_list
+
+    # We only test that the function is called and returns properly, not the
+    # actual computation as the cpp side tests this.
+    assert d1.has_exact_step()
+
+    # Test with positional arguments.
+    updated_state = d1.exact_step(
+        robot_state=State([1, 2, 3], []), control_input=ControlInput(2), dt=0.1
+    )
+
+    # Zero control input, so the state doesn't change.
+    assert np.allclose(updated_state.data, [1, 2, 3])
+
+    # Making sure that the step can only be computed for states and control
+    # inputs that are of the correct dimensions.
+    with pytest.raises(ValueError):
+        d2.exact_step(State(2, 0), ControlInput(2), 0.1)
+    with pytest.raises(ValueError):
+        d2.exact_step(State(3, 0), ControlInput(3), 0.1)
+
+
 def test_normalize_state():
 
     diffdrive_model = DiffdriveModel(1, 1)
@@ -98,6 +98,43 @@ def test_derivative_computation(generate_custom_model_list):
     assert np.allclose(der3.data, [18 + 10] * 6)
 
 
+def test_derivative_batch_computation(generate_custom_model_list):
+
+    c1, _, _ = generate_custom_model_list
+
+    # The default implementation goes through the python
+    # compute_state_derivative for each row.
+    robot_states = np.random.randn(4, 5)
+    control_inputs = np.random.randn(4, 5)
+
+    derivatives = c1.compute_state_derivative_batch(robot_states, control_inputs)
+
+    assert derivatives.shape == (4, 5)
+    for i in range(4):
+        derivative = c1.compute_state_derivative(
+            State(robot_states[i, :3], robot_states[i, 3:]),
+            ControlInput(control_inputs[i]),
+        )
+        assert np.allclose(derivatives[i], derivative.data)
+
+
+def test_jacobians(generate_custom_model_list):
+
+    c1, _, _ = generate_custom_model_list
+
+    # The default implementation uses finite differences through the python
+    # compute_state_derivative. Every element of the derivative is
+    # sum(x * u) + a * b, so each row of the Jacobians is u and x.
+    robot_state = State([1, 2, 3], [4, 5])
+    control_input = ControlInput([-1, 0.5, 2, 0, 3])
+
+    state_jacobian = c1.compute_state_jacobian(robot_state, control_input)
+    control_jacobian = c1.compute_control_jacobian(robot_state, control_input)
+
+    assert np.allclose(state_jacobian, [control_input.data] * 5)
+    assert np.allclose(control_jacobian, [robot_state.data] * 5)
+
+
 def test_normalize_state(generate_custom_model_list):
 
     c1, c2, c3 = generate_custom_model_list
@@ -113,6 +150,16 @@ def test_normalize_state(generate_custom_model_list):
     assert c3.normalize_state(robot_state=state3) == state3
 
 
+def test_exact_step(generate_custom_model_list):
+
+    c1, _, _ = generate_custom_model_list
+
+    # The custom model doesn't implement an exact step.
+    assert not c1.has_exact_step()
+    with pytest.raises(RuntimeError):
+        c1.exact_step(State(3, 2), ControlInput(5), 0.1)
+
+
 def test_default_footprint(generate_custom_model_list):
 
     c1, _, _ = generate_custom_model_list
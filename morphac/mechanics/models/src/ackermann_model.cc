@@ -5,15 +5,18 @@ namespace mechanics {
 namespace models {
 
 using std::atan2;
+using std::ceil;
 using std::cos;
 using std::fabs;
+using std::log1p;
+using std::max;
 using std::min;
 using std::sin;
 using std::tan;
 using std::vector;
 
+using Eigen::Matrix;
 using Eigen::MatrixXd;
-using Eigen::VectorXd;
 
 using morphac::common::aliases::Point;
 using morphac::constants::AckermannModelConstants;
@@ -35,15 +38,14 @@ AckermannModel::AckermannModel(const double width, const double length)
 
 State AckermannModel::ComputeStateDerivative(
     const State& state, const ControlInput& control_input) const {
-  MORPH_REQUIRE(
-      state.get_pose_size() == 4, std::invalid_argument,
-      "Pose component of the state needs to be of size 4 [x, y, theta, phi].");
-  MORPH_REQUIRE(state.IsVelocityEmpty(), std::invalid_argument,
-                "Velocity component of the state must be empty.");
-  MORPH_REQUIRE(control_input.get_size() == 2, std::invalid_argument,
-                "ControlInput must be of size 2.");
-
-  VectorXd pose_derivative(4);
+  // The fixed size conversions check the dimensions of the arguments.
+  return ComputeStateDerivative(StateType(state),
+                                ControlInputType(control_input))
+      .ToState();
+}
+
+AckermannModel::StateType AckermannModel::ComputeStateDerivative(
+    const StateType& state, const ControlInputType& control_input) const {
   double theta = state[2];
   double phi = state[3];
 
@@ -51,31 +53,206 @@ State AckermannModel::ComputeStateDerivative(
   // valid steering angle for the ackermann model. The kinematic model contains
   // a tan(phi) which makes this undefined.
   // Note that we assume that the state is already normalized.
-  MORPH_REQUIRE(
+  MORPH_HOT_REQUIRE(
       (phi > -M_PI / 2) && (phi < M_PI / 2), std::invalid_argument,
       "Invalid steering angle. It must lie between -pi / 2 and pi / 2.");
 
-  // Equation of the form xdot = F(x) + G(x)u
-  MatrixXd F = VectorXd::Zero(4);
-  MatrixXd G(4, 2);
+  // Equation of the form xdot = F(x) + G(x)u, where F(x) is zero.
+  Matrix<double, 4, 2> G;
 
   G << cos(theta), 0, sin(theta), 0, tan(phi) / length, 0, 0, 1;
 
-  pose_derivative = F + G * control_input.get_data();
-
   // Return the derivative.
-  return State(pose_derivative, VectorXd::Zero(0));
+  return StateType(G * control_input.get_data(), StateType::VelocityVector());
 }
 
 State AckermannModel::NormalizeState(const State& state) const {
-  // Normalizing the heading and steering angles.
   State normalized_state = state;
+  NormalizeState(state, normalized_state);
+
+  return normalized_state;
+}
+
+void AckermannModel::ComputeStateDerivative(const State& state,
+                                            const ControlInput& control_input,
+                                            State& derivative) const {
+  // The fixed size conversions check the dimensions of the arguments.
+  ComputeStateDerivative(StateType(state), ControlInputType(control_input))
+      .CopyTo(derivative);
+}
+
+void AckermannModel::NormalizeState(const State& state,
+                                    State& normalized_state) const {
+  // Normalizing the heading and steering angles.
+  normalized_state = state;
+  normalized_state[2] = NormalizeAngle(normalized_state[2]);
+  normalized_state[3] = NormalizeAngle(normalized_state[3]);
+}
+
+AckermannModel::StateType AckermannModel::NormalizeState(
+    const StateType& state) const {
+  StateType normalized_state = state;
   normalized_state[2] = NormalizeAngle(normalized_state[2]);
   normalized_state[3] = NormalizeAngle(normalized_state[3]);
 
   return normalized_state;
 }
 
+MatrixXd AckermannModel::ComputeStateJacobian(
+    const State& state, const ControlInput& control_input) const {
+  // The fixed size conversions check the dimensions of the arguments.
+  return ComputeStateJacobian(StateType(state),
+                              ControlInputType(control_input));
+}
+
+MatrixXd AckermannModel::ComputeControlJacobian(
+    const State& state, const ControlInput& control_input) const {
+  return ComputeControlJacobian(StateType(state),
+                                ControlInputType(control_input));
+}
+
+AckermannModel::StateJacobianType AckermannModel::ComputeStateJacobian(
+    const StateType& state, const ControlInputType& control_input) const {
+  const double theta = state[2];
+  const double phi = state[3];
+  const double speed = control_input[0];
+
+  // See ComputeStateDerivative for why phi is restricted.
+  MORPH_HOT_REQUIRE(
+      (phi > -M_PI / 2) && (phi < M_PI / 2), std::invalid_argument,
+      "Invalid steering angle. It must lie between -pi / 2 and pi / 2.");
+
+  StateJacobianType state_jacobian = StateJacobianType::Zero();
+  state_jacobian(0, 2) = -speed * sin(theta);
+  state_jacobian(1, 2) = speed * cos(theta);
+  state_jacobian(2, 3) = speed / (length * cos(phi) * cos(phi));
+
+  return state_jacobian;
+}
+
+AckermannModel::ControlJacobianType AckermannModel::ComputeControlJacobian(
+    const StateType& state, const ControlInputType&) const {
+  const double theta = state[2];
+  const double phi = state[3];
+
+  MORPH_HOT_REQUIRE(
+      (phi > -M_PI / 2) && (phi < M_PI / 2), std::invalid_argument,
+      "Invalid steering angle. It must lie between -pi / 2 and pi / 2.");
+
+  // The derivative is linear in the control input, so this is G(x).
+  ControlJacobianType control_jacobian;
+  control_jacobian << cos(theta), 0, sin(theta), 0, tan(phi) / length, 0, 0, 1;
+
+  return control_jacobian;
+}
+
+MatrixXd AckermannModel::ComputeStateDerivativeBatch(
+    const MatrixXd& states, const MatrixXd& control_inputs) const {
+  MatrixXd derivatives(states.rows(), 4);
+  ComputeStateDerivativeBatch(states, control_inputs, derivatives);
+
+  return derivatives;
+}
+
+void AckermannModel::ComputeStateDerivativeBatch(const MatrixXd& states,
+                                                 const MatrixXd& control_inputs,
+                                                 MatrixXd& derivatives) const {
+  RequireBatchDimensions(states, control_inputs);
+  derivatives.resize(states.rows(), 4);
+
+  const auto theta = states.col(2).array();
+  const auto phi = states.col(3).array();
+  const auto speed = control_inputs.col(0).array();
+
+  // See the single state computation for why phi is restricted.
+  MORPH_REQUIRE(
+      (phi.abs() < M_PI / 2).all(), std::invalid_argument,
+      "Invalid steering angle. It must lie between -pi / 2 and pi / 2.");
+
+  // Each derivative component is computed as an array operation over the
+  // columns, which Eigen vectorizes.
+  derivatives.col(0).array() = speed * theta.cos();
+  derivatives.col(1).array() = speed * theta.sin();
+  derivatives.col(2).array() = speed * phi.tan() / length;
+  derivatives.col(3) = control_inputs.col(1);
+}
+
+bool AckermannModel::HasExactStep() const { return true; }
+
+State AckermannModel::ExactStep(const State& state,
+                                const ControlInput& control_input,
+                                const double dt) const {
+  // The fixed size conversions check the dimensions of the arguments.
+  return ExactStep(StateType(state), ControlInputType(control_input), dt)
+      .ToState();
+}
+
+void AckermannModel::ExactStep(const State& state,
+                               const ControlInput& control_input,
+                               const double dt, State& updated_state) const {
+  ExactStep(StateType(state), ControlInputType(control_input), dt)
+      .CopyTo(updated_state);
+}
+
+AckermannModel::StateType AckermannModel::ExactStep(
+    const StateType& state, const ControlInputType& control_input,
+    const double dt) const {
+  const double theta = state[2];
+  const double phi = state[3];
+  const double speed = control_input[0];
+  const double steering_rate = control_input[1];
+  const double updated_phi = phi + steering_rate * dt;
+
+  // The steering angle changes monotonically, so it lies within the valid
+  // range throughout the step as long as it does at both ends.
+  MORPH_HOT_REQUIRE(
+      (phi > -M_PI / 2) && (phi < M_PI / 2), std::invalid_argument,
+      "Invalid steering angle. It must lie between -pi / 2 and pi / 2.");
+  MORPH_HOT_REQUIRE((updated_phi > -M_PI / 2) && (updated_phi < M_PI / 2),
+                    std::invalid_argument,
+                    "Invalid steering angle at the end of the step. It must "
+                    "lie between -pi / 2 and pi / 2.");
+
+  StateType updated_state = state;
+  updated_state[3] = updated_phi;
+
+  if (steering_rate == 0.) {
+    // Constant steering angle, which is a circular arc.
+    const double heading_change = speed * tan(phi) * dt / length;
+    updated_state.get_data_ref().head<2>() +=
+        ComputeArcDisplacement(theta, speed * dt, heading_change);
+    updated_state[2] += heading_change;
+
+    return updated_state;
+  }
+
+  // For a constant steering rate w, the heading is given by
+  // theta(t) = theta + (v / (l * w)) * log(cos(phi) / cos(phi + w * t)).
+  // The log is written in terms of log1p so that it stays accurate for small
+  // steering rates. The position has no closed form and is computed through
+  // quadrature instead.
+  const double tan_phi = tan(phi);
+  auto heading = [&](const double t) {
+    const double half_angle = 0.5 * steering_rate * t;
+    return theta - (speed / (length * steering_rate)) *
+                       log1p(-2. * sin(half_angle) * sin(half_angle) -
+                             tan_phi * sin(steering_rate * t));
+  };
+  auto linear_velocity = [&](const double) { return speed; };
+
+  // The heading rate is largest (in magnitude) at either end of the step.
+  const double max_heading_change =
+      fabs(speed * dt) * max(fabs(tan_phi), fabs(tan(updated_phi))) / length;
+  const int num_intervals =
+      max(1, static_cast<int>(ceil(max_heading_change / (M_PI / 4))));
+
+  updated_state.get_data_ref().head<2>() += ComputeQuadratureDisplacement(
+      linear_velocity, heading, dt, num_intervals);
+  updated_state[2] = heading(dt);
+
+  return updated_state;
+}
+
 double AckermannModel::ComputeInnerSteeringAngle(
     const double ideal_steering_angle) const {
   return NormalizeAngle(atan2(2 * length * sin(ideal_steering_angle),
@@ -7,8 +7,8 @@ namespace models {
 using std::cos;
 using std::sin;
 
+using Eigen::Matrix;
 using Eigen::MatrixXd;
-using Eigen::VectorXd;
 
 using morphac::constants::DiffdriveModelConstants;
 using morphac::constructs::ControlInput;
@@ -28,39 +28,159 @@ DiffdriveModel::DiffdriveModel(const double radius, const double width)
 
 State DiffdriveModel::ComputeStateDerivative(
     const State& state, const ControlInput& control_input) const {
-  MORPH_REQUIRE(
-      state.get_pose_size() == 3, std::invalid_argument,
-      "Pose component of the state needs to be of size 3 [x, y, theta]");
-  MORPH_REQUIRE(state.IsVelocityEmpty(), std::invalid_argument,
-                "Velocity component of the state must be empty.");
-  MORPH_REQUIRE(control_input.get_size() == 2, std::invalid_argument,
-                "ControlInput must be of size 2.");
-
-  VectorXd pose_derivative(3);
+  // The fixed size conversions check the dimensions of the arguments.
+  return ComputeStateDerivative(StateType(state),
+                                ControlInputType(control_input))
+      .ToState();
+}
+
+DiffdriveModel::StateType DiffdriveModel::ComputeStateDerivative(
+    const StateType& state, const ControlInputType& control_input) const {
   double theta = state[2];
 
-  // Equation of the form xdot = F(x) + G(x)u
-  MatrixXd F = VectorXd::Zero(3);
-  MatrixXd G(3, 2);
+  // Equation of the form xdot = F(x) + G(x)u, where F(x) is zero.
+  Matrix<double, 3, 2> G;
 
   G << radius * 0.5 * cos(theta), radius * 0.5 * cos(theta),
       radius * 0.5 * sin(theta), radius * 0.5 * sin(theta), -radius / width,
       radius / width;
 
-  pose_derivative = F + G * control_input.get_data();
-
   // Return the derivative.
-  return State(pose_derivative, VectorXd::Zero(0));
+  return StateType(G * control_input.get_data(), StateType::VelocityVector());
 }
 
 State DiffdriveModel::NormalizeState(const State& state) const {
-  // For the diffdrive model, we normalize the pose angle.
   State normalized_state = state;
+  NormalizeState(state, normalized_state);
+
+  return normalized_state;
+}
+
+void DiffdriveModel::ComputeStateDerivative(const State& state,
+                                            const ControlInput& control_input,
+                                            State& derivative) const {
+  // The fixed size conversions check the dimensions of the arguments.
+  ComputeStateDerivative(StateType(state), ControlInputType(control_input))
+      .CopyTo(derivative);
+}
+
+void DiffdriveModel::NormalizeState(const State& state,
+                                    State& normalized_state) const {
+  // For the diffdrive model, we normalize the pose angle.
+  normalized_state = state;
+  normalized_state[2] = NormalizeAngle(normalized_state[2]);
+}
+
+DiffdriveModel::StateType DiffdriveModel::NormalizeState(
+    const StateType& state) const {
+  StateType normalized_state = state;
   normalized_state[2] = NormalizeAngle(normalized_state[2]);
 
   return normalized_state;
 }
 
+MatrixXd DiffdriveModel::ComputeStateJacobian(
+    const State& state, const ControlInput& control_input) const {
+  // The fixed size conversions check the dimensions of the arguments.
+  return ComputeStateJacobian(StateType(state),
+                              ControlInputType(control_input));
+}
+
+MatrixXd DiffdriveModel::ComputeControlJacobian(
+    const State& state, const ControlInput& control_input) const {
+  return ComputeControlJacobian(StateType(state),
+                                ControlInputType(control_input));
+}
+
+DiffdriveModel::StateJacobianType DiffdriveModel::ComputeStateJacobian(
+    const StateType& state, const ControlInputType& control_input) const {
+  const double theta = state[2];
+  const double linear_velocity =
+      radius * 0.5 * (control_input[0] + control_input[1]);
+
+  // Only the heading affects the derivative.
+  StateJacobianType state_jacobian = StateJacobianType::Zero();
+  state_jacobian(0, 2) = -linear_velocity * sin(theta);
+  state_jacobian(1, 2) = linear_velocity * cos(theta);
+
+  return state_jacobian;
+}
+
+DiffdriveModel::ControlJacobianType DiffdriveModel::ComputeControlJacobian(
+    const StateType& state, const ControlInputType&) const {
+  const double theta = state[2];
+
+  // The derivative is linear in the control input, so this is G(x).
+  ControlJacobianType control_jacobian;
+  control_jacobian << radius * 0.5 * cos(theta), radius * 0.5 * cos(theta),
+      radius * 0.5 * sin(theta), radius * 0.5 * sin(theta), -radius / width,
+      radius / width;
+
+  return control_jacobian;
+}
+
+MatrixXd DiffdriveModel::ComputeStateDerivativeBatch(
+    const MatrixXd& states, const MatrixXd& control_inputs) const {
+  MatrixXd derivatives(states.rows(), 3);
+  ComputeStateDerivativeBatch(states, control_inputs, derivatives);
+
+  return derivatives;
+}
+
+void DiffdriveModel::ComputeStateDerivativeBatch(const MatrixXd& states,
+                                                 const MatrixXd& control_inputs,
+                                                 MatrixXd& derivatives) const {
+  RequireBatchDimensions(states, control_inputs);
+  derivatives.resize(states.rows(), 3);
+
+  // Each derivative component is computed as an array operation over the
+  // columns, which Eigen vectorizes.
+  const auto theta = states.col(2).array();
+  const auto wheel_velocity_sum =
+      control_inputs.col(0).array() + control_inputs.col(1).array();
+  derivatives.col(0).array() = radius * 0.5 * wheel_velocity_sum * theta.cos();
+  derivatives.col(1).array() = radius * 0.5 * wheel_velocity_sum * theta.sin();
+  derivatives.col(2).array() =
+      (radius / width) *
+      (control_inputs.col(1).array() - control_inputs.col(0).array());
+}
+
+bool DiffdriveModel::HasExactStep() const { return true; }
+
+State DiffdriveModel::ExactStep(const State& state,
+                                const ControlInput& control_input,
+                                const double dt) const {
+  // The fixed size conversions check the dimensions of the arguments.
+  return ExactStep(StateType(state), ControlInputType(control_input), dt)
+      .ToState();
+}
+
+void DiffdriveModel::ExactStep(const State& state,
+                               const ControlInput& control_input,
+                               const double dt, State& updated_state) const {
+  ExactStep(StateType(state), ControlInputType(control_input), dt)
+      .CopyTo(updated_state);
+}
+
+DiffdriveModel::StateType DiffdriveModel::ExactStep(
+    const StateType& state, const ControlInputType& control_input,
+    const double dt) const {
+  // The wheel velocities being constant, the robot moves along a circular arc
+  // with constant linear and angular velocities.
+  const double linear_velocity =
+      radius * 0.5 * (control_input[0] + control_input[1]);
+  const double angular_velocity =
+      radius * (control_input[1] - control_input[0]) / width;
+  const double heading_change = angular_velocity * dt;
+
+  StateType updated_state = state;
+  updated_state.get_data_ref().head<2>() +=
+      ComputeArcDisplacement(state[2], linear_velocity * dt, heading_change);
+  updated_state[2] += heading_change;
+
+  return updated_state;
+}
+
 Footprint DiffdriveModel::DefaultFootprint() const {
   // Default circular footprint.
   // Buffer length that defines how much the footprint extends out of the frame
@@ -8,7 +8,7 @@ using std::cos;
 using std::sin;
 
 using Eigen::MatrixXd;
-using Eigen::VectorXd;
+using Eigen::Vector3d;
 
 using morphac::constants::DubinModelConstants;
 using morphac::constructs::ControlInput;
@@ -23,36 +23,142 @@ DubinModel::DubinModel(const double speed)
 
 State DubinModel::ComputeStateDerivative(
     const State& state, const ControlInput& control_input) const {
-  MORPH_REQUIRE(
-      state.get_pose_size() == 3, std::invalid_argument,
-      "Pose component of the state needs to be of size 3 [x, y, theta]");
-  MORPH_REQUIRE(state.IsVelocityEmpty(), std::invalid_argument,
-                "Velocity component of the state must be empty.");
-  MORPH_REQUIRE(control_input.get_size() == 1, std::invalid_argument,
-                "ControlInput must be of size 1.");
-
-  VectorXd pose_derivative(3);
+  // The fixed size conversions check the dimensions of the arguments.
+  return ComputeStateDerivative(StateType(state),
+                                ControlInputType(control_input))
+      .ToState();
+}
+
+DubinModel::StateType DubinModel::ComputeStateDerivative(
+    const StateType& state, const ControlInputType& control_input) const {
   double theta = state[2];
 
   // Equation of the form xdot = F(x) + G(x)u
-  MatrixXd F(3, 1), G(3, 1);
+  Vector3d F, G;
   F << speed * cos(theta), speed * sin(theta), 0;
   G << 0, 0, 1;
 
-  pose_derivative = F + G * control_input.get_data();
-
   // Return the derivative.
-  return State(pose_derivative, VectorXd::Zero(0));
+  return StateType(F + G * control_input[0], StateType::VelocityVector());
 }
 
 State DubinModel::NormalizeState(const State& state) const {
-  // For the dubin model, we normalize the pose angle.
   State normalized_state = state;
+  NormalizeState(state, normalized_state);
+
+  return normalized_state;
+}
+
+void DubinModel::ComputeStateDerivative(const State& state,
+                                        const ControlInput& control_input,
+                                        State& derivative) const {
+  // The fixed size conversions check the dimensions of the arguments.
+  ComputeStateDerivative(StateType(state), ControlInputType(control_input))
+      .CopyTo(derivative);
+}
+
+void DubinModel::NormalizeState(const State& state,
+                                State& normalized_state) const {
+  // For the dubin model, we normalize the pose angle.
+  normalized_state = state;
+  normalized_state[2] = NormalizeAngle(normalized_state[2]);
+}
+
+DubinModel::StateType DubinModel::NormalizeState(
+    const StateType& state) const {
+  StateType normalized_state = state;
   normalized_state[2] = NormalizeAngle(normalized_state[2]);
 
   return normalized_state;
 }
 
+MatrixXd DubinModel::ComputeStateJacobian(
+    const State& state, const ControlInput& control_input) const {
+  // The fixed size conversions check the dimensions of the arguments.
+  return ComputeStateJacobian(StateType(state),
+                              ControlInputType(control_input));
+}
+
+MatrixXd DubinModel::ComputeControlJacobian(
+    const State& state, const ControlInput& control_input) const {
+  return ComputeControlJacobian(StateType(state),
+                                ControlInputType(control_input));
+}
+
+DubinModel::StateJacobianType DubinModel::ComputeStateJacobian(
+    const StateType& state, const ControlInputType&) const {
+  const double theta = state[2];
+
+  // Only the heading affects the derivative.
+  StateJacobianType state_jacobian = StateJacobianType::Zero();
+  state_jacobian(0, 2) = -speed * sin(theta);
+  state_jacobian(1, 2) = speed * cos(theta);
+
+  return state_jacobian;
+}
+
+DubinModel::ControlJacobianType DubinModel::ComputeControlJacobian(
+    const StateType&, const ControlInputType&) const {
+  // The control input only affects the heading.
+  ControlJacobianType control_jacobian;
+  control_jacobian << 0, 0, 1;
+
+  return control_jacobian;
+}
+
+MatrixXd DubinModel::ComputeStateDerivativeBatch(
+    const MatrixXd& states, const MatrixXd& control_inputs) const {
+  MatrixXd derivatives(states.rows(), 3);
+  ComputeStateDerivativeBatch(states, control_inputs, derivatives);
+
+  return derivatives;
+}
+
+void DubinModel::ComputeStateDerivativeBatch(const MatrixXd& states,
+                                             const MatrixXd& control_inputs,
+                                             MatrixXd& derivatives) const {
+  RequireBatchDimensions(states, control_inputs);
+  derivatives.resize(states.rows(), 3);
+
+  // Each derivative component is computed as an array operation over the
+  // columns, which Eigen vectorizes.
+  const auto theta = states.col(2).array();
+  derivatives.col(0).array() = speed * theta.cos();
+  derivatives.col(1).array() = speed * theta.sin();
+  derivatives.col(2) = control_inputs.col(0);
+}
+
+bool DubinModel::HasExactStep() const { return true; }
+
+State DubinModel::ExactStep(const State& state,
+                            const ControlInput& control_input,
+                            const double dt) const {
+  // The fixed size conversions check the dimensions of the arguments.
+  return ExactStep(StateType(state), ControlInputType(control_input), dt)
+      .ToState();
+}
+
+void DubinModel::ExactStep(const State& state,
+                           const ControlInput& control_input,
+                           const double dt, State& updated_state) const {
+  ExactStep(StateType(state), ControlInputType(control_input), dt)
+      .CopyTo(updated_state);
+}
+
+DubinModel::StateType DubinModel::ExactStep(
+    const StateType& state, const ControlInputType& control_input,
+    const double dt) const {
+  // Constant speed and angular velocity, which is a circular arc.
+  const double heading_change = control_input[0] * dt;
+
+  StateType updated_state = state;
+  updated_state.get_data_ref().head<2>() +=
+      ComputeArcDisplacement(state[2], speed * dt, heading_change);
+  updated_state[2] += heading_change;
+
+  return updated_state;
+}
+
 Footprint DubinModel::DefaultFootprint() const {
   // Default triangular footprint.
   return Footprint::CreateTriangularFootprint(
@@ -4,6 +4,17 @@ namespace morphac {
 namespace mechanics {
 namespace models {
 
+using std::abs;
+using std::cbrt;
+using std::cos;
+using std::max;
+using std::numeric_limits;
+using std::sin;
+
+using Eigen::MatrixXd;
+using Eigen::Vector2d;
+
+using morphac::constructs::ControlInput;
 using morphac::constructs::State;
 
 KinematicModel::KinematicModel(const int pose_size, const int velocity_size,
@@ -18,6 +29,156 @@ State KinematicModel::NormalizeState(const State& state) const {
   return state;
 }
 
+void KinematicModel::ComputeStateDerivative(const State& state,
+                                            const ControlInput& control_input,
+                                            State& derivative) const {
+  derivative = ComputeStateDerivative(state, control_input);
+}
+
+void KinematicModel::NormalizeState(const State& state,
+                                    State& normalized_state) const {
+  normalized_state = NormalizeState(state);
+}
+
+MatrixXd KinematicModel::ComputeStateJacobian(
+    const State& state, const ControlInput& control_input) const {
+  RequireDimensions(state, control_input);
+
+  // Central finite differences, with the step scaled by the magnitude of each
+  // element.
+  MatrixXd state_jacobian(state.get_size(), state.get_size());
+  State perturbed_state = state;
+  for (int i = 0; i < state.get_size(); ++i) {
+    const double h = cbrt(numeric_limits<double>::epsilon()) *
+                     max(1., abs(state[i]));
+    perturbed_state[i] = state[i] + h;
+    State forward_derivative =
+        ComputeStateDerivative(perturbed_state, control_input);
+    perturbed_state[i] = state[i] - h;
+    State backward_derivative =
+        ComputeStateDerivative(perturbed_state, control_input);
+    perturbed_state[i] = state[i];
+
+    state_jacobian.col(i) =
+        (forward_derivative.get_data() - backward_derivative.get_data()) /
+        (2 * h);
+  }
+
+  return state_jacobian;
+}
+
+MatrixXd KinematicModel::ComputeControlJacobian(
+    const State& state, const ControlInput& control_input) const {
+  RequireDimensions(state, control_input);
+
+  MatrixXd control_jacobian(state.get_size(), control_input.get_size());
+  ControlInput perturbed_control_input = control_input;
+  for (int i = 0; i < control_input.get_size(); ++i) {
+    const double h = cbrt(numeric_limits<double>::epsilon()) *
+                     max(1., abs(control_input[i]));
+    perturbed_control_input[i] = control_input[i] + h;
+    State forward_derivative =
+        ComputeStateDerivative(state, perturbed_control_input);
+    perturbed_control_input[i] = control_input[i] - h;
+    State backward_derivative =
+        ComputeStateDerivative(state, perturbed_control_input);
+    perturbed_control_input[i] = control_input[i];
+
+    control_jacobian.col(i) =
+        (forward_derivative.get_data() - backward_derivative.get_data()) /
+        (2 * h);
+  }
+
+  return control_jacobian;
+}
+
+MatrixXd KinematicModel::ComputeStateDerivativeBatch(
+    const MatrixXd& states, const MatrixXd& control_inputs) const {
+  MatrixXd derivatives(states.rows(), states.cols());
+  ComputeStateDerivativeBatch(states, control_inputs, derivatives);
+
+  return derivatives;
+}
+
+void KinematicModel::ComputeStateDerivativeBatch(
+    const MatrixXd& states, const MatrixXd& control_inputs,
+    MatrixXd& derivatives) const {
+  RequireBatchDimensions(states, control_inputs);
+  derivatives.resize(states.rows(), pose_size + velocity_size);
+
+  // Default implementation that goes through the single state computation.
+  State state(pose_size, velocity_size);
+  ControlInput control_input(control_input_size);
+  for (int i = 0; i < states.rows(); ++i) {
+    state.set_data(states.row(i).transpose());
+    control_input.set_data(control_inputs.row(i).transpose());
+    derivatives.row(i) =
+        ComputeStateDerivative(state, control_input).get_data().transpose();
+  }
+}
+
+bool KinematicModel::HasExactStep() const {
+  // Default implementation. Models don't have an exact step unless they
+  // implement one.
+  return false;
+}
+
+State KinematicModel::ExactStep(const State&, const ControlInput&,
+                                const double) const {
+  MORPH_THROW(std::logic_error,
+              "The kinematic model does not have an exact step.");
+}
+
+void KinematicModel::ExactStep(const State& state,
+                               const ControlInput& control_input,
+                               const double dt, State& updated_state) const {
+  updated_state = ExactStep(state, control_input, dt);
+}
+
+void KinematicModel::RequireDimensions(
+    const State& state, const ControlInput& control_input) const {
+  MORPH_REQUIRE(state.get_pose_size() == pose_size &&
+                    state.get_velocity_size() == velocity_size,
+                std::invalid_argument,
+                "State dimensions do not match the dimensions of the model.");
+  MORPH_REQUIRE(control_input.get_size() == control_input_size,
+                std::invalid_argument,
+                "Control input must be of size control_input_size.");
+}
+
+void KinematicModel::RequireBatchDimensions(
+    const MatrixXd& states, const MatrixXd& control_inputs) const {
+  MORPH_REQUIRE(states.cols() == pose_size + velocity_size,
+                std::invalid_argument,
+                "Each row of the states must be of size pose_size + "
+                "velocity_size.");
+  MORPH_REQUIRE(control_inputs.cols() == control_input_size,
+                std::invalid_argument,
+                "Each row of the control inputs must be of size "
+                "control_input_size.");
+  MORPH_REQUIRE(states.rows() == control_inputs.rows(), std::invalid_argument,
+                "Number of states and control inputs must be equal.");
+}
+
+Vector2d KinematicModel::ComputeArcDisplacement(const double theta,
+                                                const double distance,
+                                                const double heading_change) {
+  // The chord of the arc points along the mean heading and its length is
+  // distance * sinc(heading_change / 2). The sinc is expanded around zero so
+  // that straight lines don't divide by zero.
+  const double half_change = 0.5 * heading_change;
+  double sinc = 1.;
+  if (abs(half_change) > 1e-4) {
+    sinc = sin(half_change) / half_change;
+  } else {
+    sinc = 1. - half_change * half_change / 6.;
+  }
+  const double chord = distance * sinc;
+
+  return Vector2d(chord * cos(theta + half_change),
+                  chord * sin(theta + half_change));
+}
+
 }  // namespace models
 }  // namespace mechanics
 }  // namespace morphac
@@ -4,12 +4,15 @@ namespace morphac {
 namespace mechanics {
 namespace models {
 
+using std::ceil;
 using std::cos;
+using std::fabs;
+using std::max;
 using std::min;
 using std::sin;
 
+using Eigen::Matrix;
 using Eigen::MatrixXd;
-using Eigen::VectorXd;
 
 using morphac::common::aliases::Point;
 using morphac::constants::TricycleModelConstants;
@@ -31,42 +34,195 @@ TricycleModel::TricycleModel(const double width, const double length)
 
 State TricycleModel::ComputeStateDerivative(
     const State& state, const ControlInput& control_input) const {
-  MORPH_REQUIRE(state.get_pose_size() == 4, std::invalid_argument,
-                "Pose component of the state needs to be of size 4 [x, y, "
-                "theta, alpha].");
-  MORPH_REQUIRE(state.IsVelocityEmpty(), std::invalid_argument,
-                "Velocity component of the state must be empty.");
-  MORPH_REQUIRE(control_input.get_size() == 2, std::invalid_argument,
-                "ControlInput must be of size 2.");
+  // The fixed size conversions check the dimensions of the arguments.
+  return ComputeStateDerivative(StateType(state),
+                                ControlInputType(control_input))
+      .ToState();
+}
 
+TricycleModel::StateType TricycleModel::ComputeStateDerivative(
+    const StateType& state, const ControlInputType& control_input) const {
   // It is to be noted that the width parameter does not affect any of the
   // computation for the tricycle model.
-  VectorXd pose_derivative(4);
   double theta = state[2];
   double alpha = state[3];
 
-  // Equation of the form xdot = F(x) + G(x)u
-  MatrixXd F = VectorXd::Zero(4);
-  MatrixXd G(4, 2);
+  // Equation of the form xdot = F(x) + G(x)u, where F(x) is zero.
+  Matrix<double, 4, 2> G;
 
   G << cos(alpha) * cos(theta), 0, cos(alpha) * sin(theta), 0,
       (1. / length) * sin(alpha), 0, 0, 1;
 
-  pose_derivative = F + G * control_input.get_data();
-
   // Return the derivative.
-  return State(pose_derivative, VectorXd::Zero(0));
+  return StateType(G * control_input.get_data(), StateType::VelocityVector());
 }
 
 State TricycleModel::NormalizeState(const State& state) const {
-  // For the tricycle model, we normalize the heading and steering angles.
   State normalized_state = state;
+  NormalizeState(state, normalized_state);
+
+  return normalized_state;
+}
+
+void TricycleModel::ComputeStateDerivative(const State& state,
+                                           const ControlInput& control_input,
+                                           State& derivative) const {
+  // The fixed size conversions check the dimensions of the arguments.
+  ComputeStateDerivative(StateType(state), ControlInputType(control_input))
+      .CopyTo(derivative);
+}
+
+void TricycleModel::NormalizeState(const State& state,
+                                   State& normalized_state) const {
+  // For the tricycle model, we normalize the heading and steering angles.
+  normalized_state = state;
+  normalized_state[2] = NormalizeAngle(normalized_state[2]);
+  normalized_state[3] = NormalizeAngle(normalized_state[3]);
+}
+
+TricycleModel::StateType TricycleModel::NormalizeState(
+    const StateType& state) const {
+  StateType normalized_state = state;
   normalized_state[2] = NormalizeAngle(normalized_state[2]);
   normalized_state[3] = NormalizeAngle(normalized_state[3]);
 
   return normalized_state;
 }
 
+MatrixXd TricycleModel::ComputeStateJacobian(
+    const State& state, const ControlInput& control_input) const {
+  // The fixed size conversions check the dimensions of the arguments.
+  return ComputeStateJacobian(StateType(state),
+                              ControlInputType(control_input));
+}
+
+MatrixXd TricycleModel::ComputeControlJacobian(
+    const State& state, const ControlInput& control_input) const {
+  return ComputeControlJacobian(StateType(state),
+                                ControlInputType(control_input));
+}
+
+TricycleModel::StateJacobianType TricycleModel::ComputeStateJacobian(
+    const StateType& state, const ControlInputType& control_input) const {
+  const double theta = state[2];
+  const double alpha = state[3];
+  const double speed = control_input[0];
+
+  StateJacobianType state_jacobian = StateJacobianType::Zero();
+  state_jacobian(0, 2) = -speed * cos(alpha) * sin(theta);
+  state_jacobian(1, 2) = speed * cos(alpha) * cos(theta);
+  state_jacobian(0, 3) = -speed * sin(alpha) * cos(theta);
+  state_jacobian(1, 3) = -speed * sin(alpha) * sin(theta);
+  state_jacobian(2, 3) = speed * cos(alpha) / length;
+
+  return state_jacobian;
+}
+
+TricycleModel::ControlJacobianType TricycleModel::ComputeControlJacobian(
+    const StateType& state, const ControlInputType&) const {
+  const double theta = state[2];
+  const double alpha = state[3];
+
+  // The derivative is linear in the control input, so this is G(x).
+  ControlJacobianType control_jacobian;
+  control_jacobian << cos(alpha) * cos(theta), 0, cos(alpha) * sin(theta), 0,
+      (1. / length) * sin(alpha), 0, 0, 1;
+
+  return control_jacobian;
+}
+
+MatrixXd TricycleModel::ComputeStateDerivativeBatch(
+    const MatrixXd& states, const MatrixXd& control_inputs) const {
+  MatrixXd derivatives(states.rows(), 4);
+  ComputeStateDerivativeBatch(states, control_inputs, derivatives);
+
+  return derivatives;
+}
+
+void TricycleModel::ComputeStateDerivativeBatch(const MatrixXd& states,
+                                                const MatrixXd& control_inputs,
+                                                MatrixXd& derivatives) const {
+  RequireBatchDimensions(states, control_inputs);
+  derivatives.resize(states.rows(), 4);
+
+  const auto theta = states.col(2).array();
+  const auto alpha = states.col(3).array();
+  const auto speed = control_inputs.col(0).array();
+
+  // Each derivative component is computed as an array operation over the
+  // columns, which Eigen vectorizes.
+  derivatives.col(0).array() = speed * alpha.cos() * theta.cos();
+  derivatives.col(1).array() = speed * alpha.cos() * theta.sin();
+  derivatives.col(2).array() = speed * alpha.sin() / length;
+  derivatives.col(3) = control_inputs.col(1);
+}
+
+bool TricycleModel::HasExactStep() const { return true; }
+
+State TricycleModel::ExactStep(const State& state,
+                               const ControlInput& control_input,
+                               const double dt) const {
+  // The fixed size conversions check the dimensions of the arguments.
+  return ExactStep(StateType(state), ControlInputType(control_input), dt)
+      .ToState();
+}
+
+void TricycleModel::ExactStep(const State& state,
+                              const ControlInput& control_input,
+                              const double dt, State& updated_state) const {
+  ExactStep(StateType(state), ControlInputType(control_input), dt)
+      .CopyTo(updated_state);
+}
+
+TricycleModel::StateType TricycleModel::ExactStep(
+    const StateType& state, const ControlInputType& control_input,
+    const double dt) const {
+  const double theta = state[2];
+  const double alpha = state[3];
+  const double speed = control_input[0];
+  const double steering_rate = control_input[1];
+
+  StateType updated_state = state;
+  updated_state[3] = alpha + steering_rate * dt;
+
+  if (steering_rate == 0.) {
+    // Constant steering angle, which is a circular arc. Only the component of
+    // the front wheel velocity along the heading moves the robot forward.
+    const double heading_change = speed * sin(alpha) * dt / length;
+    updated_state.get_data_ref().head<2>() += ComputeArcDisplacement(
+        theta, speed * cos(alpha) * dt, heading_change);
+    updated_state[2] += heading_change;
+
+    return updated_state;
+  }
+
+  // For a constant steering rate w, the heading is given by
+  // theta(t) = theta + (v / (l * w)) * (cos(alpha) - cos(alpha + w * t)),
+  // which is written in terms of sines to stay accurate for small steering
+  // rates. The position has no closed form and is computed through quadrature
+  // instead.
+  auto heading = [&](const double t) {
+    const double half_angle = 0.5 * steering_rate * t;
+    return theta + (2. * speed / (length * steering_rate)) *
+                       sin(alpha + half_angle) * sin(half_angle);
+  };
+  auto linear_velocity = [&](const double t) {
+    return speed * cos(alpha + steering_rate * t);
+  };
+
+  // Both the heading and the linear velocity vary with the steering angle.
+  const double max_angle_change =
+      max(fabs(speed * dt) / length, fabs(steering_rate * dt));
+  const int num_intervals =
+      max(1, static_cast<int>(ceil(max_angle_change / (M_PI / 4))));
+
+  updated_state.get_data_ref().head<2>() += ComputeQuadratureDisplacement(
+      linear_velocity, heading, dt, num_intervals);
+  updated_state[2] = heading(dt);
+
+  return updated_state;
+}
+
 Footprint TricycleModel::DefaultFootprint() const {
   // Default rounded rectangle footprint.
   // Buffer lengths that defines how much the footprint extends out of the frame
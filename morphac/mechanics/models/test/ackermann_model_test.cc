@@ -5,8 +5,11 @@
 
 namespace {
 
+using std::cos;
+using std::log;
 using std::vector;
 
+using Eigen::MatrixXd;
 using Eigen::VectorXd;
 
 using morphac::constructs::ControlInput;
@@ -178,6 +181,189 @@ TEST_F(AckermannModelTest, StateNormalization) {
   ASSERT_TRUE(ackermann_model.NormalizeState(state3) == normalized_state3);
 }
 
+TEST_F(AckermannModelTest, FixedSizeComputation) {
+  using StateType = AckermannModel::StateType;
+  using ControlInputType = AckermannModel::ControlInputType;
+
+  AckermannModel ackermann_model{1.5, 2.3};
+  State state({1., -2., 7., 0.3}, {});
+  ControlInput control_input({0.5, -0.3});
+
+  // The fixed size overloads must give the same results as the dynamic ones.
+  StateType derivative = ackermann_model.ComputeStateDerivative(
+      StateType(state), ControlInputType(control_input));
+  ASSERT_TRUE(derivative.ToState() ==
+              ackermann_model.ComputeStateDerivative(state, control_input));
+
+  State state_to_normalize({0, 0, 2 * M_PI, 4 * M_PI / 3.}, {});
+  StateType normalized_state =
+      ackermann_model.NormalizeState(StateType(state_to_normalize));
+  State expected_state({0, 0, 0, -2 * M_PI / 3.}, {});
+  ASSERT_TRUE(normalized_state.ToState() == expected_state);
+
+  // Converting states of the wrong dimensions must throw an exception.
+  ASSERT_THROW(StateType(State(2, 0)), std::invalid_argument);
+  ASSERT_THROW(ControlInputType(ControlInput(5)), std::invalid_argument);
+}
+
+TEST_F(AckermannModelTest, BatchComputation) {
+  AckermannModel ackermann_model{1.5, 2.3};
+  const int num_states = 50;
+
+  MatrixXd states = MatrixXd::Random(num_states, 4);
+  // Keeping the steering angles valid.
+  states.col(3) *= 1.5;
+  MatrixXd control_inputs = MatrixXd::Random(num_states, 2);
+
+  // Each row must match the single state computation.
+  MatrixXd derivatives =
+      ackermann_model.ComputeStateDerivativeBatch(states, control_inputs);
+  ASSERT_EQ(derivatives.rows(), num_states);
+  ASSERT_EQ(derivatives.cols(), 4);
+  for (int i = 0; i < num_states; ++i) {
+    State derivative = ackermann_model.ComputeStateDerivative(
+        State(states.row(i).transpose(), VectorXd()),
+        ControlInput(control_inputs.row(i).transpose()));
+    ASSERT_TRUE(derivatives.row(i).transpose().isApprox(derivative.get_data()));
+  }
+
+  // The in place variant resizes the derivatives if required.
+  MatrixXd in_place_derivatives;
+  ackermann_model.ComputeStateDerivativeBatch(states, control_inputs,
+                                              in_place_derivatives);
+  ASSERT_TRUE(in_place_derivatives.isApprox(derivatives));
+
+  // Invalid dimensions.
+  ASSERT_THROW(ackermann_model.ComputeStateDerivativeBatch(
+                   MatrixXd::Zero(num_states, 5), control_inputs),
+               std::invalid_argument);
+  ASSERT_THROW(ackermann_model.ComputeStateDerivativeBatch(
+                   states, MatrixXd::Zero(num_states, 3)),
+               std::invalid_argument);
+  ASSERT_THROW(ackermann_model.ComputeStateDerivativeBatch(
+                   states, MatrixXd::Zero(num_states + 1, 2)),
+               std::invalid_argument);
+
+  // The steering angles must be valid.
+  states(7, 3) = M_PI / 2;
+  ASSERT_THROW(
+      ackermann_model.ComputeStateDerivativeBatch(states, control_inputs),
+      std::invalid_argument);
+}
+
+TEST_F(AckermannModelTest, Jacobians) {
+  AckermannModel ackermann_model{1.5, 2.3};
+
+  // The closed form Jacobians must match the finite difference ones of the
+  // default implementation.
+  for (int i = 0; i < 10; ++i) {
+    State state(VectorXd::Random(4), VectorXd());
+    ControlInput control_input(VectorXd::Random(2));
+
+    MatrixXd state_jacobian =
+        ackermann_model.ComputeStateJacobian(state, control_input);
+    MatrixXd control_jacobian =
+        ackermann_model.ComputeControlJacobian(state, control_input);
+    ASSERT_EQ(state_jacobian.rows(), 4);
+    ASSERT_EQ(state_jacobian.cols(), 4);
+    ASSERT_EQ(control_jacobian.rows(), 4);
+    ASSERT_EQ(control_jacobian.cols(), 2);
+    MatrixXd numerical_state_jacobian =
+        ackermann_model.KinematicModel::ComputeStateJacobian(state,
+                                                             control_input);
+    MatrixXd numerical_control_jacobian =
+        ackermann_model.KinematicModel::ComputeControlJacobian(state,
+                                                               control_input);
+    ASSERT_LT((state_jacobian - numerical_state_jacobian).norm(), 1e-6);
+    ASSERT_LT((control_jacobian - numerical_control_jacobian).norm(), 1e-6);
+
+    // The fixed size variants must match.
+    AckermannModel::StateType fixed_state(state);
+    AckermannModel::ControlInputType fixed_control_input(control_input);
+    ASSERT_TRUE(
+        ackermann_model.ComputeStateJacobian(fixed_state, fixed_control_input)
+            .isApprox(state_jacobian));
+    ASSERT_TRUE(
+        ackermann_model.ComputeControlJacobian(fixed_state, fixed_control_input)
+            .isApprox(control_jacobian));
+  }
+
+  // The steering angle must lie between -pi / 2 and pi / 2.
+  ASSERT_THROW(ackermann_model.ComputeStateJacobian(
+                   State({0, 0, 0, M_PI / 2}, {}), ControlInput({1, 0})),
+               std::invalid_argument);
+  ASSERT_THROW(ackermann_model.ComputeControlJacobian(
+                   State({0, 0, 0, -M_PI}, {}), ControlInput({1, 0})),
+               std::invalid_argument);
+
+  // Invalid dimensions.
+  ASSERT_THROW(ackermann_model.ComputeStateJacobian(State(3, 0),
+                                                    ControlInput(2)),
+               std::invalid_argument);
+  ASSERT_THROW(ackermann_model.ComputeControlJacobian(State(4, 0),
+                                                      ControlInput(3)),
+               std::invalid_argument);
+}
+
+TEST_F(AckermannModelTest, ExactStep) {
+  AckermannModel ackermann_model{1., 2.};
+  ASSERT_TRUE(ackermann_model.HasExactStep());
+
+  // Going straight.
+  State updated_state = ackermann_model.ExactStep(
+      State({1., 2., M_PI / 2, 0.}, {}), ControlInput({2., 0.}), 1.5);
+  ASSERT_TRUE(updated_state == State({1., 5., M_PI / 2, 0.}, {}));
+
+  // Constant steering angle of pi / 4, which is a circle of radius 2. A
+  // quarter turn to the left.
+  updated_state = ackermann_model.ExactStep(
+      State({0., 0., 0., M_PI / 4}, {}), ControlInput({2., 0.}), M_PI / 2);
+  ASSERT_TRUE(updated_state == State({2., 2., M_PI / 2, M_PI / 4}, {}));
+
+  // Steering at a constant rate. The heading has a closed form.
+  const double speed = 1.5, steering_rate = 0.4, dt = 2.;
+  State state({1., -1., 0.3, -0.2}, {});
+  updated_state = ackermann_model.ExactStep(
+      state, ControlInput({speed, steering_rate}), dt);
+  ASSERT_NEAR(updated_state[3], -0.2 + steering_rate * dt, 1e-12);
+  ASSERT_NEAR(updated_state[2],
+              0.3 + (speed / (2. * steering_rate)) *
+                        log(cos(-0.2) / cos(-0.2 + steering_rate * dt)),
+              1e-12);
+
+  // Stepping twice must give the same result as stepping once.
+  State half_state = ackermann_model.ExactStep(
+      state, ControlInput({speed, steering_rate}), dt / 2);
+  ASSERT_TRUE(ackermann_model.ExactStep(
+                  half_state, ControlInput({speed, steering_rate}), dt / 2) ==
+              updated_state);
+
+  // A tiny steering rate must be close to the constant steering arc.
+  ASSERT_TRUE(
+      ackermann_model.ExactStep(state, ControlInput({speed, 1e-12}), dt) ==
+      ackermann_model.ExactStep(state, ControlInput({speed, 0.}), dt));
+
+  // The in place variant may alias the state.
+  State expected_state = updated_state;
+  ackermann_model.ExactStep(state, ControlInput({speed, steering_rate}), dt,
+                            state);
+  ASSERT_TRUE(state == expected_state);
+
+  // The steering angle must be valid throughout the step.
+  ASSERT_THROW(ackermann_model.ExactStep(State({0., 0., 0., M_PI / 2}, {}),
+                                         ControlInput({1., 0.}), 0.1),
+               std::invalid_argument);
+  ASSERT_THROW(ackermann_model.ExactStep(State({0., 0., 0., 1.}, {}),
+                                         ControlInput({1., 1.}), 1.),
+               std::invalid_argument);
+
+  // Invalid dimensions.
+  ASSERT_THROW(ackermann_model.ExactStep(State(3, 0), ControlInput(2), 0.1),
+               std::invalid_argument);
+  ASSERT_THROW(ackermann_model.ExactStep(State(4, 0), ControlInput(1), 0.1),
+               std::invalid_argument);
+}
+
 TEST_F(AckermannModelTest, DefaultFootprint) {
   AckermannModel ackermann_model{2., 1.};
 
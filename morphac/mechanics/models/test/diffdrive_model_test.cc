@@ -5,6 +5,8 @@
 
 namespace {
 
+using std::sqrt;
+
 using Eigen::MatrixXd;
 using Eigen::VectorXd;
 
@@ -142,6 +144,163 @@ TEST_F(DiffdriveModelTest, StateNormalization) {
   ASSERT_TRUE(diffdrive_model.NormalizeState(state3) == normalized_state3);
 }
 
+TEST_F(DiffdriveModelTest, FixedSizeComputation) {
+  using StateType = DiffdriveModel::StateType;
+  using ControlInputType = DiffdriveModel::ControlInputType;
+
+  DiffdriveModel diffdrive_model{1.5, 2.3};
+  State state({1., -2., 7.}, {});
+  ControlInput control_input({0.5, -0.3});
+
+  // The fixed size overloads must give the same results as the dynamic ones.
+  StateType derivative = diffdrive_model.ComputeStateDerivative(
+      StateType(state), ControlInputType(control_input));
+  ASSERT_TRUE(derivative.ToState() ==
+              diffdrive_model.ComputeStateDerivative(state, control_input));
+
+  State state_to_normalize({0, 0, 2 * M_PI + 4 * M_PI / 3.}, {});
+  StateType normalized_state =
+      diffdrive_model.NormalizeState(StateType(state_to_normalize));
+  State expected_state({0, 0, -2 * M_PI / 3.}, {});
+  ASSERT_TRUE(normalized_state.ToState() == expected_state);
+
+  // Converting states of the wrong dimensions must throw an exception.
+  ASSERT_THROW(StateType(State(2, 0)), std::invalid_argument);
+  ASSERT_THROW(ControlInputType(ControlInput(5)), std::invalid_argument);
+}
+
+TEST_F(DiffdriveModelTest, BatchComputation) {
+  DiffdriveModel diffdrive_model{1.5, 2.3};
+  const int num_states = 50;
+
+  MatrixXd states = MatrixXd::Random(num_states, 3);
+  MatrixXd control_inputs = MatrixXd::Random(num_states, 2);
+
+  // Each row must match the single state computation.
+  MatrixXd derivatives =
+      diffdrive_model.ComputeStateDerivativeBatch(states, control_inputs);
+  ASSERT_EQ(derivatives.rows(), num_states);
+  ASSERT_EQ(derivatives.cols(), 3);
+  for (int i = 0; i < num_states; ++i) {
+    State derivative = diffdrive_model.ComputeStateDerivative(
+        State(states.row(i).transpose(), VectorXd()),
+        ControlInput(control_inputs.row(i).transpose()));
+    ASSERT_TRUE(derivatives.row(i).transpose().isApprox(derivative.get_data()));
+  }
+
+  // The in place variant resizes the derivatives if required.
+  MatrixXd in_place_derivatives;
+  diffdrive_model.ComputeStateDerivativeBatch(states, control_inputs,
+                                              in_place_derivatives);
+  ASSERT_TRUE(in_place_derivatives.isApprox(derivatives));
+
+  // Invalid dimensions.
+  ASSERT_THROW(diffdrive_model.ComputeStateDerivativeBatch(
+                   MatrixXd::Zero(num_states, 4), control_inputs),
+               std::invalid_argument);
+  ASSERT_THROW(diffdrive_model.ComputeStateDerivativeBatch(
+                   states, MatrixXd::Zero(num_states, 3)),
+               std::invalid_argument);
+  ASSERT_THROW(diffdrive_model.ComputeStateDerivativeBatch(
+                   states, MatrixXd::Zero(num_states + 1, 2)),
+               std::invalid_argument);
+}
+
+TEST_F(DiffdriveModelTest, Jacobians) {
+  DiffdriveModel diffdrive_model{0.5, 1.2};
+
+  // The closed form Jacobians must match the finite difference ones of the
+  // default implementation.
+  for (int i = 0; i < 10; ++i) {
+    State state(VectorXd::Random(3), VectorXd());
+    ControlInput control_input(VectorXd::Random(2));
+
+    MatrixXd state_jacobian =
+        diffdrive_model.ComputeStateJacobian(state, control_input);
+    MatrixXd control_jacobian =
+        diffdrive_model.ComputeControlJacobian(state, control_input);
+    ASSERT_EQ(state_jacobian.rows(), 3);
+    ASSERT_EQ(state_jacobian.cols(), 3);
+    ASSERT_EQ(control_jacobian.rows(), 3);
+    ASSERT_EQ(control_jacobian.cols(), 2);
+    MatrixXd numerical_state_jacobian =
+        diffdrive_model.KinematicModel::ComputeStateJacobian(state,
+                                                             control_input);
+    MatrixXd numerical_control_jacobian =
+        diffdrive_model.KinematicModel::ComputeControlJacobian(state,
+                                                               control_input);
+    ASSERT_LT((state_jacobian - numerical_state_jacobian).norm(), 1e-6);
+    ASSERT_LT((control_jacobian - numerical_control_jacobian).norm(), 1e-6);
+
+    // The fixed size variants must match.
+    DiffdriveModel::StateType fixed_state(state);
+    DiffdriveModel::ControlInputType fixed_control_input(control_input);
+    ASSERT_TRUE(
+        diffdrive_model.ComputeStateJacobian(fixed_state, fixed_control_input)
+            .isApprox(state_jacobian));
+    ASSERT_TRUE(
+        diffdrive_model.ComputeControlJacobian(fixed_state, fixed_control_input)
+            .isApprox(control_jacobian));
+  }
+
+  // Closed form values.
+  MatrixXd expected_state_jacobian(3, 3);
+  expected_state_jacobian << 0, 0, -2 * sin(M_PI / 6), 0, 0, 2 * cos(M_PI / 6),
+      0, 0, 0;
+  ASSERT_TRUE(diffdrive_model
+                  .ComputeStateJacobian(State({1, 2, M_PI / 6}, {}),
+                                        ControlInput({3.2, 4.8}))
+                  .isApprox(expected_state_jacobian));
+
+  // Invalid dimensions.
+  ASSERT_THROW(diffdrive_model.ComputeStateJacobian(State(4, 0),
+                                                    ControlInput(2)),
+               std::invalid_argument);
+  ASSERT_THROW(diffdrive_model.ComputeControlJacobian(State(3, 0),
+                                                      ControlInput(3)),
+               std::invalid_argument);
+}
+
+TEST_F(DiffdriveModelTest, ExactStep) {
+  DiffdriveModel diffdrive_model{1., 2.};
+  ASSERT_TRUE(diffdrive_model.HasExactStep());
+
+  // Going straight.
+  State updated_state = diffdrive_model.ExactStep(
+      State({1., 2., M_PI / 4}, {}), ControlInput({1., 1.}), 2.);
+  ASSERT_TRUE(updated_state ==
+              State({1. + sqrt(2.), 2. + sqrt(2.), M_PI / 4}, {}));
+
+  // Turning along a circle of radius 2 (Linear velocity = 2, angular velocity
+  // = 1). A quarter turn to the left.
+  updated_state = diffdrive_model.ExactStep(State({0., 0., 0.}, {}),
+                                            ControlInput({1., 3.}), M_PI / 2);
+  ASSERT_TRUE(updated_state == State({2., 2., M_PI / 2}, {}));
+
+  // Full circle back to the start, with the heading wound up.
+  updated_state = diffdrive_model.ExactStep(State({0., 0., 0.}, {}),
+                                            ControlInput({1., 3.}), 2 * M_PI);
+  ASSERT_NEAR(updated_state[0], 0., 1e-12);
+  ASSERT_NEAR(updated_state[1], 0., 1e-12);
+  ASSERT_NEAR(updated_state[2], 2 * M_PI, 1e-12);
+
+  // Turning in place.
+  updated_state = diffdrive_model.ExactStep(State({1., 1., 0.}, {}),
+                                            ControlInput({-1., 1.}), 0.5);
+  ASSERT_TRUE(updated_state == State({1., 1., 0.5}, {}));
+
+  // The in place variant may alias the state.
+  State state({0., 0., 0.}, {});
+  diffdrive_model.ExactStep(state, ControlInput({1., 3.}), M_PI / 2, state);
+  ASSERT_TRUE(state == State({2., 2., M_PI / 2}, {}));
+
+  // Invalid dimensions.
+  ASSERT_THROW(diffdrive_model.ExactStep(State(2, 0), ControlInput(2), 0.1),
+               std::invalid_argument);
+  ASSERT_THROW(diffdrive_model.ExactStep(State(3, 0), ControlInput(3), 0.1),
+               std::invalid_argument);
+}
+
 TEST_F(DiffdriveModelTest, DefaultFootprint) {
   DiffdriveModel diffdrive_model{1, 2};
 
@@ -5,6 +5,7 @@
 
 namespace {
 
+using Eigen::MatrixXd;
 using Eigen::VectorXd;
 
 using morphac::constructs::ControlInput;
@@ -93,6 +94,145 @@ TEST_F(DubinModelTest, StateNormalization) {
   ASSERT_TRUE(dubin_model.NormalizeState(state3) == normalized_state3);
 }
 
+TEST_F(DubinModelTest, FixedSizeComputation) {
+  using StateType = DubinModel::StateType;
+  using ControlInputType = DubinModel::ControlInputType;
+
+  DubinModel dubin_model{2.5};
+  State state({1., -2., 7.}, {});
+  ControlInput control_input({0.4});
+
+  // The fixed size overloads must give the same results as the dynamic ones.
+  StateType derivative = dubin_model.ComputeStateDerivative(
+      StateType(state), ControlInputType(control_input));
+  ASSERT_TRUE(derivative.ToState() ==
+              dubin_model.ComputeStateDerivative(state, control_input));
+
+  State state_to_normalize({0, 0, 2 * M_PI + 4 * M_PI / 3.}, {});
+  StateType normalized_state =
+      dubin_model.NormalizeState(StateType(state_to_normalize));
+  State expected_state({0, 0, -2 * M_PI / 3.}, {});
+  ASSERT_TRUE(normalized_state.ToState() == expected_state);
+
+  // Converting states of the wrong dimensions must throw an exception.
+  ASSERT_THROW(StateType(State(2, 0)), std::invalid_argument);
+  ASSERT_THROW(ControlInputType(ControlInput(5)), std::invalid_argument);
+}
+
+TEST_F(DubinModelTest, BatchComputation) {
+  DubinModel dubin_model{1.2};
+  const int num_states = 50;
+
+  MatrixXd states = MatrixXd::Random(num_states, 3);
+  MatrixXd control_inputs = MatrixXd::Random(num_states, 1);
+
+  // Each row must match the single state computation.
+  MatrixXd derivatives =
+      dubin_model.ComputeStateDerivativeBatch(states, control_inputs);
+  ASSERT_EQ(derivatives.rows(), num_states);
+  ASSERT_EQ(derivatives.cols(), 3);
+  for (int i = 0; i < num_states; ++i) {
+    State derivative = dubin_model.ComputeStateDerivative(
+        State(states.row(i).transpose(), VectorXd()),
+        ControlInput(control_inputs.row(i).transpose()));
+    ASSERT_TRUE(derivatives.row(i).transpose().isApprox(derivative.get_data()));
+  }
+
+  // The in place variant resizes the derivatives if required.
+  MatrixXd in_place_derivatives;
+  dubin_model.ComputeStateDerivativeBatch(states, control_inputs,
+                                          in_place_derivatives);
+  ASSERT_TRUE(in_place_derivatives.isApprox(derivatives));
+
+  // Invalid dimensions.
+  ASSERT_THROW(dubin_model.ComputeStateDerivativeBatch(
+                   MatrixXd::Zero(num_states, 4), control_inputs),
+               std::invalid_argument);
+  ASSERT_THROW(dubin_model.ComputeStateDerivativeBatch(
+                   states, MatrixXd::Zero(num_states, 2)),
+               std::invalid_argument);
+  ASSERT_THROW(dubin_model.ComputeStateDerivativeBatch(
+                   states, MatrixXd::Zero(num_states + 1, 1)),
+               std::invalid_argument);
+}
+
+TEST_F(DubinModelTest, Jacobians) {
+  DubinModel dubin_model{1.5};
+
+  // The closed form Jacobians must match the finite difference ones of the
+  // default implementation.
+  for (int i = 0; i < 10; ++i) {
+    State state(VectorXd::Random(3), VectorXd());
+    ControlInput control_input(VectorXd::Random(1));
+
+    MatrixXd state_jacobian =
+        dubin_model.ComputeStateJacobian(state, control_input);
+    MatrixXd control_jacobian =
+        dubin_model.ComputeControlJacobian(state, control_input);
+    ASSERT_EQ(state_jacobian.rows(), 3);
+    ASSERT_EQ(state_jacobian.cols(), 3);
+    ASSERT_EQ(control_jacobian.rows(), 3);
+    ASSERT_EQ(control_jacobian.cols(), 1);
+    MatrixXd numerical_state_jacobian =
+        dubin_model.KinematicModel::ComputeStateJacobian(state, control_input);
+    MatrixXd numerical_control_jacobian =
+        dubin_model.KinematicModel::ComputeControlJacobian(state,
+                                                           control_input);
+    ASSERT_LT((state_jacobian - numerical_state_jacobian).norm(), 1e-6);
+    ASSERT_LT((control_jacobian - numerical_control_jacobian).norm(), 1e-6);
+
+    // The fixed size variants must match.
+    DubinModel::StateType fixed_state(state);
+    DubinModel::ControlInputType fixed_control_input(control_input);
+    ASSERT_TRUE(
+        dubin_model.ComputeStateJacobian(fixed_state, fixed_control_input)
+            .isApprox(state_jacobian));
+    ASSERT_TRUE(
+        dubin_model.ComputeControlJacobian(fixed_state, fixed_control_input)
+            .isApprox(control_jacobian));
+  }
+
+  // Closed form values.
+  MatrixXd expected_control_jacobian(3, 1);
+  expected_control_jacobian << 0, 0, 1;
+  ASSERT_TRUE(dubin_model
+                  .ComputeControlJacobian(State({1, 2, M_PI / 6}, {}),
+                                          ControlInput({0.3}))
+                  .isApprox(expected_control_jacobian));
+
+  // Invalid dimensions.
+  ASSERT_THROW(dubin_model.ComputeStateJacobian(State(4, 0), ControlInput(1)),
+               std::invalid_argument);
+  ASSERT_THROW(dubin_model.ComputeControlJacobian(State(3, 0), ControlInput(2)),
+               std::invalid_argument);
+}
+
+TEST_F(DubinModelTest, ExactStep) {
+  DubinModel dubin_model{2.};
+  ASSERT_TRUE(dubin_model.HasExactStep());
+
+  // Going straight.
+  State updated_state = dubin_model.ExactStep(State({1., 2., -M_PI / 2}, {}),
+                                              ControlInput({0.}), 1.5);
+  ASSERT_TRUE(updated_state == State({1., -1., -M_PI / 2}, {}));
+
+  // A quarter turn to the right along a circle of radius 2.
+  updated_state = dubin_model.ExactStep(State({0., 0., 0.}, {}),
+                                        ControlInput({-1.}), M_PI / 2);
+  ASSERT_TRUE(updated_state == State({2., -2., -M_PI / 2}, {}));
+
+  // The in place variant may alias the state.
+  State state({0., 0., 0.}, {});
+  dubin_model.ExactStep(state, ControlInput({-1.}), M_PI / 2, state);
+  ASSERT_TRUE(state == State({2., -2., -M_PI / 2}, {}));
+
+  // Invalid dimensions.
+  ASSERT_THROW(dubin_model.ExactStep(State(4, 0), ControlInput(1), 0.1),
+               std::invalid_argument);
+  ASSERT_THROW(dubin_model.ExactStep(State(3, 0), ControlInput(2), 0.1),
+               std::invalid_argument);
+}
+
 TEST_F(DubinModelTest, DefaultFootprint) {
   DubinModel dubin_model{1};
 
@@ -6,6 +6,7 @@
 
 namespace {
 
+using Eigen::MatrixXd;
 using Eigen::VectorXd;
 
 using morphac::constructs::ControlInput;
@@ -113,6 +114,68 @@ TEST_F(KinematicModelTest, StateNormalization) {
   ASSERT_TRUE(model.NormalizeState(state) == state);
 }
 
+TEST_F(KinematicModelTest, Jacobians) {
+  // f(x, u) = x * a * u - x, so the Jacobians are diagonal.
+  CustomKinematicModel model{4, 2, 6, 2.};
+  State state({1, 2, 3, 4}, {5, 6});
+  ControlInput control_input({-1, 0.5, 2, 0, 1, 3});
+
+  MatrixXd state_jacobian = model.ComputeStateJacobian(state, control_input);
+  MatrixXd control_jacobian =
+      model.ComputeControlJacobian(state, control_input);
+
+  MatrixXd expected_state_jacobian =
+      (2 * control_input.get_data().array() - 1).matrix().asDiagonal();
+  MatrixXd expected_control_jacobian = (2 * state.get_data()).asDiagonal();
+  ASSERT_TRUE(state_jacobian.isApprox(expected_state_jacobian, 1e-8));
+  ASSERT_TRUE(control_jacobian.isApprox(expected_control_jacobian, 1e-8));
+
+  // Invalid dimensions.
+  ASSERT_THROW(model.ComputeStateJacobian(State(4, 2), ControlInput(5)),
+               std::invalid_argument);
+}
+
+TEST_F(KinematicModelTest, BatchComputation) {
+  // The default implementation must match the single state computation.
+  CustomKinematicModel model{4, 2, 6, 2.};
+  const int num_states = 10;
+
+  MatrixXd states = MatrixXd::Random(num_states, 6);
+  MatrixXd control_inputs = MatrixXd::Random(num_states, 6);
+
+  MatrixXd derivatives =
+      model.ComputeStateDerivativeBatch(states, control_inputs);
+  ASSERT_EQ(derivatives.rows(), num_states);
+  ASSERT_EQ(derivatives.cols(), 6);
+  for (int i = 0; i < num_states; ++i) {
+    VectorXd state_data = states.row(i).transpose();
+    State derivative = model.ComputeStateDerivative(
+        State(state_data.head(4), state_data.tail(2)),
+        ControlInput(control_inputs.row(i).transpose()));
+    ASSERT_TRUE(derivatives.row(i).transpose().isApprox(derivative.get_data()));
+  }
+
+  // Invalid dimensions.
+  ASSERT_THROW(model.ComputeStateDerivativeBatch(MatrixXd::Zero(num_states, 5),
+                                                 control_inputs),
+               std::invalid_argument);
+  ASSERT_THROW(
+      model.ComputeStateDerivativeBatch(states, MatrixXd::Zero(num_states, 5)),
+      std::invalid_argument);
+}
+
+TEST_F(KinematicModelTest, ExactStep) {
+  // The model doesn't override the exact step, so it isn't available.
+  CustomKinematicModel model{4, 2, 2, 0};
+  State state({1, 2, 3, 4}, {5, 6});
+  ControlInput control_input({1, 2});
+
+  ASSERT_FALSE(model.HasExactStep());
+  ASSERT_THROW(model.ExactStep(state, control_input, 0.1), std::logic_error);
+  ASSERT_THROW(model.ExactStep(state, control_input, 0.1, state),
+               std::logic_error);
+}
+
 TEST_F(KinematicModelTest, DefaultFootprint) {
   CustomKinematicModel model{4, 2, 2, 2.};
 
@@ -5,6 +5,10 @@
 
 namespace {
 
+using std::cos;
+using std::sqrt;
+
+using Eigen::MatrixXd;
 using Eigen::VectorXd;
 
 using morphac::constructs::ControlInput;
@@ -146,6 +150,176 @@ TEST_F(TricycleModelTest, StateNormalization) {
   ASSERT_TRUE(tricycle_model.NormalizeState(state3) == normalized_state3);
 }
 
+TEST_F(TricycleModelTest, FixedSizeComputation) {
+  using StateType = TricycleModel::StateType;
+  using ControlInputType = TricycleModel::ControlInputType;
+
+  TricycleModel tricycle_model{1.5, 2.3};
+  State state({1., -2., 7., 0.3}, {});
+  ControlInput control_input({0.5, -0.3});
+
+  // The fixed size overloads must give the same results as the dynamic ones.
+  StateType derivative = tricycle_model.ComputeStateDerivative(
+      StateType(state), ControlInputType(control_input));
+  ASSERT_TRUE(derivative.ToState() ==
+              tricycle_model.ComputeStateDerivative(state, control_input));
+
+  State state_to_normalize({0, 0, 2 * M_PI, 4 * M_PI / 3.}, {});
+  StateType normalized_state =
+      tricycle_model.NormalizeState(StateType(state_to_normalize));
+  State expected_state({0, 0, 0, -2 * M_PI / 3.}, {});
+  ASSERT_TRUE(normalized_state.ToState() == expected_state);
+
+  // Converting states of the wrong dimensions must throw an exception.
+  ASSERT_THROW(StateType(State(2, 0)), std::invalid_argument);
+  ASSERT_THROW(ControlInputType(ControlInput(5)), std::invalid_argument);
+}
+
+TEST_F(TricycleModelTest, BatchComputation) {
+  TricycleModel tricycle_model{1.5, 2.3};
+  const int num_states = 50;
+
+  MatrixXd states = MatrixXd::Random(num_states, 4);
+  MatrixXd control_inputs = MatrixXd::Random(num_states, 2);
+
+  // Each row must match the single state computation.
+  MatrixXd derivatives =
+      tricycle_model.ComputeStateDerivativeBatch(states, control_inputs);
+  ASSERT_EQ(derivatives.rows(), num_states);
+  ASSERT_EQ(derivatives.cols(), 4);
+  for (int i = 0; i < num_states; ++i) {
+    State derivative = tricycle_model.ComputeStateDerivative(
+        State(states.row(i).transpose(), VectorXd()),
+        ControlInput(control_inputs.row(i).transpose()));
+    ASSERT_TRUE(derivatives.row(i).transpose().isApprox(derivative.get_data()));
+  }
+
+  // The in place variant resizes the derivatives if required.
+  MatrixXd in_place_derivatives;
+  tricycle_model.ComputeStateDerivativeBatch(states, control_inputs,
+                                             in_place_derivatives);
+  ASSERT_TRUE(in_place_derivatives.isApprox(derivatives));
+
+  // Invalid dimensions.
+  ASSERT_THROW(tricycle_model.ComputeStateDerivativeBatch(
+                   MatrixXd::Zero(num_states, 5), control_inputs),
+               std::invalid_argument);
+  ASSERT_THROW(tricycle_model.ComputeStateDerivativeBatch(
+                   states, MatrixXd::Zero(num_states, 3)),
+               std::invalid_argument);
+  ASSERT_THROW(tricycle_model.ComputeStateDerivativeBatch(
+                   states, MatrixXd::Zero(num_states + 1, 2)),
+               std::invalid_argument);
+}
+
+TEST_F(TricycleModelTest, Jacobians) {
+  TricycleModel tricycle_model{1.5, 2.3};
+
+  // The closed form Jacobians must match the finite difference ones of the
+  // default implementation.
+  for (int i = 0; i < 10; ++i) {
+    State state(VectorXd::Random(4), VectorXd());
+    ControlInput control_input(VectorXd::Random(2));
+
+    MatrixXd state_jacobian =
+        tricycle_model.ComputeStateJacobian(state, control_input);
+    MatrixXd control_jacobian =
+        tricycle_model.ComputeControlJacobian(state, control_input);
+    ASSERT_EQ(state_jacobian.rows(), 4);
+    ASSERT_EQ(state_jacobian.cols(), 4);
+    ASSERT_EQ(control_jacobian.rows(), 4);
+    ASSERT_EQ(control_jacobian.cols(), 2);
+    MatrixXd numerical_state_jacobian =
+        tricycle_model.KinematicModel::ComputeStateJacobian(state,
+                                                            control_input);
+    MatrixXd numerical_control_jacobian =
+        tricycle_model.KinematicModel::ComputeControlJacobian(state,
+                                                              control_input);
+    ASSERT_LT((state_jacobian - numerical_state_jacobian).norm(), 1e-6);
+    ASSERT_LT((control_jacobian - numerical_control_jacobian).norm(), 1e-6);
+
+    // The fixed size variants must match.
+    TricycleModel::StateType fixed_state(state);
+    TricycleModel::ControlInputType fixed_control_input(control_input);
+    ASSERT_TRUE(
+        tricycle_model.ComputeStateJacobian(fixed_state, fixed_control_input)
+            .isApprox(state_jacobian));
+    ASSERT_TRUE(
+        tricycle_model.ComputeControlJacobian(fixed_state, fixed_control_input)
+            .isApprox(control_jacobian));
+  }
+
+  // Closed form values when moving straight ahead.
+  MatrixXd expected_state_jacobian(4, 4);
+  expected_state_jacobian << 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2 / 2.3, 0, 0,
+      0, 0;
+  ASSERT_TRUE(tricycle_model
+                  .ComputeStateJacobian(State({1, 2, 0, 0}, {}),
+                                        ControlInput({2, 0.5}))
+                  .isApprox(expected_state_jacobian));
+
+  // Invalid dimensions.
+  ASSERT_THROW(tricycle_model.ComputeStateJacobian(State(3, 0),
+                                                   ControlInput(2)),
+               std::invalid_argument);
+  ASSERT_THROW(tricycle_model.ComputeControlJacobian(State(4, 0),
+                                                     ControlInput(3)),
+               std::invalid_argument);
+}
+
+TEST_F(TricycleModelTest, ExactStep) {
+  TricycleModel tricycle_model{1., 2.};
+  ASSERT_TRUE(tricycle_model.HasExactStep());
+
+  // Going straight.
+  State updated_state = tricycle_model.ExactStep(
+      State({1., 2., M_PI, 0.}, {}), ControlInput({2., 0.}), 1.5);
+  ASSERT_TRUE(updated_state == State({-2., 2., M_PI, 0.}, {}));
+
+  // Constant steering angle of pi / 6. The robot moves with a linear velocity
+  // of sqrt(3) and an angular velocity of 0.5, which is a circle of radius
+  // 2 * sqrt(3). A quarter turn to the left.
+  updated_state = tricycle_model.ExactStep(State({0., 0., 0., M_PI / 6}, {}),
+                                           ControlInput({2., 0.}), M_PI);
+  ASSERT_TRUE(updated_state ==
+              State({2 * sqrt(3.), 2 * sqrt(3.), M_PI / 2, M_PI / 6}, {}));
+
+  // Steering at a constant rate. The heading has a closed form.
+  const double speed = 1.5, steering_rate = -0.6, dt = 3.;
+  State state({1., -1., 0.3, 0.5}, {});
+  updated_state =
+      tricycle_model.ExactStep(state, ControlInput({speed, steering_rate}), dt);
+  ASSERT_NEAR(updated_state[3], 0.5 + steering_rate * dt, 1e-12);
+  ASSERT_NEAR(updated_state[2],
+              0.3 + (speed / (2. * steering_rate)) *
+                        (cos(0.5) - cos(0.5 + steering_rate * dt)),
+              1e-12);
+
+  // Stepping twice must give the same result as stepping once.
+  State half_state = tricycle_model.ExactStep(
+      state, ControlInput({speed, steering_rate}), dt / 2);
+  ASSERT_TRUE(tricycle_model.ExactStep(
+                  half_state, ControlInput({speed, steering_rate}), dt / 2) ==
+              updated_state);
+
+  // A tiny steering rate must be close to the constant steering arc.
+  ASSERT_TRUE(
+      tricycle_model.ExactStep(state, ControlInput({speed, 1e-12}), dt) ==
+      tricycle_model.ExactStep(state, ControlInput({speed, 0.}), dt));
+
+  // The in place variant may alias the state.
+  State expected_state = updated_state;
+  tricycle_model.ExactStep(state, ControlInput({speed, steering_rate}), dt,
+                           state);
+  ASSERT_TRUE(state == expected_state);
+
+  // Invalid dimensions.
+  ASSERT_THROW(tricycle_model.ExactStep(State(3, 0), ControlInput(2), 0.1),
+               std::invalid_argument);
+  ASSERT_THROW(tricycle_model.ExactStep(State(4, 0), ControlInput(1), 0.1),
+               std::invalid_argument);
+}
+
 TEST_F(TricycleModelTest, DefaultFootprint) {
   TricycleModel tricycle_model{2., 1.};
 
@@ -0,0 +1,67 @@
+#include <cmath>
+
+#include "benchmark/benchmark.h"
+
+#include "math/geometry/include/shapes.h"
+#include "robot/blueprint/include/footprint.h"
+
+namespace {
+
+using morphac::math::geometry::CircleShape;
+using morphac::math::geometry::RectangleShape;
+using morphac::math::geometry::RoundedRectangleShape;
+using morphac::math::geometry::TriangleShape;
+using morphac::robot::blueprint::Footprint;
+
+// Angular resolution that gives (roughly) the number of points in a full
+// circle given by the benchmark argument.
+double ComputeAngularResolution(const benchmark::State& benchmark_state) {
+  return 2 * M_PI / benchmark_state.range(0);
+}
+
+void BM_CreateCircularFootprint(benchmark::State& benchmark_state) {
+  const double angular_resolution = ComputeAngularResolution(benchmark_state);
+
+  for (auto _ : benchmark_state) {
+    Footprint footprint =
+        Footprint::CreateCircularFootprint(CircleShape{2.}, angular_resolution);
+    benchmark::DoNotOptimize(footprint);
+  }
+}
+
+void BM_CreateRectangularFootprint(benchmark::State& benchmark_state) {
+  for (auto _ : benchmark_state) {
+    Footprint footprint = Footprint::CreateRectangularFootprint(
+        RectangleShape{2., 1., 0.3});
+    benchmark::DoNotOptimize(footprint);
+  }
+}
+
+void BM_CreateRoundedRectangularFootprint(benchmark::State& benchmark_state) {
+  const double angular_resolution = ComputeAngularResolution(benchmark_state);
+
+  for (auto _ : benchmark_state) {
+    Footprint footprint = Footprint::CreateRoundedRectangularFootprint(
+        RoundedRectangleShape{2., 1., 0.3, 0.2}, angular_resolution);
+    benchmark::DoNotOptimize(footprint);
+  }
+}
+
+void BM_CreateTriangularFootprint(benchmark::State& benchmark_state) {
+  for (auto _ : benchmark_state) {
+    Footprint footprint =
+        Footprint::CreateTriangularFootprint(TriangleShape{2., 1., 0.3});
+    benchmark::DoNotOptimize(footprint);
+  }
+}
+
+BENCHMARK(BM_CreateCircularFootprint)->RangeMultiplier(16)->Range(16, 4096);
+BENCHMARK(BM_CreateRectangularFootprint);
+BENCHMARK(BM_CreateRoundedRectangularFootprint)
+    ->RangeMultiplier(16)
+    ->Range(16, 4096);
+BENCHMARK(BM_CreateTriangularFootprint);
+
+}  // namespace
+
+BENCHMARK_MAIN();
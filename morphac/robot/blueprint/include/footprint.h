@@ -21,6 +21,12 @@ class Footprint {
   // Copy assignment.
   Footprint& operator=(const Footprint& footprint) = default;
 
+  // Move constructor.
+  Footprint(Footprint&& footprint) noexcept = default;
+
+  // Move assignment.
+  Footprint& operator=(Footprint&& footprint) noexcept = default;
+
   const morphac::common::aliases::Points& get_data() const;
 
   // Footprint generating functions. Note that the coordinates are always with
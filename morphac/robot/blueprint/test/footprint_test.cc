@@ -67,6 +67,19 @@ TEST_F(FootprintTest, CopyAssignment) {
   ASSERT_TRUE(footprint1.get_data().isApprox(footprint2.get_data()));
 }
 
+TEST_F(FootprintTest, MoveConstruction) {
+  static_assert(std::is_nothrow_move_constructible<Footprint>::value &&
+                    std::is_nothrow_move_assignable<Footprint>::value,
+                "Footprint must be nothrow movable.");
+
+  Footprint footprint1(data_);
+  Footprint footprint2(std::move(footprint1));
+  Footprint footprint3(Points::Zero(3, 2));
+  footprint3 = std::move(footprint2);
+
+  ASSERT_TRUE(footprint3.get_data().isApprox(data_));
+}
+
 TEST_F(FootprintTest, Accessors) {
   Footprint footprint(data_);
   ASSERT_TRUE(footprint.get_data().isApprox(data_));
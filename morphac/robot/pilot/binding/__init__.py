@@ -1,4 +1,4 @@
-from ._binding_pilot_python import Pilot
+from ._binding_pilot_python import BatchPilot, Pilot
 
 
 # Dependencies
@@ -0,0 +1,36 @@
+#ifndef BATCH_PILOT_BINDING_H
+#define BATCH_PILOT_BINDING_H
+
+#include <vector>
+
+#include "pybind11/eigen.h"
+#include "pybind11/pybind11.h"
+#include "pybind11/stl.h"
+#include "robot/pilot/include/batch_pilot.h"
+
+namespace morphac {
+namespace robot {
+namespace pilot {
+namespace binding {
+
+// Trampoline class as the BatchPilot class is abstract.
+class PyBatchPilot : public morphac::robot::pilot::BatchPilot {
+ public:
+  using BatchPilot::BatchPilot;
+
+  Eigen::MatrixXd Execute(
+      const morphac::simulation::playground::PlaygroundState& playground_state,
+      const std::vector<int>& uids) const override {
+    PYBIND11_OVERLOAD_PURE_NAME(Eigen::MatrixXd, BatchPilot, "execute",
+                                Execute, playground_state, uids);
+  }
+};
+
+void define_batch_pilot_binding(pybind11::module& m);
+
+}  // namespace binding
+}  // namespace pilot
+}  // namespace robot
+}  // namespace morphac
+
+#endif
@@ -1,5 +1,6 @@
 #include "pybind11/eigen.h"
 #include "pybind11/pybind11.h"
+#include "robot/pilot/binding/include/batch_pilot_binding.h"
 #include "robot/pilot/binding/include/pilot_binding.h"
 
 namespace morphac {
@@ -9,7 +10,10 @@ namespace binding {
 
 namespace py = pybind11;
 
-PYBIND11_MODULE(_binding_pilot_python, m) { define_pilot_binding(m); }
+PYBIND11_MODULE(_binding_pilot_python, m) {
+  define_pilot_binding(m);
+  define_batch_pilot_binding(m);
+}
 
 }  // namespace binding
 }  // namespace pilot
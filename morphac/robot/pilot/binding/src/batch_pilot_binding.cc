@@ -0,0 +1,23 @@
+#include "robot/pilot/binding/include/batch_pilot_binding.h"
+
+namespace morphac {
+namespace robot {
+namespace pilot {
+namespace binding {
+
+namespace py = pybind11;
+
+using morphac::robot::pilot::BatchPilot;
+
+void define_batch_pilot_binding(py::module& m) {
+  py::class_<BatchPilot, PyBatchPilot> batch_pilot(m, "BatchPilot");
+
+  batch_pilot.def(py::init<>());
+  batch_pilot.def("execute", &BatchPilot::Execute, py::arg("playground_state"),
+                  py::arg("uids"));
+}
+
+}  // namespace binding
+}  // namespace pilot
+}  // namespace robot
+}  // namespace morphac
@@ -0,0 +1,35 @@
+#ifndef BATCH_PILOT_H
+#define BATCH_PILOT_H
+
+#include <vector>
+
+#include "Eigen/Dense"
+
+#include "simulation/playground/include/playground_state.h"
+
+namespace morphac {
+namespace robot {
+namespace pilot {
+
+// Pilot that computes the control inputs of several robots at once. Unlike a
+// Pilot, which is executed once per robot every simulation cycle, a batch
+// pilot is executed once per cycle for all of its robots. This way the
+// control inputs can be computed in a vectorized manner (Like with numpy in
+// python), without a call (and a ControlInput) per robot.
+class BatchPilot {
+ public:
+  BatchPilot();
+
+  // Returns a matrix with a row per uid, where row i is the control input of
+  // the robot with uid uids[i]. The number of columns is the control input
+  // size of the robots.
+  virtual Eigen::MatrixXd Execute(
+      const morphac::simulation::playground::PlaygroundState& playground_state,
+      const std::vector<int>& uids) const = 0;
+};
+
+}  // namespace pilot
+}  // namespace robot
+}  // namespace morphac
+
+#endif
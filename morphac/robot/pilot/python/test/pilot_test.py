@@ -3,7 +3,7 @@ import pytest
 
 from morphac.constructs import ControlInput
 from morphac.environment import Map
-from morphac.robot.pilot import Pilot
+from morphac.robot.pilot import BatchPilot, Pilot
 from morphac.simulation.playground import PlaygroundState
 
 
@@ -18,6 +18,17 @@ class CustomPilot(Pilot):
         return ControlInput(self.control_input_data)
 
 
+class CustomBatchPilot(BatchPilot):
+    def __init__(self, control_input_data):
+
+        BatchPilot.__init__(self)
+        self.control_input_data = np.array(control_input_data, dtype=float)
+
+    def execute(self, playground_state, uids):
+
+        return np.outer(uids, self.control_input_data)
+
+
 @pytest.fixture()
 def generate_pilot_list():
     p1 = CustomPilot([1, 2, 3])
@@ -54,3 +65,16 @@ def test_execute_with_temporary(generate_pilot_list):
 
     assert np.allclose(p1.execute(PlaygroundState(Map(10, 10, 1.0)), 0).data, [1, 2, 3])
     assert np.allclose(p2.execute(PlaygroundState(Map(10, 10, 1.0)), 0).data, [1] * 10)
+
+
+def test_batch_execute():
+
+    # Each row of the computed matrix is the control input of the robot with
+    # the corresponding uid.
+    batch_pilot = CustomBatchPilot([1, 2, 3])
+    playground_state = PlaygroundState(Map(10, 10, 1.0))
+
+    control_inputs = batch_pilot.execute(playground_state, [0, 2, 5])
+
+    assert control_inputs.shape == (3, 3)
+    assert np.allclose(control_inputs, [[0, 0, 0], [2, 4, 6], [5, 10, 15]])
@@ -0,0 +1,11 @@
+#include "robot/pilot/include/batch_pilot.h"
+
+namespace morphac {
+namespace robot {
+namespace pilot {
+
+BatchPilot::BatchPilot() {}
+
+}  // namespace pilot
+}  // namespace robot
+}  // namespace morphac
@@ -0,0 +1,82 @@
+#include "robot/pilot/include/batch_pilot.h"
+
+#include "Eigen/Dense"
+#include "gtest/gtest.h"
+
+namespace {
+
+using std::vector;
+
+using Eigen::MatrixXd;
+using Eigen::MatrixXi;
+using Eigen::VectorXd;
+
+using morphac::environment::Map;
+using morphac::robot::pilot::BatchPilot;
+using morphac::simulation::playground::PlaygroundState;
+
+// Derived BatchPilot class for testing. The control input of each robot is
+// the given control input data scaled by its uid.
+class CustomBatchPilot : public BatchPilot {
+ public:
+  CustomBatchPilot(VectorXd control_input_data)
+      : BatchPilot(), control_input_data_(control_input_data) {}
+
+  MatrixXd Execute(const PlaygroundState& playground_state,
+                   const vector<int>& uids) const override {
+    // Some asserts to prevent the unused variable warning.
+    MORPH_REQUIRE(playground_state.NumRobots() >= 0, std::invalid_argument,
+                  "Invalid PlaygroundState");
+    MatrixXd control_inputs(uids.size(), control_input_data_.size());
+    for (int i = 0; i < static_cast<int>(uids.size()); ++i) {
+      control_inputs.row(i) = uids[i] * control_input_data_.transpose();
+    }
+    return control_inputs;
+  }
+
+ private:
+  VectorXd control_input_data_;
+};
+
+class BatchPilotTest : public ::testing::Test {
+ protected:
+  BatchPilotTest() {
+    // Set random seed for Eigen.
+    srand(7);
+  }
+
+  void SetUp() override {}
+};
+
+TEST_F(BatchPilotTest, Construction) {
+  VectorXd control_input_data1 = VectorXd::Random(3);
+  VectorXd control_input_data2 = VectorXd::Random(16);
+  CustomBatchPilot batch_pilot1{control_input_data1};
+  CustomBatchPilot batch_pilot2{control_input_data2};
+}
+
+TEST_F(BatchPilotTest, Execute) {
+  VectorXd control_input_data = VectorXd::Random(3);
+  CustomBatchPilot batch_pilot{control_input_data};
+
+  // Creating a sample playground state.
+  PlaygroundState playground_state{Map(MatrixXi::Zero(300, 300), 0.1)};
+
+  MatrixXd control_inputs = batch_pilot.Execute(playground_state, {2, 0, 5});
+  ASSERT_EQ(control_inputs.rows(), 3);
+  ASSERT_EQ(control_inputs.cols(), 3);
+  ASSERT_TRUE(
+      control_inputs.row(0).isApprox(2 * control_input_data.transpose()));
+  ASSERT_TRUE(control_inputs.row(1).isZero());
+  ASSERT_TRUE(
+      control_inputs.row(2).isApprox(5 * control_input_data.transpose()));
+
+  ASSERT_EQ(batch_pilot.Execute(playground_state, {}).rows(), 0);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
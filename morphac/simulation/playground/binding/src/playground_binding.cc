@@ -8,6 +8,10 @@ namespace binding {
 namespace py = pybind11;
 
 using morphac::environment::Map;
+using morphac::math::numeric::IntegratorType;
+using morphac::robot::blueprint::Robot;
+using morphac::robot::pilot::BatchPilot;
+using morphac::robot::pilot::Pilot;
 using morphac::simulation::playground::Playground;
 using morphac::simulation::playground::PlaygroundSpec;
 
@@ -26,11 +30,33 @@ void define_playground_binding(py::module& m) {
   // pilot object could potentially be non-copyable.
   playground.def("get_pilot", &Playground::get_pilot, py::arg("uid"),
                  py::return_value_policy::reference);
+  playground.def("get_batch_pilot", &Playground::get_batch_pilot,
+                 py::arg("uid"), py::return_value_policy::reference);
   playground.def("get_integrator", &Playground::get_integrator, py::arg("uid"),
                  py::return_value_policy::reference);
-  playground.def("add_robot", &Playground::AddRobot, py::arg("robot"),
-                 py::arg("pilot"), py::arg("integrator_type"), py::arg("uid"),
+  playground.def("add_robot",
+                 py::overload_cast<const Robot&, const Pilot&,
+                                   const IntegratorType&, const int>(
+                     &Playground::AddRobot),
+                 py::arg("robot"), py::arg("pilot"),
+                 py::arg("integrator_type"), py::arg("uid"),
                  py::keep_alive<1, 2>(), py::keep_alive<1, 3>());
+  playground.def("add_robot",
+                 py::overload_cast<const Robot&, const BatchPilot&,
+                                   const IntegratorType&, const int>(
+                     &Playground::AddRobot),
+                 py::arg("robot"), py::arg("batch_pilot"),
+                 py::arg("integrator_type"), py::arg("uid"),
+                 py::keep_alive<1, 2>(), py::keep_alive<1, 3>());
+  // The GIL is released while the simulation runs natively. Pilots that are
+  // implemented in python reacquire it through the trampoline. Batch pilots
+  // only reacquire it once per cycle, for all of their robots.
+  playground.def("execute", &Playground::Execute,
+                 py::call_guard<py::gil_scoped_release>());
+  playground.def("run", &Playground::Run, py::arg("num_steps"),
+                 py::call_guard<py::gil_scoped_release>());
+  playground.def("run_until", &Playground::RunUntil, py::arg("time"),
+                 py::call_guard<py::gil_scoped_release>());
 }
 
 }  // namespace binding
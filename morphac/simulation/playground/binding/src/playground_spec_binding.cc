@@ -14,10 +14,12 @@ using morphac::simulation::playground::PlaygroundSpec;
 void define_playground_spec_binding(py::module& m) {
   py::class_<PlaygroundSpec> playground_spec(m, "PlaygroundSpec");
 
-  playground_spec.def(py::init<const string, const double>(), py::arg("name"),
-                      py::arg("dt"));
+  playground_spec.def(py::init<const string, const double, const int>(),
+                      py::arg("name"), py::arg("dt"),
+                      py::arg("num_threads") = 1);
   playground_spec.def_readonly("name", &PlaygroundSpec::name);
   playground_spec.def_readonly("dt", &PlaygroundSpec::dt);
+  playground_spec.def_readonly("num_threads", &PlaygroundSpec::num_threads);
 }
 
 }  // namespace binding
@@ -27,6 +27,20 @@ void define_playground_state_binding(py::module& m) {
                        py::arg("uid"));
   playground_state.def("set_robot_state", &PlaygroundState::set_robot_state,
                        py::arg("state"), py::arg("uid"));
+  playground_state.def("set_next_robot_state",
+                       &PlaygroundState::set_next_robot_state, py::arg("state"),
+                       py::arg("uid"));
+  playground_state.def("swap_robot_state_buffers",
+                       &PlaygroundState::SwapRobotStateBuffers);
+  playground_state.def("sync_robots", &PlaygroundState::SyncRobots);
+  playground_state.def("get_robot_slot", &PlaygroundState::get_robot_slot,
+                       py::arg("uid"));
+  playground_state.def_property_readonly("robot_uids",
+                                         &PlaygroundState::get_robot_uids);
+  playground_state.def_property_readonly("robot_poses",
+                                         &PlaygroundState::get_robot_poses);
+  playground_state.def_property_readonly(
+      "robot_pose_offsets", &PlaygroundState::get_robot_pose_offsets);
   playground_state.def_property_readonly("num_robots",
                                          &PlaygroundState::NumRobots);
   playground_state.def("add_robot", &PlaygroundState::AddRobot,
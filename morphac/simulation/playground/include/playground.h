@@ -1,7 +1,11 @@
 #ifndef PLAYGROUND_H
 #define PLAYGROUND_H
 
+#include <algorithm>
+#include <cmath>
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "constructs/include/state.h"
 #include "environment/include/map.h"
@@ -9,10 +13,12 @@
 #include "math/numeric/include/integrator.h"
 #include "mechanics/models/include/kinematic_model.h"
 #include "robot/blueprint/include/robot.h"
+#include "robot/pilot/include/batch_pilot.h"
 #include "robot/pilot/include/pilot.h"
 #include "simulation/playground/include/playground_spec.h"
 #include "simulation/playground/include/playground_state.h"
 #include "utils/include/integrator_utils.h"
+#include "utils/include/thread_utils.h"
 
 namespace morphac {
 namespace simulation {
@@ -35,6 +41,8 @@ class Playground {
   const std::unordered_map<int, morphac::robot::pilot::Pilot&>&
   get_pilot_oracle() const;
   const morphac::robot::pilot::Pilot& get_pilot(const int uid) const;
+  const morphac::robot::pilot::BatchPilot& get_batch_pilot(
+      const int uid) const;
   const morphac::math::numeric::Integrator& get_integrator(const int uid) const;
 
   void AddRobot(const morphac::robot::blueprint::Robot& robot,
@@ -42,15 +50,85 @@ class Playground {
                 const morphac::math::numeric::IntegratorType& integrator_type,
                 const int uid);
 
+  // Adds a robot that is controlled by a batch pilot. All the robots added
+  // with the same batch pilot are controlled together, through a single
+  // execution of the batch pilot every simulation cycle. Hence they must all
+  // have the same control input size.
+  void AddRobot(const morphac::robot::blueprint::Robot& robot,
+                const morphac::robot::pilot::BatchPilot& batch_pilot,
+                const morphac::math::numeric::IntegratorType& integrator_type,
+                const int uid);
+
+  // Executes one simulation cycle. Each robot's pilot computes the control
+  // input, which is then integrated through dt to update the robot's state.
+  // The batch pilots are executed first (once each, in the order in which
+  // they were added), after which the robots are stepped.
+  // The playground time is advanced by dt at the end of the cycle.
+  // The robots are stepped in parallel (According to the number of threads in
+  // the spec). Every pilot sees the playground state at the start of the
+  // cycle, as the updated robot states are written into the next state buffer
+  // of the playground state, which only becomes current once all the robots
+  // have been stepped. Hence the pilot implementations must be thread safe
+  // when the playground is run with multiple threads.
+  // The Robot objects that were added to the playground are updated with the
+  // new states once the cycle is complete.
+  void Execute();
+
+  // Executes the given number of simulation cycles.
+  void Run(const int num_steps);
+
+  // Executes simulation cycles until the playground time reaches the given
+  // time. As the playground advances in steps of dt, the final time would be
+  // the first multiple of dt that is greater than or equal to the given time.
+  void RunUntil(const double time);
+
  private:
-  bool UidExistsInIntegratorOracle(const int uid) const;
   bool UidExistsInPilotOracle(const int uid) const;
+  bool UidExistsInBatchPilotOracle(const int uid) const;
+  bool UidExists(const int uid) const;
+
+  // Adds the robot to the next slot, along with everything that is stored
+  // per slot. The pilot is null for robots that are controlled by a batch
+  // pilot.
+  void AddRobotToSlot(
+      const morphac::robot::blueprint::Robot& robot,
+      const morphac::robot::pilot::Pilot* pilot,
+      const morphac::math::numeric::IntegratorType& integrator_type,
+      const int uid);
+
+  // Executes one simulation cycle (See Execute) without syncing the Robot
+  // objects with the updated states.
+  void ExecuteCycle();
+
+  // Executes the batch pilots, writing the control inputs that they compute
+  // into the control input slots of their robots.
+  void ExecuteBatchPilots();
 
   const PlaygroundSpec playground_spec_;
   PlaygroundState playground_state_;
   std::unordered_map<int, morphac::robot::pilot::Pilot&> pilot_oracle_;
-  std::unordered_map<int, std::unique_ptr<morphac::math::numeric::Integrator>>
-      integrator_oracle_;
+  std::unordered_map<int, morphac::robot::pilot::BatchPilot&>
+      batch_pilot_oracle_;
+
+  // Pilots, integrators and kinematic models of the robots, indexed by the
+  // robot slots in the playground state. This way the robots can be stepped
+  // without any uid lookups.
+  std::vector<const morphac::robot::pilot::Pilot*> pilots_;
+  std::vector<std::unique_ptr<morphac::math::numeric::Integrator>>
+      integrators_;
+  std::vector<const morphac::mechanics::models::KinematicModel*>
+      kinematic_models_;
+  // Control input of each robot slot, which the batch pilots write into.
+  std::vector<morphac::constructs::ControlInput> control_inputs_;
+
+  // Distinct batch pilots, along with the uids and slots of their robots.
+  struct BatchPilotGroup {
+    const morphac::robot::pilot::BatchPilot* batch_pilot;
+    std::vector<int> uids;
+    std::vector<int> slots;
+  };
+  std::vector<BatchPilotGroup> batch_pilot_groups_;
+  std::unique_ptr<morphac::utils::ThreadPool> thread_pool_;
 };
 
 }  // namespace playground
@@ -10,6 +10,9 @@ namespace playground {
 struct PlaygroundSpec {
   const std::string name;
   const double dt;
+  // Number of threads used to step the robots in the playground. The results
+  // of the simulation are the same irrespective of the number of threads.
+  const int num_threads = 1;
 };
 
 }  // namespace playground
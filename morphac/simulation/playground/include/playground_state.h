@@ -1,7 +1,11 @@
 #ifndef PLAYGROUND_STATE_H
 #define PLAYGROUND_STATE_H
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include "constructs/include/state.h"
 #include "environment/include/map.h"
@@ -33,15 +37,74 @@ class PlaygroundState {
   void set_map(const morphac::environment::Map& map);
   void set_robot_state(const morphac::constructs::State&, const int uid);
 
+  // The robot states are double buffered. The current states (What
+  // get_robot_state returns) are read while the states of the next simulation
+  // cycle are written into a separate buffer. This way every robot sees the
+  // same snapshot of the playground irrespective of the order in which the
+  // robots are stepped.
+  // Once the next states of the robots have been written, the buffers are
+  // swapped. The robots whose next states weren't written keep their current
+  // states across the swap (Only those slots are copied).
+  // Different uids may be written to concurrently.
+  void set_next_robot_state(const morphac::constructs::State& state,
+                            const int uid);
+  void SwapRobotStateBuffers();
+
+  // The Robot objects are only updated with the current robot states when
+  // they are accessed through the state (See get_robot and
+  // get_robot_oracle), or when they are synced explicitly. Playground syncs
+  // them at the end of Execute, Run and RunUntil.
+  void SyncRobots() const;
+
+  // The robots are stored densely in slots, in the order in which they were
+  // added. The slot based accessors avoid the uid lookup and are meant for
+  // iterating over all of the robots (Like stepping them every simulation
+  // cycle). The vectors are indexed by the slot.
+  int get_robot_slot(const int uid) const;
+  const std::vector<int>& get_robot_uids() const;
+  const std::vector<morphac::constructs::State>& get_robot_states() const;
+  // The current poses of all the robots, packed contiguously in slot order.
+  // The robots may have poses of different sizes, so the pose of a slot
+  // starts at its offset and ends at the offset of the next slot (There is
+  // one more offset than there are robots). Reading the poses of all the
+  // robots this way is cache linear, unlike going through the states, which
+  // each hold their own pose data for the pilots and integrators to work on.
+  // The poses are packed whenever the current states change.
+  const Eigen::VectorXd& get_robot_poses() const;
+  const std::vector<int>& get_robot_pose_offsets() const;
+  // Reference to the next state buffer so that the next states can be written
+  // in place. The dimensions of the states must not be changed. Every slot
+  // is taken to be written before the buffers are swapped.
+  std::vector<morphac::constructs::State>& get_next_robot_states_ref();
+
   int NumRobots() const;
   void AddRobot(const morphac::robot::blueprint::Robot& robot, const int uid);
 
  private:
+  using RobotStates = std::vector<morphac::constructs::State>;
+
   bool UidExistsInRobotOracle(const int uid) const;
+  void PackRobotPose(const int slot);
 
   double time_;
   morphac::environment::Map map_;
+  // The oracle is only used to expose the robots against their uids. All the
+  // other robot data is stored in slots.
   std::unordered_map<int, morphac::robot::blueprint::Robot&> robot_oracle_;
+  std::unordered_map<int, int> robot_slots_;
+  std::vector<int> robot_uids_;
+  std::vector<morphac::robot::blueprint::Robot*> robots_;
+  std::unique_ptr<RobotStates> robot_states_;
+  std::unique_ptr<RobotStates> next_robot_states_;
+  Eigen::VectorXd robot_poses_;
+  std::vector<int> robot_pose_offsets_;
+  // Whether the next state of each slot was written since the last swap. It
+  // holds chars instead of bools so that different slots may be written
+  // concurrently.
+  std::vector<char> is_next_robot_state_written_;
+  bool are_next_robot_states_written_;
+  mutable std::atomic<bool> are_robots_synced_;
+  mutable std::mutex sync_mutex_;
 };
 
 }  // namespace playground
@@ -7,17 +7,24 @@ from morphac.simulation.playground import PlaygroundSpec
 def generate_playground_spec_list():
     ps1 = PlaygroundSpec("playground1", 0.001)
     ps2 = PlaygroundSpec(name="playground2", dt=0.02)
+    ps3 = PlaygroundSpec(name="playground3", dt=0.05, num_threads=4)
 
-    return ps1, ps2
+    return ps1, ps2, ps3
 
 
 def test_attributes(generate_playground_spec_list):
-    ps1, ps2 = generate_playground_spec_list
+    ps1, ps2, ps3 = generate_playground_spec_list
 
     # Test the attributes of the Spec objects.
     assert ps1.name == "playground1"
     assert ps1.dt == 0.001
+    assert ps1.num_threads == 1
 
     assert ps2.name == "playground2"
     assert ps2.dt == 0.02
+    assert ps2.num_threads == 1
+
+    assert ps3.name == "playground3"
+    assert ps3.dt == 0.05
+    assert ps3.num_threads == 4
 
@@ -203,3 +203,69 @@ def test_set_robot_state(generate_playground_state_list, generate_robot_list):
         ps1.set_robot_state(State(3, 0), -1)
     with pytest.raises(ValueError):
         ps1.set_robot_state(State(3, 0), 3)
+
+
+def test_set_next_robot_state(generate_playground_state_list, generate_robot_list):
+    ps1, _ = generate_playground_state_list
+    r1, r2 = generate_robot_list
+
+    ps1.add_robot(r1, 1)
+    ps1.add_robot(r2, 2)
+
+    ps1.set_next_robot_state(State([-1, -2, -3], []), 1)
+    ps1.set_next_robot_state(State([1, 1, 2], []), 2)
+
+    # The current states must not change until the buffers are swapped.
+    assert np.allclose(ps1.get_robot_state(1).data, [0, 0, 0])
+    assert np.allclose(ps1.get_robot_state(2).data, [1, 2, 3])
+
+    ps1.swap_robot_state_buffers()
+
+    assert np.allclose(ps1.get_robot_state(1).data, [-1, -2, -3])
+    assert np.allclose(ps1.get_robot_state(2).data, [1, 1, 2])
+    assert np.allclose(ps1.robot_oracle[1].state.data, [-1, -2, -3])
+    assert np.allclose(ps1.get_robot(2).state.data, [1, 1, 2])
+
+    # Robots whose next states aren't set keep their current states.
+    ps1.set_next_robot_state(State([0, 0, 1], []), 1)
+    ps1.swap_robot_state_buffers()
+    ps1.sync_robots()
+
+    assert np.allclose(r1.state.data, [0, 0, 1])
+    assert np.allclose(r2.state.data, [1, 1, 2])
+
+    with pytest.raises(ValueError):
+        ps1.set_next_robot_state(State(3, 0), 3)
+
+
+def test_robot_slots(generate_playground_state_list, generate_robot_list):
+    ps1, _ = generate_playground_state_list
+    r1, r2 = generate_robot_list
+
+    ps1.add_robot(r1, 5)
+    ps1.add_robot(r2, 2)
+
+    # Slots are assigned in the order in which the robots are added.
+    assert ps1.get_robot_slot(5) == 0
+    assert ps1.get_robot_slot(2) == 1
+    assert ps1.robot_uids == [5, 2]
+
+    with pytest.raises(ValueError):
+        ps1.get_robot_slot(1)
+
+
+def test_robot_poses(generate_playground_state_list, generate_robot_list):
+    ps1, _ = generate_playground_state_list
+    r1, r2 = generate_robot_list
+
+    ps1.add_robot(r1, 5)
+    ps1.add_robot(r2, 2)
+
+    # The poses are packed in slot order.
+    assert ps1.robot_pose_offsets == [0, 3, 6]
+    assert np.allclose(ps1.robot_poses, [0.0, 0.0, 0.0, 1.0, 2.0, 3.0])
+
+    # The next states are packed once the buffers are swapped.
+    ps1.set_next_robot_state(State([4.0, 5.0, 6.0], []), 5)
+    ps1.swap_robot_state_buffers()
+    assert np.allclose(ps1.robot_poses, [4.0, 5.0, 6.0, 1.0, 2.0, 3.0])
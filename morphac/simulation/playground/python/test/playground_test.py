@@ -10,7 +10,7 @@ from morphac.math.numeric import (
     MidPointIntegrator,
     RK4Integrator,
 )
-from morphac.robot.pilot import Pilot
+from morphac.robot.pilot import BatchPilot, Pilot
 from morphac.robot.blueprint import Footprint, Robot
 from morphac.simulation.playground import Playground
 from morphac.simulation.playground import PlaygroundSpec
@@ -28,6 +28,20 @@ class CustomPilot(Pilot):
         return ControlInput(self.control_input_data)
 
 
+# Custom derived BatchPilot class to be used for testing.
+class CustomBatchPilot(BatchPilot):
+    def __init__(self, control_input_data):
+
+        BatchPilot.__init__(self)
+        self.control_input_data = control_input_data
+        self.num_executions = 0
+
+    def execute(self, playground_state, uids):
+
+        self.num_executions += 1
+        return np.tile(self.control_input_data, (len(uids), 1))
+
+
 @pytest.fixture()
 def generate_playground():
     playground_spec = PlaygroundSpec("playground", 0.01)
@@ -153,6 +167,28 @@ def test_get_pilot(generate_playground, generate_robot_list):
         _ = playground.get_pilot(3)
 
 
+def test_get_batch_pilot(generate_playground, generate_robot_list):
+    playground = generate_playground
+    robot1, robot2 = generate_robot_list
+
+    batch_pilot = CustomBatchPilot([1.0, 2])
+    pilot = CustomPilot([0, 0])
+
+    # Adding the robots.
+    playground.add_robot(robot1, batch_pilot, IntegratorType.EULER_INTEGRATOR, 1)
+    playground.add_robot(robot2, pilot, IntegratorType.MID_POINT_INTEGRATOR, 2)
+
+    # Making sure the right pilots are returned.
+    assert np.allclose(playground.get_batch_pilot(1).control_input_data, [1.0, 2])
+    assert np.allclose(playground.get_pilot(2).control_input_data, [0, 0])
+
+    # The robot is controlled by a batch pilot and not a pilot (And vice versa).
+    with pytest.raises(ValueError):
+        _ = playground.get_pilot(1)
+    with pytest.raises(ValueError):
+        _ = playground.get_batch_pilot(2)
+
+
 def test_get_integrator(generate_playground, generate_robot_list):
     playground = generate_playground
     robot1, robot2 = generate_robot_list
@@ -250,6 +286,41 @@ def test_execute(generate_playground, generate_robot_list):
     assert playground.state.time == playground.spec.dt
 
 
+def test_execute_with_batch_pilot(generate_playground, generate_robot_list):
+    playground = generate_playground
+    robot1, robot2 = generate_robot_list
+    batch_pilot = CustomBatchPilot([1.0, 1.0])
+
+    # Adding the robots.
+    playground.add_robot(robot1, batch_pilot, IntegratorType.MID_POINT_INTEGRATOR, 1)
+    playground.add_robot(robot2, batch_pilot, IntegratorType.RK4_INTEGRATOR, 2)
+
+    playground.execute()
+
+    # The batch pilot is executed once for both the robots.
+    assert batch_pilot.num_executions == 1
+
+    # Both robots move forward with a velocity of 1 m/s in the x direction.
+    assert np.allclose(
+        playground.state.get_robot_state(1).data, [playground.spec.dt, 0.0, 0.0]
+    )
+    assert np.allclose(
+        playground.state.get_robot_state(2).data, [1.0 + playground.spec.dt, 2.0, 0.0]
+    )
+
+    # Batch pilot that computes control inputs of the wrong dimensions.
+    playground = Playground(PlaygroundSpec("playground", 0.01), Map(50, 50, 0.1))
+    playground.add_robot(
+        Robot(DiffdriveModel(1.0, 1.0)),
+        CustomBatchPilot([1.0, 1.0, 1.0]),
+        IntegratorType.EULER_INTEGRATOR,
+        1,
+    )
+
+    with pytest.raises(RuntimeError):
+        playground.execute()
+
+
 def test_execute_with_temporary(generate_playground):
     # Test the function after adding robots using temporarily created Robot and Pilot objects.
     # This is to test for any cpp lifetime management weirdness.
@@ -291,3 +362,80 @@ def test_execute_with_temporary(generate_playground):
     # Make sure that the playground time has updated.
     assert playground.state.time == playground.spec.dt
 
+
+
+def test_run(generate_playground, generate_robot_list):
+    playground = generate_playground
+    robot1, robot2 = generate_robot_list
+    pilot1, pilot2 = CustomPilot([0, 0]), CustomPilot([1.0, 1.0])
+
+    playground.add_robot(robot1, pilot1, IntegratorType.EULER_INTEGRATOR, 1)
+    playground.add_robot(robot2, pilot2, IntegratorType.RK4_INTEGRATOR, 2)
+
+    # Running a number of playground cycles.
+    playground.run(10)
+
+    # The first robot must not have moved.
+    assert np.allclose(playground.state.get_robot_state(1).data, [0.0, 0.0, 0.0])
+
+    # The second robot moves forward with a velocity of 1 m/s for 10 cycles.
+    assert np.allclose(
+        playground.state.get_robot_state(2).data,
+        [1.0 + 10 * playground.spec.dt, 2.0, 0.0],
+    )
+    assert np.isclose(playground.state.time, 10 * playground.spec.dt)
+
+    # Invalid number of steps.
+    with pytest.raises(ValueError):
+        playground.run(-1)
+
+
+def test_run_until(generate_playground, generate_robot_list):
+    playground = generate_playground
+    _, robot2 = generate_robot_list
+
+    playground.add_robot(
+        robot2, CustomPilot([1.0, 1.0]), IntegratorType.EULER_INTEGRATOR, 1
+    )
+
+    playground.run_until(0.5)
+
+    assert np.isclose(playground.state.time, 0.5)
+    assert np.allclose(playground.state.get_robot_state(1).data, [1.5, 2.0, 0.0])
+
+    # If the time isn't a multiple of dt, the playground runs till the next
+    # multiple of dt.
+    playground.run_until(0.555)
+
+    assert np.isclose(playground.state.time, 0.56)
+    assert np.allclose(playground.state.get_robot_state(1).data, [1.56, 2.0, 0.0])
+
+
+def test_multi_threaded_run():
+    # The result of the simulation must be the same irrespective of the number
+    # of threads. This also makes sure that python pilots can be called from
+    # the worker threads.
+    final_states = []
+    for num_threads in [1, 4]:
+        playground = Playground(
+            PlaygroundSpec("playground", 0.01, num_threads), Map(50, 50, 0.1)
+        )
+        for uid in range(20):
+            playground.add_robot(
+                Robot(
+                    DiffdriveModel(1.0, 1.0),
+                    initial_state=State([uid, -uid, 0.1 * uid], []),
+                ),
+                CustomPilot([0.1 * uid, 0.2 * uid]),
+                IntegratorType.RK4_INTEGRATOR,
+                uid,
+            )
+
+        playground.run(10)
+
+        final_states.append(
+            [playground.state.get_robot_state(uid).data for uid in range(20)]
+        )
+
+    for state1, state2 in zip(*final_states):
+        assert np.array_equal(state1, state2)
@@ -4,7 +4,13 @@ namespace morphac {
 namespace simulation {
 namespace playground {
 
+using std::ceil;
+using std::make_unique;
+using std::max;
 using std::unordered_map;
+using std::vector;
+
+using Eigen::MatrixXd;
 
 using morphac::constructs::ControlInput;
 using morphac::constructs::State;
@@ -14,28 +20,36 @@ using morphac::math::numeric::Integrator;
 using morphac::math::numeric::IntegratorType;
 using morphac::mechanics::models::KinematicModel;
 using morphac::robot::blueprint::Robot;
+using morphac::robot::pilot::BatchPilot;
 using morphac::robot::pilot::Pilot;
 using morphac::utils::IntegratorFromType;
+using morphac::utils::ThreadPool;
 
 Playground::Playground(const PlaygroundSpec& playground_spec, const Map& map)
-    : playground_spec_(playground_spec), playground_state_(map) {}
-
-bool Playground::UidExistsInIntegratorOracle(const int uid) const {
-  if (integrator_oracle_.find(uid) == integrator_oracle_.end()) {
-    // Given uid doesn't exist in the integrator oracle.
-    return false;
-  }
-  return true;
+    : playground_spec_(playground_spec), playground_state_(map) {
+  MORPH_REQUIRE(playground_spec.dt > 0, std::invalid_argument,
+                "Playground dt must be positive.");
+  MORPH_REQUIRE(playground_spec.num_threads > 0, std::invalid_argument,
+                "Number of playground threads must be positive.");
+  thread_pool_ = make_unique<ThreadPool>(playground_spec.num_threads);
 }
 
 bool Playground::UidExistsInPilotOracle(const int uid) const {
   if (pilot_oracle_.find(uid) == pilot_oracle_.end()) {
-    // Given uid doesn't exist in the integrator oracle.
+    // Given uid doesn't exist in the pilot oracle.
     return false;
   }
   return true;
 }
 
+bool Playground::UidExistsInBatchPilotOracle(const int uid) const {
+  return batch_pilot_oracle_.find(uid) != batch_pilot_oracle_.end();
+}
+
+bool Playground::UidExists(const int uid) const {
+  return UidExistsInPilotOracle(uid) || UidExistsInBatchPilotOracle(uid);
+}
+
 const PlaygroundSpec& Playground::get_spec() const { return playground_spec_; }
 
 PlaygroundState& Playground::get_state() { return playground_state_; }
@@ -51,40 +65,192 @@ const Pilot& Playground::get_pilot(const int uid) const {
   return pilot_oracle_.find(uid)->second;
 }
 
+const BatchPilot& Playground::get_batch_pilot(const int uid) const {
+  // Making sure that the UID exists.
+  MORPH_REQUIRE(UidExistsInBatchPilotOracle(uid), std::invalid_argument,
+                "Given UID does not exist.");
+  return batch_pilot_oracle_.find(uid)->second;
+}
+
 const Integrator& Playground::get_integrator(const int uid) const {
   // Making sure that the UID exists.
-  MORPH_REQUIRE(UidExistsInIntegratorOracle(uid), std::invalid_argument,
+  MORPH_REQUIRE(UidExists(uid), std::invalid_argument,
                 "Given UID does not exist.");
-  return *(integrator_oracle_.find(uid)->second);
+  return *integrators_[playground_state_.get_robot_slot(uid)];
 }
 
-void Playground::AddRobot(const Robot& robot, const Pilot& pilot,
-                          const IntegratorType& integrator_type,
-                          const int uid) {
+void Playground::AddRobotToSlot(const Robot& robot, const Pilot* pilot,
+                                const IntegratorType& integrator_type,
+                                const int uid) {
   // Making sure that the uid is valid.
   MORPH_REQUIRE(uid >= 0, std::invalid_argument, "UID must be positive");
   // Making sure that the robot uid doesn't exist in any of the oracles.
-  MORPH_REQUIRE(
-      (!UidExistsInPilotOracle(uid)) && (!UidExistsInIntegratorOracle(uid)),
-      std::invalid_argument, "Given UID already exists.");
+  MORPH_REQUIRE(!UidExists(uid), std::invalid_argument,
+                "Given UID already exists.");
 
   // Also making sure that we have the same number of elements in each
-  // of the oracles. This is just a sanity check done before adding the new
+  // of the slots. This is just a sanity check done before adding the new
   // robot.
   MORPH_REQUIRE(
-      (playground_state_.NumRobots() == (int)integrator_oracle_.size()) &&
-          (integrator_oracle_.size() == pilot_oracle_.size()),
+      (playground_state_.NumRobots() == (int)pilots_.size()) &&
+          (pilots_.size() == integrators_.size()) &&
+          (pilots_.size() == control_inputs_.size()) &&
+          (pilots_.size() ==
+           pilot_oracle_.size() + batch_pilot_oracle_.size()),
       std::logic_error,
-      "Oracles are of different sizes. Something has gone wrong.");
+      "Slots are of different sizes. Something has gone wrong.");
 
-  // Updating the oracles.
+  // The playground state assigns the robot to the next slot, which is where
+  // the pilot, integrator, kinematic model and control input are also
+  // stored.
   playground_state_.AddRobot(robot, uid);
-  integrator_oracle_[uid] = std::move(IntegratorFromType(
+  pilots_.push_back(pilot);
+  integrators_.push_back(IntegratorFromType(
       integrator_type,
       const_cast<KinematicModel&>(robot.get_kinematic_model())));
+  kinematic_models_.push_back(&robot.get_kinematic_model());
+  control_inputs_.emplace_back(
+      robot.get_kinematic_model().control_input_size);
+}
+
+void Playground::AddRobot(const Robot& robot, const Pilot& pilot,
+                          const IntegratorType& integrator_type,
+                          const int uid) {
+  AddRobotToSlot(robot, &pilot, integrator_type, uid);
   pilot_oracle_.insert({uid, const_cast<Pilot&>(pilot)});
 }
 
+void Playground::AddRobot(const Robot& robot, const BatchPilot& batch_pilot,
+                          const IntegratorType& integrator_type,
+                          const int uid) {
+  // Finding the group of robots that the batch pilot already controls.
+  auto group = std::find_if(batch_pilot_groups_.begin(),
+                            batch_pilot_groups_.end(),
+                            [&](const BatchPilotGroup& batch_pilot_group) {
+                              return batch_pilot_group.batch_pilot ==
+                                     &batch_pilot;
+                            });
+
+  // The batch pilot computes the control inputs of all its robots as the
+  // rows of a single matrix, so they must be of the same size.
+  if (group != batch_pilot_groups_.end()) {
+    MORPH_REQUIRE(
+        robot.get_kinematic_model().control_input_size ==
+            kinematic_models_[group->slots.front()]->control_input_size,
+        std::invalid_argument,
+        "All the robots of a batch pilot must have the same control input "
+        "size.");
+  }
+
+  AddRobotToSlot(robot, nullptr, integrator_type, uid);
+  batch_pilot_oracle_.insert({uid, const_cast<BatchPilot&>(batch_pilot)});
+
+  if (group == batch_pilot_groups_.end()) {
+    batch_pilot_groups_.push_back({&batch_pilot, {}, {}});
+    group = batch_pilot_groups_.end() - 1;
+  }
+  group->uids.push_back(uid);
+  group->slots.push_back(playground_state_.get_robot_slot(uid));
+}
+
+void Playground::ExecuteBatchPilots() {
+  for (const auto& batch_pilot_group : batch_pilot_groups_) {
+    const MatrixXd control_inputs = batch_pilot_group.batch_pilot->Execute(
+        playground_state_, batch_pilot_group.uids);
+
+    // Making sure that the batch pilot computed a control input of the
+    // correct dimensions for each of its robots.
+    const int num_robots = batch_pilot_group.slots.size();
+    MORPH_REQUIRE(
+        control_inputs.rows() == num_robots &&
+            control_inputs.cols() ==
+                kinematic_models_[batch_pilot_group.slots.front()]
+                    ->control_input_size,
+        std::logic_error,
+        "Batch pilot control inputs must have a row for each robot, of the "
+        "kinematic model control input dimensions.");
+
+    // Copying into the preallocated control inputs of the slots.
+    for (int i = 0; i < num_robots; ++i) {
+      control_inputs_[batch_pilot_group.slots[i]].get_data_ref() =
+          control_inputs.row(i).transpose();
+    }
+  }
+}
+
+void Playground::ExecuteCycle() {
+  // Each robot is stepped independently. The current robot states are only
+  // read while stepping, and the updated states are written into the next
+  // state buffer. Hence the robots can be stepped in parallel and the result
+  // doesn't depend on the order in which they are stepped.
+  // The robots are indexed by their slots, so no uid lookups are required.
+  const vector<int>& uids = playground_state_.get_robot_uids();
+  const vector<State>& robot_states = playground_state_.get_robot_states();
+  vector<State>& next_robot_states =
+      playground_state_.get_next_robot_states_ref();
+
+  // The batch pilots compute the control inputs of their robots up front.
+  // Each of them is executed once per cycle, on the calling thread.
+  ExecuteBatchPilots();
+
+  thread_pool_->ParallelFor(uids.size(), [&](const int slot) {
+    // Robots that are controlled by a batch pilot already have their control
+    // input computed.
+    if (pilots_[slot] != nullptr) {
+      control_inputs_[slot] =
+          pilots_[slot]->Execute(playground_state_, uids[slot]);
+
+      // Making sure that the control input computed by the pilot is of the
+      // correct dimensions.
+      MORPH_REQUIRE(control_inputs_[slot].get_size() ==
+                        kinematic_models_[slot]->control_input_size,
+                    std::logic_error,
+                    "Pilot control input and kinematic model control input "
+                    "dimensions do not match.");
+    }
+
+    // The integrator writes the updated state directly into the slot of the
+    // next state buffer. Each robot has its own integrator, so its scratch
+    // buffers aren't shared across threads.
+    integrators_[slot]->Step(robot_states[slot], control_inputs_[slot],
+                             playground_spec_.dt, next_robot_states[slot]);
+  });
+
+  // Updating the states of the robots.
+  playground_state_.SwapRobotStateBuffers();
+
+  // Update the time.
+  playground_state_.set_time(playground_state_.get_time() +
+                             playground_spec_.dt);
+}
+
+void Playground::Execute() {
+  ExecuteCycle();
+  playground_state_.SyncRobots();
+}
+
+void Playground::Run(const int num_steps) {
+  MORPH_REQUIRE(num_steps >= 0, std::invalid_argument,
+                "Number of steps must be non-negative.");
+  // The robots are only synced once, after the last cycle.
+  for (int i = 0; i < num_steps; ++i) {
+    ExecuteCycle();
+  }
+  playground_state_.SyncRobots();
+}
+
+void Playground::RunUntil(const double time) {
+  // The number of steps is computed beforehand instead of comparing against
+  // the accumulated time every cycle. This way floating point errors in the
+  // accumulated time can't result in an additional cycle being executed.
+  // The tolerance accounts for time values that are (numerically) a multiple
+  // of dt.
+  const double remaining_time = time - playground_state_.get_time();
+  const int num_steps = max(
+      0, static_cast<int>(ceil(remaining_time / playground_spec_.dt - 1e-9)));
+  Run(num_steps);
+}
+
 }  // namespace playground
 }  // namespace simulation
 }  // namespace morphac
@@ -4,27 +4,68 @@ namespace morphac {
 namespace simulation {
 namespace playground {
 
+using std::fill;
+using std::lock_guard;
+using std::make_unique;
+using std::mutex;
 using std::unordered_map;
+using std::vector;
 
+using Eigen::VectorXd;
+
+using morphac::constructs::Pose;
 using morphac::constructs::State;
 using morphac::environment::Map;
 using morphac::robot::blueprint::Robot;
 
-PlaygroundState::PlaygroundState(const Map& map) : time_(0), map_(map) {}
+PlaygroundState::PlaygroundState(const Map& map)
+    : time_(0),
+      map_(map),
+      robot_states_(make_unique<RobotStates>()),
+      next_robot_states_(make_unique<RobotStates>()),
+      robot_pose_offsets_(1, 0),
+      are_next_robot_states_written_(false),
+      are_robots_synced_(true) {}
 
 bool PlaygroundState::UidExistsInRobotOracle(const int uid) const {
-  if (robot_oracle_.find(uid) == robot_oracle_.end()) {
+  if (robot_slots_.find(uid) == robot_slots_.end()) {
     // Given uid doesn't exist in the robot oracle.
     return false;
   }
   return true;
 }
 
+void PlaygroundState::PackRobotPose(const int slot) {
+  const Pose& pose = (*robot_states_)[slot].get_pose();
+  // Empty poses don't take up any space in the packed poses.
+  if (!pose.IsEmpty()) {
+    robot_poses_.segment(robot_pose_offsets_[slot], pose.get_size()) =
+        pose.get_data();
+  }
+}
+
+void PlaygroundState::SyncRobots() const {
+  // Multiple pilots could be accessing the robots concurrently. Only one of
+  // them needs to update the robots.
+  if (are_robots_synced_) {
+    return;
+  }
+  lock_guard<mutex> lock(sync_mutex_);
+  if (are_robots_synced_) {
+    return;
+  }
+  for (unsigned int slot = 0; slot < robots_.size(); ++slot) {
+    robots_[slot]->set_state((*robot_states_)[slot]);
+  }
+  are_robots_synced_ = true;
+}
+
 double PlaygroundState::get_time() const { return time_; }
 
 const Map& PlaygroundState::get_map() const { return map_; }
 
 const unordered_map<int, Robot&>& PlaygroundState::get_robot_oracle() const {
+  SyncRobots();
   return robot_oracle_;
 }
 
@@ -33,7 +74,8 @@ const Robot& PlaygroundState::get_robot(const int uid) const {
   MORPH_REQUIRE(
       UidExistsInRobotOracle(uid), std::invalid_argument,
       "Robot with the given UID does not exist in the playground state.");
-  return robot_oracle_.find(uid)->second;
+  SyncRobots();
+  return *robots_[robot_slots_.find(uid)->second];
 }
 
 const State& PlaygroundState::get_robot_state(const int uid) const {
@@ -41,8 +83,7 @@ const State& PlaygroundState::get_robot_state(const int uid) const {
   MORPH_REQUIRE(
       UidExistsInRobotOracle(uid), std::invalid_argument,
       "Robot with the given UID does not exist in the playground state.");
-  // We can't use the [] operator as the values are references.
-  return robot_oracle_.find(uid)->second.get_state();
+  return (*robot_states_)[robot_slots_.find(uid)->second];
 }
 
 void PlaygroundState::set_time(const double time) { time_ = time; }
@@ -54,10 +95,81 @@ void PlaygroundState::set_robot_state(const State& state, const int uid) {
   MORPH_REQUIRE(
       UidExistsInRobotOracle(uid), std::invalid_argument,
       "Robot with the given UID does not exist in the playground state.");
-  robot_oracle_.find(uid)->second.set_state(state);
+  const int slot = robot_slots_.find(uid)->second;
+  // The robot's setter does the dimension check.
+  robots_[slot]->set_state(state);
+  // The state is written into both the buffers so that it persists even if
+  // the buffers are swapped without the next state of the robot being set.
+  (*robot_states_)[slot] = state;
+  (*next_robot_states_)[slot] = state;
+  PackRobotPose(slot);
+}
+
+void PlaygroundState::set_next_robot_state(const State& state, const int uid) {
+  // Make sure that a robot with the given uid exists in the oracle.
+  MORPH_REQUIRE(
+      UidExistsInRobotOracle(uid), std::invalid_argument,
+      "Robot with the given UID does not exist in the playground state.");
+  const int slot = robot_slots_.find(uid)->second;
+  State& next_state = (*next_robot_states_)[slot];
+  MORPH_REQUIRE(next_state.get_pose_size() == state.get_pose_size() &&
+                    next_state.get_velocity_size() == state.get_velocity_size(),
+                std::invalid_argument,
+                "Given state and robot state dimensions do not match.");
+  next_state = state;
+  is_next_robot_state_written_[slot] = true;
+}
+
+void PlaygroundState::SwapRobotStateBuffers() {
+  // The slots whose next states weren't written carry their current states
+  // over, so that they don't go back in time once the buffers are swapped.
+  // The states have the same dimensions, so copying doesn't allocate.
+  if (!are_next_robot_states_written_) {
+    for (unsigned int slot = 0; slot < robot_states_->size(); ++slot) {
+      if (!is_next_robot_state_written_[slot]) {
+        (*next_robot_states_)[slot] = (*robot_states_)[slot];
+      }
+    }
+  }
+  robot_states_.swap(next_robot_states_);
+  for (unsigned int slot = 0; slot < robot_states_->size(); ++slot) {
+    PackRobotPose(slot);
+  }
+  fill(is_next_robot_state_written_.begin(),
+       is_next_robot_state_written_.end(), false);
+  are_next_robot_states_written_ = false;
+  are_robots_synced_ = false;
+}
+
+int PlaygroundState::get_robot_slot(const int uid) const {
+  MORPH_REQUIRE(
+      UidExistsInRobotOracle(uid), std::invalid_argument,
+      "Robot with the given UID does not exist in the playground state.");
+  return robot_slots_.find(uid)->second;
+}
+
+const vector<int>& PlaygroundState::get_robot_uids() const {
+  return robot_uids_;
+}
+
+const vector<State>& PlaygroundState::get_robot_states() const {
+  return *robot_states_;
+}
+
+const VectorXd& PlaygroundState::get_robot_poses() const {
+  return robot_poses_;
+}
+
+const vector<int>& PlaygroundState::get_robot_pose_offsets() const {
+  return robot_pose_offsets_;
+}
+
+vector<State>& PlaygroundState::get_next_robot_states_ref() {
+  are_next_robot_states_written_ = true;
+  return *next_robot_states_;
 }
 
-int PlaygroundState::NumRobots() const { return robot_oracle_.size(); }
+int PlaygroundState::NumRobots() const { return robots_.size(); }
 
 void PlaygroundState::AddRobot(const Robot& robot, const int uid) {
   // UID must be positive for aesthetic reasons. It also makes it easier to
@@ -66,7 +178,19 @@ void PlaygroundState::AddRobot(const Robot& robot, const int uid) {
   MORPH_REQUIRE(uid >= 0, std::invalid_argument, "UID must be positive");
   MORPH_REQUIRE(!UidExistsInRobotOracle(uid), std::invalid_argument,
                 "Robot with this UID already exists in the state.");
+  // The robot is added to the next free slot.
   robot_oracle_.insert({uid, const_cast<Robot&>(robot)});
+  robot_slots_.insert({uid, static_cast<int>(robots_.size())});
+  robot_uids_.push_back(uid);
+  robots_.push_back(&const_cast<Robot&>(robot));
+  robot_states_->push_back(robot.get_state());
+  next_robot_states_->push_back(robot.get_state());
+  is_next_robot_state_written_.push_back(false);
+  // The pose is appended to the end of the packed poses.
+  const int pose_size = robot.get_state().get_pose_size();
+  robot_poses_.conservativeResize(robot_poses_.size() + pose_size);
+  robot_pose_offsets_.push_back(robot_pose_offsets_.back() + pose_size);
+  PackRobotPose(robots_.size() - 1);
 }
 
 }  // namespace playground
@@ -14,14 +14,21 @@ class PlaygroundSpecTest : public ::testing::Test {
 
   PlaygroundSpec playground_spec1_{"playground1", 0.1};
   PlaygroundSpec playground_spec2_{"playground2", 0.05};
+  PlaygroundSpec playground_spec3_{"playground3", 0.02, 4};
 };
 
 TEST_F(PlaygroundSpecTest, Members) {
   ASSERT_EQ(playground_spec1_.name, "playground1");
   ASSERT_EQ(playground_spec1_.dt, 0.1);
+  ASSERT_EQ(playground_spec1_.num_threads, 1);
 
   ASSERT_EQ(playground_spec2_.name, "playground2");
   ASSERT_EQ(playground_spec2_.dt, 0.05);
+  ASSERT_EQ(playground_spec2_.num_threads, 1);
+
+  ASSERT_EQ(playground_spec3_.name, "playground3");
+  ASSERT_EQ(playground_spec3_.dt, 0.02);
+  ASSERT_EQ(playground_spec3_.num_threads, 4);
 }
 
 }  // namespace
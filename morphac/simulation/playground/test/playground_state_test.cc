@@ -2,6 +2,7 @@
 
 #include "Eigen/Dense"
 #include "gtest/gtest.h"
+#include "mechanics/models/include/ackermann_model.h"
 #include "mechanics/models/include/diffdrive_model.h"
 
 namespace {
@@ -9,12 +10,15 @@ namespace {
 using std::make_unique;
 using std::srand;
 using std::unique_ptr;
+using std::vector;
 
 using Eigen::MatrixXd;
 using Eigen::MatrixXi;
+using Eigen::VectorXd;
 
 using morphac::constructs::State;
 using morphac::environment::Map;
+using morphac::mechanics::models::AckermannModel;
 using morphac::mechanics::models::DiffdriveModel;
 using morphac::mechanics::models::KinematicModel;
 using morphac::robot::blueprint::Footprint;
@@ -25,6 +29,7 @@ using morphac::simulation::playground::PlaygroundState;
 // in Robot points to nothing and we get strange results.
 DiffdriveModel diffdrive_model1(1., 1.);
 DiffdriveModel diffdrive_model2(2., 2.);
+AckermannModel ackermann_model(1., 2.);
 
 class PlaygroundStateTest : public ::testing::Test {
  protected:
@@ -217,6 +222,158 @@ TEST_F(PlaygroundStateTest, SetRobotState) {
                std::invalid_argument);
 }
 
+TEST_F(PlaygroundStateTest, SetNextRobotState) {
+  playground_state1_->AddRobot(*robot1_, 1);
+  playground_state1_->AddRobot(*robot2_, 2);
+
+  State new_state1({1., 2., 3.}, {});
+  State new_state2({0., -5., 0.1}, {});
+
+  playground_state1_->set_next_robot_state(new_state1, 1);
+  playground_state1_->set_next_robot_state(new_state2, 2);
+
+  // The current states must not change until the buffers are swapped.
+  ASSERT_EQ(playground_state1_->get_robot_state(1), State(3, 0));
+  ASSERT_EQ(playground_state1_->get_robot_state(2), State(3, 0));
+  ASSERT_EQ(playground_state1_->get_robot(1).get_state(), State(3, 0));
+  ASSERT_EQ(playground_state1_->get_robot(2).get_state(), State(3, 0));
+
+  playground_state1_->SwapRobotStateBuffers();
+
+  ASSERT_EQ(playground_state1_->get_robot_state(1), new_state1);
+  ASSERT_EQ(playground_state1_->get_robot_state(2), new_state2);
+
+  // The robot objects must also reflect the current states.
+  ASSERT_EQ(playground_state1_->get_robot(1).get_state(), new_state1);
+  ASSERT_EQ(robot2_->get_state(), new_state2);
+
+  // Invalid uid.
+  ASSERT_THROW(playground_state1_->set_next_robot_state(State(3, 0), 0),
+               std::invalid_argument);
+  // Invalid dimensions.
+  ASSERT_THROW(playground_state1_->set_next_robot_state(State(4, 0), 1),
+               std::invalid_argument);
+}
+
+TEST_F(PlaygroundStateTest, SwapRobotStateBuffers) {
+  playground_state1_->AddRobot(*robot1_, 1);
+  playground_state1_->AddRobot(*robot2_, 2);
+
+  State new_state1({1., 2., 3.}, {});
+  State new_state2({0., -5., 0.1}, {});
+
+  // States that are set directly persist across swaps.
+  playground_state1_->set_robot_state(new_state1, 1);
+  playground_state1_->SwapRobotStateBuffers();
+  ASSERT_EQ(playground_state1_->get_robot_state(1), new_state1);
+  playground_state1_->SwapRobotStateBuffers();
+  ASSERT_EQ(playground_state1_->get_robot_state(1), new_state1);
+
+  // Robots whose next states aren't set retain their states.
+  playground_state1_->set_next_robot_state(new_state2, 1);
+  playground_state1_->SwapRobotStateBuffers();
+  ASSERT_EQ(playground_state1_->get_robot_state(1), new_state2);
+  ASSERT_EQ(playground_state1_->get_robot_state(2), State(3, 0));
+
+  // Through the oracle.
+  auto robot_oracle = playground_state1_->get_robot_oracle();
+  ASSERT_EQ(robot_oracle.find(1)->second.get_state(), new_state2);
+  ASSERT_EQ(robot_oracle.find(2)->second.get_state(), State(3, 0));
+
+  // The next state of the second robot is only set in the first of two
+  // cycles. It must not revert to its earlier state in the second one.
+  playground_state1_->set_next_robot_state(new_state1, 1);
+  playground_state1_->set_next_robot_state(new_state1, 2);
+  playground_state1_->SwapRobotStateBuffers();
+  playground_state1_->set_next_robot_state(new_state2, 1);
+  playground_state1_->SwapRobotStateBuffers();
+  ASSERT_EQ(playground_state1_->get_robot_state(1), new_state2);
+  ASSERT_EQ(playground_state1_->get_robot_state(2), new_state1);
+}
+
+TEST_F(PlaygroundStateTest, SyncRobots) {
+  playground_state1_->AddRobot(*robot1_, 1);
+  playground_state1_->AddRobot(*robot2_, 2);
+
+  State new_state({1., 2., 3.}, {});
+
+  // The robot objects are only updated once they are synced.
+  playground_state1_->set_next_robot_state(new_state, 2);
+  playground_state1_->SwapRobotStateBuffers();
+  ASSERT_EQ(robot2_->get_state(), State(3, 0));
+
+  playground_state1_->SyncRobots();
+  ASSERT_EQ(robot1_->get_state(), State(3, 0));
+  ASSERT_EQ(robot2_->get_state(), new_state);
+}
+
+TEST_F(PlaygroundStateTest, RobotSlots) {
+  playground_state1_->AddRobot(*robot1_, 5);
+  playground_state1_->AddRobot(*robot2_, 2);
+
+  // Slots are assigned in the order in which the robots are added.
+  ASSERT_EQ(playground_state1_->get_robot_slot(5), 0);
+  ASSERT_EQ(playground_state1_->get_robot_slot(2), 1);
+  ASSERT_EQ(playground_state1_->get_robot_uids(), vector<int>({5, 2}));
+  ASSERT_THROW(playground_state1_->get_robot_slot(1), std::invalid_argument);
+
+  State new_state1({1., 2., 3.}, {});
+  State new_state2({0., -5., 0.1}, {});
+
+  playground_state1_->set_robot_state(new_state1, 2);
+  ASSERT_EQ(playground_state1_->get_robot_states().size(), 2u);
+  ASSERT_EQ(playground_state1_->get_robot_states()[0], State(3, 0));
+  ASSERT_EQ(playground_state1_->get_robot_states()[1], new_state1);
+
+  // Writing into the next state buffer through the slots.
+  playground_state1_->get_next_robot_states_ref()[0] = new_state2;
+  playground_state1_->SwapRobotStateBuffers();
+
+  ASSERT_EQ(playground_state1_->get_robot_state(5), new_state2);
+  ASSERT_EQ(playground_state1_->get_robot(5).get_state(), new_state2);
+  ASSERT_EQ(playground_state1_->get_robot_state(2), new_state1);
+}
+
+TEST_F(PlaygroundStateTest, RobotPoses) {
+  // The ackermann robot has a larger pose than the diffdrive robots.
+  Robot robot3(ackermann_model, Footprint(MatrixXd::Zero(10, 2)),
+               State({1., 2., 3., 0.4}, {}));
+  ASSERT_EQ(playground_state1_->get_robot_poses().size(), 0);
+  ASSERT_EQ(playground_state1_->get_robot_pose_offsets(), vector<int>({0}));
+
+  playground_state1_->AddRobot(*robot1_, 5);
+  playground_state1_->AddRobot(robot3, 3);
+  playground_state1_->AddRobot(*robot2_, 2);
+
+  // The poses are packed in slot order.
+  ASSERT_EQ(playground_state1_->get_robot_pose_offsets(),
+            vector<int>({0, 3, 7, 10}));
+  VectorXd robot_poses(10);
+  robot_poses << 0., 0., 0., 1., 2., 3., 0.4, 0., 0., 0.;
+  ASSERT_TRUE(playground_state1_->get_robot_poses().isApprox(robot_poses));
+
+  // Setting the state updates the packed pose right away.
+  playground_state1_->set_robot_state(State({1., 2., 3.}, {}), 2);
+  robot_poses.tail<3>() << 1., 2., 3.;
+  ASSERT_TRUE(playground_state1_->get_robot_poses().isApprox(robot_poses));
+
+  // The next states are packed once the buffers are swapped.
+  playground_state1_->set_next_robot_state(State({0., -5., 0.1}, {}), 5);
+  playground_state1_->get_next_robot_states_ref()[1] =
+      State({4., 3., 2., 0.1}, {});
+  ASSERT_TRUE(playground_state1_->get_robot_poses().isApprox(robot_poses));
+
+  playground_state1_->SwapRobotStateBuffers();
+  robot_poses.head<7>() << 0., -5., 0.1, 4., 3., 2., 0.1;
+  ASSERT_TRUE(playground_state1_->get_robot_poses().isApprox(robot_poses));
+
+  // Robots whose next states weren't written keep their packed poses.
+  playground_state1_->set_next_robot_state(State({7., 7., 7.}, {}), 2);
+  playground_state1_->SwapRobotStateBuffers();
+  robot_poses.tail<3>() << 7., 7., 7.;
+  ASSERT_TRUE(playground_state1_->get_robot_poses().isApprox(robot_poses));
+}
+
 }  // namespace
 
 int main(int argc, char** argv) {
@@ -3,13 +3,17 @@
 #include "Eigen/Dense"
 #include "gtest/gtest.h"
 #include "mechanics/models/include/diffdrive_model.h"
+#include "mechanics/models/include/dubin_model.h"
 
 namespace {
 
+using std::cos;
 using std::make_unique;
+using std::sin;
 using std::sqrt;
 using std::srand;
 using std::unique_ptr;
+using std::vector;
 
 using Eigen::MatrixXd;
 using Eigen::MatrixXi;
@@ -20,8 +24,10 @@ using morphac::constructs::State;
 using morphac::environment::Map;
 using morphac::math::numeric::IntegratorType;
 using morphac::mechanics::models::DiffdriveModel;
+using morphac::mechanics::models::DubinModel;
 using morphac::robot::blueprint::Footprint;
 using morphac::robot::blueprint::Robot;
+using morphac::robot::pilot::BatchPilot;
 using morphac::robot::pilot::Pilot;
 using morphac::simulation::playground::Playground;
 using morphac::simulation::playground::PlaygroundSpec;
@@ -30,6 +36,7 @@ using morphac::simulation::playground::PlaygroundState;
 // Global kinematic models as if they're destroyed, the reference to the model
 // in Robot points to nothing and we get strange results.
 DiffdriveModel diffdrive_model(1., 1.);
+DubinModel dubin_model(1.);
 
 // Derived class from Pilot for testing.
 class CustomPilot : public Pilot {
@@ -50,6 +57,69 @@ class CustomPilot : public Pilot {
   VectorXd control_input_data_;
 };
 
+// Pilot whose control input depends on the state of another robot in the
+// playground. Used to test that the result of a simulation cycle doesn't depend
+// on the order in which the robots are stepped.
+class FollowerPilot : public Pilot {
+ public:
+  FollowerPilot(const int leader_uid) : Pilot(), leader_uid_(leader_uid) {}
+
+  ControlInput Execute(const PlaygroundState& playground_state,
+                       const int uid) const override {
+    const State& leader_state = playground_state.get_robot_state(leader_uid_);
+    const State& state = playground_state.get_robot_state(uid);
+    double linear = leader_state[0] - state[0];
+    double angular = leader_state[1] - state[1];
+    return ControlInput({linear - angular, linear + angular});
+  }
+
+ private:
+  int leader_uid_;
+};
+
+// Batch pilot that computes the same control inputs as a FollowerPilot for
+// each of its robots, where robot uid follows robot (uid + 1) % num_robots.
+class FollowerBatchPilot : public BatchPilot {
+ public:
+  FollowerBatchPilot(const int num_robots)
+      : BatchPilot(), num_robots_(num_robots) {}
+
+  MatrixXd Execute(const PlaygroundState& playground_state,
+                   const vector<int>& uids) const override {
+    MatrixXd control_inputs(uids.size(), 2);
+    for (unsigned int i = 0; i < uids.size(); ++i) {
+      const State& leader_state =
+          playground_state.get_robot_state((uids[i] + 1) % num_robots_);
+      const State& state = playground_state.get_robot_state(uids[i]);
+      double linear = leader_state[0] - state[0];
+      double angular = leader_state[1] - state[1];
+      control_inputs.row(i) << linear - angular, linear + angular;
+    }
+    return control_inputs;
+  }
+
+ private:
+  int num_robots_;
+};
+
+// Batch pilot that computes the same control input for all of its robots.
+class ConstantBatchPilot : public BatchPilot {
+ public:
+  ConstantBatchPilot(VectorXd control_input_data)
+      : BatchPilot(), control_input_data_(control_input_data) {}
+
+  MatrixXd Execute(const PlaygroundState& playground_state,
+                   const vector<int>& uids) const override {
+    // Some asserts to prevent the unused variable warning.
+    MORPH_REQUIRE(playground_state.NumRobots() >= 0, std::invalid_argument,
+                  "Invalid PlaygroundState");
+    return control_input_data_.transpose().replicate(uids.size(), 1);
+  }
+
+ private:
+  VectorXd control_input_data_;
+};
+
 class PlaygroundTest : public ::testing::Test {
  protected:
   PlaygroundTest() {
@@ -76,6 +146,16 @@ class PlaygroundTest : public ::testing::Test {
   PlaygroundSpec playground_spec_{"playground", 0.05};
 };
 
+TEST_F(PlaygroundTest, InvalidConstruction) {
+  // Non-positive dt.
+  ASSERT_THROW(Playground(PlaygroundSpec{"playground", 0.}, Map(10., 10., 1.)),
+               std::invalid_argument);
+  // Non-positive number of threads.
+  ASSERT_THROW(
+      Playground(PlaygroundSpec{"playground", 0.1, 0}, Map(10., 10., 1.)),
+      std::invalid_argument);
+}
+
 TEST_F(PlaygroundTest, GetState) {
   // Making sure that we get can get the correct state from the playground.
   PlaygroundState& playground_state = playground_->get_state();
@@ -163,6 +243,242 @@ TEST_F(PlaygroundTest, InvalidAddRobot) {
                std::logic_error);
 }
 
+TEST_F(PlaygroundTest, AddRobotWithBatchPilot) {
+  ConstantBatchPilot batch_pilot1(VectorXd::Zero(2)),
+      batch_pilot2(VectorXd::Ones(2));
+  CustomPilot pilot(VectorXd::Zero(2));
+
+  playground_->AddRobot(*robot1_, batch_pilot1,
+                        IntegratorType::kEulerIntegrator, 1);
+  playground_->AddRobot(*robot2_, pilot, IntegratorType::kEulerIntegrator, 2);
+  playground_->AddRobot(*robot3_, batch_pilot1,
+                        IntegratorType::kRK4Integrator, 3);
+
+  ASSERT_EQ(playground_->get_state().NumRobots(), 3);
+  ASSERT_EQ(&playground_->get_batch_pilot(1), &batch_pilot1);
+  ASSERT_EQ(&playground_->get_batch_pilot(3), &batch_pilot1);
+  ASSERT_EQ(&playground_->get_pilot(2), &pilot);
+  // Only the robots added with a pilot are in the pilot oracle.
+  ASSERT_EQ(playground_->get_pilot_oracle().size(), 1U);
+  ASSERT_NO_THROW(playground_->get_integrator(3));
+
+  // The pilot getters only work for the robots of the respective pilots.
+  ASSERT_THROW(playground_->get_pilot(1), std::invalid_argument);
+  ASSERT_THROW(playground_->get_batch_pilot(2), std::invalid_argument);
+
+  // Duplicate uids across both kinds of pilots.
+  Robot robot4(diffdrive_model, Footprint(MatrixXd::Zero(20, 2)));
+  ASSERT_THROW(playground_->AddRobot(robot4, batch_pilot2,
+                                     IntegratorType::kEulerIntegrator, 2),
+               std::invalid_argument);
+  ASSERT_THROW(
+      playground_->AddRobot(robot4, pilot, IntegratorType::kEulerIntegrator, 3),
+      std::invalid_argument);
+
+  // The robots of a batch pilot must have the same control input size.
+  Robot dubin_robot(dubin_model, Footprint(MatrixXd::Zero(20, 2)));
+  ASSERT_THROW(playground_->AddRobot(dubin_robot, batch_pilot1,
+                                     IntegratorType::kEulerIntegrator, 4),
+               std::invalid_argument);
+  // A failed addition must not leave the robot behind.
+  ASSERT_EQ(playground_->get_state().NumRobots(), 3);
+  // Robots of different batch pilots may differ.
+  playground_->AddRobot(dubin_robot, batch_pilot2,
+                        IntegratorType::kEulerIntegrator, 4);
+  ASSERT_EQ(playground_->get_state().NumRobots(), 4);
+}
+
+TEST_F(PlaygroundTest, Execute) {
+  // The pilots need to outlive the playground as it only stores references.
+  CustomPilot pilot1(VectorXd::Zero(2)), pilot2(VectorXd::Ones(2));
+
+  playground_->AddRobot(*robot1_, pilot1, IntegratorType::kMidPointIntegrator,
+                        1);
+  playground_->AddRobot(*robot2_, pilot2, IntegratorType::kRK4Integrator, 2);
+
+  playground_->Execute();
+
+  // The first pilot gives zero control inputs, hence the state must remain
+  // unchanged.
+  ASSERT_EQ(playground_->get_state().get_robot_state(1), State(3, 0));
+
+  // The second robot receives a constant input of [1., 1.]. As the wheel
+  // radius = 1 m, the robot moves forward with a velocity of 1 m/s in the x
+  // direction (The initial angle is zero).
+  ASSERT_EQ(playground_->get_state().get_robot_state(2),
+            State({1. + playground_spec_.dt, 2., 0.}, {}));
+
+  // The robot objects must be updated as well.
+  ASSERT_EQ(robot2_->get_state(),
+            State({1. + playground_spec_.dt, 2., 0.}, {}));
+
+  // Make sure that the playground time has updated.
+  ASSERT_DOUBLE_EQ(playground_->get_state().get_time(), playground_spec_.dt);
+}
+
+TEST_F(PlaygroundTest, InvalidExecute) {
+  // Pilot that computes control inputs of the wrong dimensions.
+  CustomPilot pilot(VectorXd::Zero(3));
+  playground_->AddRobot(*robot1_, pilot, IntegratorType::kEulerIntegrator, 1);
+
+  ASSERT_THROW(playground_->Execute(), std::logic_error);
+}
+
+TEST_F(PlaygroundTest, ExecuteWithBatchPilot) {
+  ConstantBatchPilot batch_pilot(VectorXd::Ones(2));
+  CustomPilot pilot(VectorXd::Ones(2));
+
+  playground_->AddRobot(*robot2_, batch_pilot,
+                        IntegratorType::kMidPointIntegrator, 1);
+  playground_->AddRobot(*robot1_, pilot, IntegratorType::kEulerIntegrator, 2);
+  playground_->AddRobot(*robot3_, batch_pilot, IntegratorType::kRK4Integrator,
+                        3);
+
+  playground_->Execute();
+
+  // All the robots move forward with a velocity of 1 m/s along their
+  // headings.
+  ASSERT_EQ(playground_->get_state().get_robot_state(1),
+            State({1. + playground_spec_.dt, 2., 0.}, {}));
+  ASSERT_EQ(playground_->get_state().get_robot_state(2),
+            State({playground_spec_.dt, 0., 0.}, {}));
+  ASSERT_EQ(playground_->get_state().get_robot_state(3),
+            State({-5. + playground_spec_.dt * cos(1.57),
+                   7. + playground_spec_.dt * sin(1.57), 1.57},
+                  {}));
+}
+
+TEST_F(PlaygroundTest, InvalidExecuteWithBatchPilot) {
+  // Batch pilot that computes control inputs of the wrong dimensions.
+  ConstantBatchPilot batch_pilot(VectorXd::Zero(3));
+  playground_->AddRobot(*robot1_, batch_pilot,
+                        IntegratorType::kEulerIntegrator, 1);
+
+  ASSERT_THROW(playground_->Execute(), std::logic_error);
+}
+
+TEST_F(PlaygroundTest, Run) {
+  CustomPilot pilot1(VectorXd::Ones(2)), pilot2(-VectorXd::Ones(2));
+
+  playground_->AddRobot(*robot2_, pilot1, IntegratorType::kEulerIntegrator, 1);
+  playground_->AddRobot(*robot3_, pilot2, IntegratorType::kRK4Integrator, 2);
+
+  // Running for zero steps must not change anything.
+  playground_->Run(0);
+  ASSERT_EQ(playground_->get_state().get_time(), 0.);
+  ASSERT_EQ(playground_->get_state().get_robot_state(1),
+            State({1., 2., 0.}, {}));
+
+  // Both robots move with a linear velocity of 1 m/s along their headings (The
+  // second one moves backwards).
+  playground_->Run(20);
+  ASSERT_NEAR(playground_->get_state().get_time(), 1., 1e-9);
+  ASSERT_EQ(playground_->get_state().get_robot_state(1),
+            State({2., 2., 0.}, {}));
+  ASSERT_EQ(playground_->get_state().get_robot_state(2),
+            State({-5. - cos(1.57), 7. - sin(1.57), 1.57}, {}));
+  ASSERT_EQ(robot2_->get_state(), State({2., 2., 0.}, {}));
+  ASSERT_EQ(robot3_->get_state(),
+            State({-5. - cos(1.57), 7. - sin(1.57), 1.57}, {}));
+
+  // Invalid number of steps.
+  ASSERT_THROW(playground_->Run(-1), std::invalid_argument);
+}
+
+TEST_F(PlaygroundTest, RunUntil) {
+  CustomPilot pilot(VectorXd::Ones(2));
+  playground_->AddRobot(*robot2_, pilot, IntegratorType::kEulerIntegrator, 1);
+
+  // Time that is a multiple of dt.
+  playground_->RunUntil(0.5);
+  ASSERT_NEAR(playground_->get_state().get_time(), 0.5, 1e-9);
+  ASSERT_EQ(playground_->get_state().get_robot_state(1),
+            State({1.5, 2., 0.}, {}));
+
+  // Time that isn't a multiple of dt. The playground must run till the next
+  // multiple of dt.
+  playground_->RunUntil(0.62);
+  ASSERT_NEAR(playground_->get_state().get_time(), 0.65, 1e-9);
+  ASSERT_EQ(playground_->get_state().get_robot_state(1),
+            State({1.65, 2., 0.}, {}));
+
+  // Running until a time in the past must not do anything.
+  playground_->RunUntil(0.1);
+  ASSERT_NEAR(playground_->get_state().get_time(), 0.65, 1e-9);
+}
+
+TEST_F(PlaygroundTest, MultiThreadedExecute) {
+  // The simulation must give the exact same result irrespective of the number
+  // of threads.
+  const int num_robots = 200;
+  vector<VectorXd> initial_states_data;
+  vector<unique_ptr<FollowerPilot>> pilots;
+  for (int i = 0; i < num_robots; ++i) {
+    initial_states_data.push_back(VectorXd::Random(3));
+    pilots.push_back(make_unique<FollowerPilot>((i + 1) % num_robots));
+  }
+
+  vector<IntegratorType> integrator_types = {
+      IntegratorType::kEulerIntegrator, IntegratorType::kMidPointIntegrator,
+      IntegratorType::kRK4Integrator};
+
+  // Final robot states for each of the thread counts.
+  vector<vector<VectorXd>> final_states_data;
+  for (int num_threads : {1, 2, 4, 7}) {
+    // Each playground gets its own robots as the playground updates the states
+    // of the robot objects.
+    vector<unique_ptr<Robot>> robots;
+    Playground playground(PlaygroundSpec{"playground", 0.01, num_threads},
+                          Map(map_data_, 0.1));
+    for (int i = 0; i < num_robots; ++i) {
+      robots.push_back(make_unique<Robot>(
+          diffdrive_model, Footprint(MatrixXd::Zero(20, 2)),
+          State(initial_states_data[i], VectorXd::Zero(0))));
+      playground.AddRobot(*robots[i], *pilots[i], integrator_types[i % 3], i);
+    }
+
+    playground.Run(50);
+
+    vector<VectorXd> states_data;
+    for (int i = 0; i < num_robots; ++i) {
+      states_data.push_back(
+          playground.get_state().get_robot_state(i).get_data());
+    }
+    final_states_data.push_back(states_data);
+  }
+
+  // Bitwise equality with the single threaded result.
+  for (unsigned int j = 1; j < final_states_data.size(); ++j) {
+    for (int i = 0; i < num_robots; ++i) {
+      ASSERT_TRUE(final_states_data[j][i] == final_states_data[0][i]);
+    }
+  }
+
+  // Controlling every other robot with an equivalent batch pilot must give
+  // the exact same result as well.
+  FollowerBatchPilot batch_pilot(num_robots);
+  vector<unique_ptr<Robot>> robots;
+  Playground playground(PlaygroundSpec{"playground", 0.01, 4},
+                        Map(map_data_, 0.1));
+  for (int i = 0; i < num_robots; ++i) {
+    robots.push_back(make_unique<Robot>(
+        diffdrive_model, Footprint(MatrixXd::Zero(20, 2)),
+        State(initial_states_data[i], VectorXd::Zero(0))));
+    if (i % 2 == 0) {
+      playground.AddRobot(*robots[i], batch_pilot, integrator_types[i % 3], i);
+    } else {
+      playground.AddRobot(*robots[i], *pilots[i], integrator_types[i % 3], i);
+    }
+  }
+
+  playground.Run(50);
+
+  for (int i = 0; i < num_robots; ++i) {
+    ASSERT_TRUE(playground.get_state().get_robot_state(i).get_data() ==
+                final_states_data[0][i]);
+  }
+}
+
 }  // namespace
 
 int main(int argc, char** argv) {
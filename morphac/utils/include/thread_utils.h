@@ -0,0 +1,71 @@
+#ifndef THREAD_UTILS_H
+#define THREAD_UTILS_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/error_handling/include/error_macros.h"
+
+namespace morphac {
+namespace utils {
+
+// Fixed size pool of worker threads that is used to parallelize independent
+// tasks (Like stepping each robot in the playground). The threads are created
+// once so that the pool can be used every simulation cycle without incurring
+// the cost of spawning threads.
+// The calling thread also participates in the work, so a pool with n threads
+// only creates n - 1 worker threads. A pool with a single thread runs
+// everything in the calling thread.
+class ThreadPool {
+ public:
+  ThreadPool(const int num_threads);
+
+  // The pool is non copyable as it owns the threads.
+  ThreadPool(const ThreadPool& thread_pool) = delete;
+  ThreadPool& operator=(const ThreadPool& thread_pool) = delete;
+
+  ~ThreadPool();
+
+  int get_num_threads() const;
+
+  // Calls function(index) for every index in [0, size) and blocks until all
+  // the calls have completed. The order in which the indices are processed is
+  // not defined, so the calls must be independent of each other.
+  // If any of the calls throw, the remaining indices are skipped and the first
+  // exception is rethrown in the calling thread.
+  void ParallelFor(const int size,
+                   const std::function<void(const int)>& function);
+
+ private:
+  void WorkerLoop();
+  void RunTasks();
+
+  const int num_threads_;
+  std::vector<std::thread> workers_;
+
+  std::mutex mutex_;
+  std::condition_variable work_condition_;
+  std::condition_variable done_condition_;
+
+  // Details of the current ParallelFor call. These are only modified while
+  // holding the mutex and when none of the workers are running tasks.
+  const std::function<void(const int)>* function_;
+  int size_;
+  int chunk_size_;
+  std::atomic<int> next_index_;
+  int generation_;
+  int num_busy_workers_;
+  std::exception_ptr exception_;
+  bool stop_;
+};
+
+}  // namespace utils
+}  // namespace morphac
+
+#endif
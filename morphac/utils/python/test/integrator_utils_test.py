@@ -7,6 +7,8 @@ from morphac.math.numeric import (
     EulerIntegrator,
     MidPointIntegrator,
     RK4Integrator,
+    DormandPrinceIntegrator,
+    ExactIntegrator,
 )
 from morphac.mechanics.models import DiffdriveModel
 from morphac.utils.integrator_utils import integrator_from_type
@@ -19,8 +21,16 @@ def generate_integrator_list():
         IntegratorType.EULER_INTEGRATOR,
         IntegratorType.MID_POINT_INTEGRATOR,
         IntegratorType.RK4_INTEGRATOR,
+        IntegratorType.DORMAND_PRINCE_INTEGRATOR,
+        IntegratorType.EXACT_INTEGRATOR,
+    ]
+    integrator_class_list = [
+        EulerIntegrator,
+        MidPointIntegrator,
+        RK4Integrator,
+        DormandPrinceIntegrator,
+        ExactIntegrator,
     ]
-    integrator_class_list = [EulerIntegrator, MidPointIntegrator, RK4Integrator]
 
     return integrator_type_list, integrator_class_list
 
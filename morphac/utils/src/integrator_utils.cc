@@ -6,7 +6,9 @@ namespace utils {
 using std::make_unique;
 using std::unique_ptr;
 
+using morphac::math::numeric::DormandPrinceIntegrator;
 using morphac::math::numeric::EulerIntegrator;
+using morphac::math::numeric::ExactIntegrator;
 using morphac::math::numeric::Integrator;
 using morphac::math::numeric::IntegratorType;
 using morphac::math::numeric::MidPointIntegrator;
@@ -22,6 +24,10 @@ unique_ptr<Integrator> IntegratorFromType(const IntegratorType& integrator_type,
       return std::move(make_unique<MidPointIntegrator>(kinematic_model));
     case IntegratorType::kRK4Integrator:
       return std::move(make_unique<RK4Integrator>(kinematic_model));
+    case IntegratorType::kDormandPrinceIntegrator:
+      return std::move(make_unique<DormandPrinceIntegrator>(kinematic_model));
+    case IntegratorType::kExactIntegrator:
+      return std::move(make_unique<ExactIntegrator>(kinematic_model));
     default:
       MORPH_THROW(std::invalid_argument,
                   "Integrator type does not match any of the defined types.");
@@ -0,0 +1,140 @@
+#include "utils/include/thread_utils.h"
+
+namespace morphac {
+namespace utils {
+
+using std::exception_ptr;
+using std::function;
+using std::lock_guard;
+using std::max;
+using std::min;
+using std::mutex;
+using std::thread;
+using std::unique_lock;
+
+ThreadPool::ThreadPool(const int num_threads)
+    : num_threads_(num_threads),
+      function_(nullptr),
+      size_(0),
+      chunk_size_(1),
+      next_index_(0),
+      generation_(0),
+      num_busy_workers_(0),
+      exception_(nullptr),
+      stop_(false) {
+  MORPH_REQUIRE(num_threads > 0, std::invalid_argument,
+                "Number of threads must be positive.");
+  // The calling thread is one of the threads of the pool.
+  for (int i = 0; i < num_threads - 1; ++i) {
+    workers_.emplace_back(&ThreadPool::WorkerLoop, this);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    lock_guard<mutex> lock(mutex_);
+    stop_ = true;
+  }
+  work_condition_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+int ThreadPool::get_num_threads() const { return num_threads_; }
+
+void ThreadPool::ParallelFor(const int size,
+                             const function<void(const int)>& function) {
+  MORPH_REQUIRE(size >= 0, std::invalid_argument,
+                "Number of tasks must be non-negative.");
+
+  // No need to wake up the workers if there is nothing to parallelize.
+  if (workers_.empty() || size <= 1) {
+    for (int i = 0; i < size; ++i) {
+      function(i);
+    }
+    return;
+  }
+
+  {
+    lock_guard<mutex> lock(mutex_);
+    function_ = &function;
+    size_ = size;
+    // Tasks are handed out in chunks to reduce contention on the index
+    // counter. A few chunks per thread keep the load balanced when the tasks
+    // take different amounts of time.
+    chunk_size_ = max(1, size / (4 * num_threads_));
+    next_index_ = 0;
+    exception_ = nullptr;
+    num_busy_workers_ = workers_.size();
+    ++generation_;
+  }
+  work_condition_.notify_all();
+
+  RunTasks();
+
+  exception_ptr exception;
+  {
+    unique_lock<mutex> lock(mutex_);
+    done_condition_.wait(lock, [this] { return num_busy_workers_ == 0; });
+    function_ = nullptr;
+    exception = exception_;
+    exception_ = nullptr;
+  }
+
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+void ThreadPool::WorkerLoop() {
+  int seen_generation = 0;
+  while (true) {
+    {
+      unique_lock<mutex> lock(mutex_);
+      work_condition_.wait(lock, [this, seen_generation] {
+        return stop_ || generation_ != seen_generation;
+      });
+      if (stop_) {
+        return;
+      }
+      seen_generation = generation_;
+    }
+
+    RunTasks();
+
+    {
+      lock_guard<mutex> lock(mutex_);
+      --num_busy_workers_;
+    }
+    done_condition_.notify_one();
+  }
+}
+
+void ThreadPool::RunTasks() {
+  while (true) {
+    const int start = next_index_.fetch_add(chunk_size_);
+    if (start >= size_) {
+      return;
+    }
+    const int end = min(start + chunk_size_, size_);
+    try {
+      for (int i = start; i < end; ++i) {
+        (*function_)(i);
+      }
+    } catch (...) {
+      {
+        lock_guard<mutex> lock(mutex_);
+        if (!exception_) {
+          exception_ = std::current_exception();
+        }
+      }
+      // Skip all of the remaining tasks.
+      next_index_ = size_;
+      return;
+    }
+  }
+}
+
+}  // namespace utils
+}  // namespace morphac
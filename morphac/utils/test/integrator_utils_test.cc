@@ -11,7 +11,9 @@ namespace {
 using Eigen::VectorXd;
 using morphac::constructs::ControlInput;
 using morphac::constructs::State;
+using morphac::math::numeric::DormandPrinceIntegrator;
 using morphac::math::numeric::EulerIntegrator;
+using morphac::math::numeric::ExactIntegrator;
 using morphac::math::numeric::Integrator;
 using morphac::math::numeric::IntegratorType;
 using morphac::math::numeric::MidPointIntegrator;
@@ -38,6 +40,18 @@ TEST(IntegratorUtilsTest, Construction) {
   ASSERT_TRUE(dynamic_cast<RK4Integrator*>(integrator.get()) != nullptr);
   integrated_state = integrator->Step(State(3, 0), ControlInput(2), 0.05);
   ASSERT_TRUE(integrated_state.get_data().isApprox(VectorXd::Zero(3)));
+
+  integrator =
+      IntegratorFromType(IntegratorType::kDormandPrinceIntegrator, model);
+  ASSERT_TRUE(dynamic_cast<DormandPrinceIntegrator*>(integrator.get()) !=
+              nullptr);
+  integrated_state = integrator->Step(State(3, 0), ControlInput(2), 0.05);
+  ASSERT_TRUE(integrated_state.get_data().isApprox(VectorXd::Zero(3)));
+
+  integrator = IntegratorFromType(IntegratorType::kExactIntegrator, model);
+  ASSERT_TRUE(dynamic_cast<ExactIntegrator*>(integrator.get()) != nullptr);
+  integrated_state = integrator->Step(State(3, 0), ControlInput(2), 0.05);
+  ASSERT_TRUE(integrated_state.get_data().isApprox(VectorXd::Zero(3)));
 }
 
 }  // namespace
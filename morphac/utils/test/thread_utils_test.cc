@@ -0,0 +1,85 @@
+#include "utils/include/thread_utils.h"
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using std::vector;
+
+using morphac::utils::ThreadPool;
+
+TEST(ThreadUtilsTest, Construction) {
+  ThreadPool thread_pool1(1);
+  ThreadPool thread_pool2(4);
+
+  ASSERT_EQ(thread_pool1.get_num_threads(), 1);
+  ASSERT_EQ(thread_pool2.get_num_threads(), 4);
+}
+
+TEST(ThreadUtilsTest, InvalidConstruction) {
+  ASSERT_THROW(ThreadPool(0), std::invalid_argument);
+  ASSERT_THROW(ThreadPool(-1), std::invalid_argument);
+}
+
+TEST(ThreadUtilsTest, ParallelFor) {
+  // Each index must be processed exactly once, irrespective of the number of
+  // threads.
+  for (int num_threads = 1; num_threads <= 8; ++num_threads) {
+    ThreadPool thread_pool(num_threads);
+    for (int size : {0, 1, 2, 7, 1000}) {
+      vector<int> counts(size, 0);
+      thread_pool.ParallelFor(size, [&counts](const int index) {
+        counts[index] += index + 1;
+      });
+      for (int i = 0; i < size; ++i) {
+        ASSERT_EQ(counts[i], i + 1);
+      }
+    }
+  }
+}
+
+TEST(ThreadUtilsTest, RepeatedParallelFor) {
+  // The same pool must be reusable across many calls.
+  ThreadPool thread_pool(4);
+  vector<double> values(100, 0.);
+
+  for (int i = 0; i < 500; ++i) {
+    thread_pool.ParallelFor(
+        values.size(), [&values](const int index) { values[index] += 1.; });
+  }
+
+  for (auto& value : values) {
+    ASSERT_EQ(value, 500.);
+  }
+}
+
+TEST(ThreadUtilsTest, InvalidParallelFor) {
+  ThreadPool thread_pool(4);
+
+  ASSERT_THROW(thread_pool.ParallelFor(-1, [](const int) {}),
+               std::invalid_argument);
+
+  // Exceptions thrown by the tasks must be propagated to the calling thread.
+  ASSERT_THROW(thread_pool.ParallelFor(100,
+                                       [](const int index) {
+                                         if (index == 57) {
+                                           throw std::logic_error("Error");
+                                         }
+                                       }),
+               std::logic_error);
+
+  // The pool must still be usable after an exception.
+  vector<int> counts(10, 0);
+  thread_pool.ParallelFor(counts.size(),
+                          [&counts](const int index) { counts[index] = 1; });
+  for (auto& count : counts) {
+    ASSERT_EQ(count, 1);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}